@@ -2,9 +2,6 @@
 #include "level_set_shape.h"
 #include "surface_shape.h"
 
-#include <opencascade/GeomAPI_ProjectPointOnSurf.hxx>
-#include <opencascade/gp_Pnt.hxx>
-
 namespace SPH
 {
 namespace relax_dynamics
@@ -12,14 +9,22 @@ namespace relax_dynamics
 //=================================================================================================//
 ShapeSurfaceBounding2::ShapeSurfaceBounding2(RealBody &real_body_)
     : LocalDynamics(real_body_),
-      pos_(particles_->getVariableDataByName<Vecd>("Position"))
-{
-    shape_ = &real_body_.getInitialShape();
-}
+      pos_(particles_->getVariableDataByName<Vecd>("Position")),
+      shape_(&real_body_.getInitialShape()),
+      surface_shape_(dynamic_cast<SurfaceShape *>(shape_)),
+      surface_face_index_(particles_->registerStateVariable<int>("SurfaceFaceIndex", -1)),
+      surface_parameters_(particles_->registerStateVariable<Vec2d>("SurfaceParameters")) {}
 //=================================================================================================//
 void ShapeSurfaceBounding2::update(size_t index_i, Real dt)
 {
-    pos_[index_i] = shape_->findClosestPoint(pos_[index_i]);
+    if (surface_shape_ != nullptr)
+    {
+        pos_[index_i] = surface_shape_->findClosestPoint(pos_[index_i], surface_face_index_[index_i], surface_parameters_[index_i]);
+    }
+    else
+    {
+        pos_[index_i] = shape_->findClosestPoint(pos_[index_i]);
+    }
 }
 //=================================================================================================//
 RelaxationStepInnerFirstHalf::
@@ -60,24 +65,13 @@ SurfaceNormalDirection::SurfaceNormalDirection(SPHBody &sph_body)
 //=================================================================================================//
 void SurfaceNormalDirection::update(size_t index_i, Real dt)
 {
-    Extrema_ExtAlgo Algo = Extrema_ExtAlgo_Tree;
-    gp_Vec tangent_u, tangent_v;
-    gp_Vec norm;
-    Vecd normal_direction_;
-
-    gp_Pnt point1 = EigenToOcct(pos_[index_i]);
-    GeomAPI_ProjectPointOnSurf pointonsurf(point1, surface_shape_->surface_, Algo);
-
-    Standard_Real u;
-    Standard_Real v;
-    gp_Pnt Point;
-
-    pointonsurf.Parameters(1, u, v);
-
-    surface_shape_->surface_->D1(u, v, Point, tangent_u, tangent_v);
-    norm = tangent_u.Crossed(tangent_v);
-    normal_direction_ = OcctVecToEigen(norm);
-    n_[index_i] = normal_direction_.normalized();
+    int face_index = -1;
+    Vec2d parameters = Vec2d::Zero();
+    surface_shape_->findClosestPoint(pos_[index_i], face_index, parameters);
+    if (face_index >= 0)
+    {
+        n_[index_i] = surface_shape_->findNormalDirection(face_index, parameters);
+    }
 }
 //=================================================================================================//
 } // namespace relax_dynamics
@@ -51,6 +51,9 @@ class ShapeSurfaceBounding2 : public LocalDynamics
   protected:
     Vecd *pos_;
     Shape *shape_;
+    SurfaceShape *surface_shape_;
+    int *surface_face_index_;
+    Vec2d *surface_parameters_; /**< (u,v) parameters of the last projection for warm start */
 };
 
 class RelaxationStepInnerFirstHalf : public BaseDynamics<void>
@@ -1,32 +1,181 @@
 #include "surface_shape.h"
 
+#include <opencascade/BRepBndLib.hxx>
+#include <opencascade/BRepTools.hxx>
+#include <opencascade/BRep_Builder.hxx>
+#include <opencascade/BRep_Tool.hxx>
+#include <opencascade/Bnd_Box.hxx>
+#include <opencascade/Extrema_GenLocateExtPS.hxx>
+#include <opencascade/GeomAPI_ProjectPointOnSurf.hxx>
+#include <opencascade/GeomAdaptor_Surface.hxx>
+#include <opencascade/Precision.hxx>
 #include <opencascade/STEPCAFControl_Reader.hxx>
 #include <opencascade/TopExp_Explorer.hxx>
 #include <opencascade/TopoDS.hxx>
-#include <opencascade/BRep_Builder.hxx>
-#include <opencascade/GeomAPI_ProjectPointOnSurf.hxx>
 #include <opencascade/gp_Pnt.hxx>
 
 namespace SPH
 {
-	//=================================================================================================//
+//=================================================================================================//
+class SurfaceFaceProjector
+{
+  public:
+    explicit SurfaceFaceProjector(const SurfaceFace &face)
+        : adaptor_(face.surface_, face.u_min_, face.u_max_, face.v_min_, face.v_max_),
+          local_projector_(adaptor_, Precision::PConfusion(), Precision::PConfusion())
+    {
+        // the extrema search tree is built only once here
+        global_projector_.Init(face.surface_, face.u_min_, face.u_max_, face.v_min_, face.v_max_, Extrema_ExtAlgo_Tree);
+    };
+
+    GeomAdaptor_Surface adaptor_;
+    Extrema_GenLocateExtPS local_projector_;
+    GeomAPI_ProjectPointOnSurf global_projector_;
+};
+//=================================================================================================//
 Vecd SurfaceShape::findClosestPoint(const Vecd &input_pnt)
 {
+    int face_index = -1;
+    Vec2d parameters = Vec2d::Zero();
+    return findClosestPoint(input_pnt, face_index, parameters);
+}
+//=================================================================================================//
+Vecd SurfaceShape::findClosestPoint(const Vecd &input_pnt, int &face_index, Vec2d &parameters)
+{
+    gp_Pnt pnt = EigenToOcct(input_pnt);
+    Real distance = MaxReal;
+    if (face_index >= 0 && projectOnFaceLocally(*getFaceProjectors()[face_index], pnt, parameters))
+    {
+        distance = (getPointOnFace(face_index, parameters) - input_pnt).norm();
+    }
+    else
+    {
+        face_index = -1;
+    }
+    searchFaces(pnt, distance, face_index, parameters);
 
-    Vecd closest_pnt;
-    gp_Pnt point1 = EigenToOcct(input_pnt);
-    Extrema_ExtAlgo Algo = Extrema_ExtAlgo_Tree;
-    gp_Pnt point2 = GeomAPI_ProjectPointOnSurf(point1, surface_, Algo);
-    closest_pnt[0] = point2.X();
-    closest_pnt[1] = point2.Y();
-    closest_pnt[2] = point2.Z();
+    return face_index < 0 ? input_pnt : getPointOnFace(face_index, parameters);
+}
+//=================================================================================================//
+bool SurfaceShape::projectOnFaceLocally(SurfaceFaceProjector &projector, const gp_Pnt &pnt, Vec2d &parameters)
+{
+    projector.local_projector_.Perform(pnt, parameters[0], parameters[1]);
+    if (!projector.local_projector_.IsDone())
+    {
+        return false;
+    }
 
-    return closest_pnt;
+    Standard_Real u, v;
+    projector.local_projector_.Point().Parameter(u, v);
+    // a projection on the face boundary may belong to a neighboring face
+    const GeomAdaptor_Surface &adaptor = projector.adaptor_;
+    Real tolerance = Precision::PConfusion();
+    if (u - adaptor.FirstUParameter() < tolerance || adaptor.LastUParameter() - u < tolerance ||
+        v - adaptor.FirstVParameter() < tolerance || adaptor.LastVParameter() - v < tolerance)
+    {
+        return false;
+    }
+    parameters = Vec2d(u, v);
+    return true;
 }
+//=================================================================================================//
+Real SurfaceShape::searchFaces(const gp_Pnt &pnt, Real distance_bound, int &face_index, Vec2d &parameters)
+{
+    Vecd point = OcctToEigen(pnt);
+    StdVec<std::pair<Real, int>> candidates;
+    for (int k = 0; k != (int)faces_.size(); ++k)
+    {
+        const BoundingBox &bounds = faces_[k].bounds_;
+        Vecd outside = (bounds.first_ - point).cwiseMax(point - bounds.second_).cwiseMax(Vecd::Zero());
+        Real box_distance = outside.norm();
+        if (k != face_index && box_distance < distance_bound)
+        {
+            candidates.push_back(std::make_pair(box_distance, k));
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    StdVec<SharedPtr<SurfaceFaceProjector>> &projectors = getFaceProjectors();
+    for (const auto &candidate : candidates)
+    {
+        if (candidate.first >= distance_bound)
+        {
+            break;
+        }
 
+        GeomAPI_ProjectPointOnSurf &global_projector = projectors[candidate.second]->global_projector_;
+        global_projector.Perform(pnt);
+        if (global_projector.NbPoints() > 0 && global_projector.LowerDistance() < distance_bound)
+        {
+            Standard_Real u, v;
+            global_projector.LowerDistanceParameters(u, v);
+            distance_bound = global_projector.LowerDistance();
+            face_index = candidate.second;
+            parameters = Vec2d(u, v);
+        }
+    }
+    return distance_bound;
+}
+//=================================================================================================//
+StdVec<SharedPtr<SurfaceFaceProjector>> &SurfaceShape::getFaceProjectors()
+{
+    StdVec<SharedPtr<SurfaceFaceProjector>> &projectors = face_projectors_.local();
+    if (projectors.size() != faces_.size())
+    {
+        projectors.clear();
+        for (const SurfaceFace &face : faces_)
+        {
+            projectors.push_back(makeShared<SurfaceFaceProjector>(face));
+        }
+    }
+    return projectors;
+}
+//=================================================================================================//
+Vecd SurfaceShape::getPointOnFace(int face_index, const Vec2d &parameters)
+{
+    return OcctToEigen(faces_[face_index].surface_->Value(parameters[0], parameters[1]));
+}
+//=================================================================================================//
+Vecd SurfaceShape::findNormalDirection(int face_index, const Vec2d &parameters)
+{
+    gp_Pnt point;
+    gp_Vec tangent_u, tangent_v;
+    faces_[face_index].surface_->D1(parameters[0], parameters[1], point, tangent_u, tangent_v);
+    return OcctVecToEigen(tangent_u.Crossed(tangent_v)).normalized();
+}
+//=================================================================================================//
+void SurfaceShape::addFace(const TopoDS_Face &face)
+{
+    SurfaceFace surface_face;
+    surface_face.surface_ = BRep_Tool::Surface(face);
+    BRepTools::UVBounds(face, surface_face.u_min_, surface_face.u_max_, surface_face.v_min_, surface_face.v_max_);
+
+    Bnd_Box box;
+    BRepBndLib::Add(face, box);
+    Standard_Real x_min, y_min, z_min, x_max, y_max, z_max;
+    box.Get(x_min, y_min, z_min, x_max, y_max, z_max);
+    surface_face.bounds_ = BoundingBox(Vecd(x_min, y_min, z_min), Vecd(x_max, y_max, z_max));
+
+    faces_.push_back(surface_face);
+}
 ////=================================================================================================//
 bool SurfaceShape::checkContain(const Vecd &pnt, bool BOUNDARY_INCLUDED) { return 0; }
-BoundingBox SurfaceShape::findBounds() { return BoundingBox(); }
+//=================================================================================================//
+BoundingBox SurfaceShape::findBounds()
+{
+    if (faces_.empty())
+    {
+        return BoundingBox();
+    }
+
+    BoundingBox bounds = faces_[0].bounds_;
+    for (const SurfaceFace &face : faces_)
+    {
+        bounds.first_ = bounds.first_.cwiseMin(face.bounds_.first_);
+        bounds.second_ = bounds.second_.cwiseMax(face.bounds_.second_);
+    }
+    return bounds;
+}
 //=================================================================================================//
 
 Vecd SurfaceShape::getCartesianPoint(Standard_Real u, Standard_Real v)
@@ -61,10 +210,17 @@ SurfaceShapeSTEP::
     for (Standard_Integer i = 1; i <= step_reader.NbShapes(); i++)
         step_shape = step_reader.Shape(i);
 
-    TopExp_Explorer explorer(step_shape, TopAbs_FACE);
-    TopoDS_Face face = TopoDS::Face(explorer.Current());
-    surface_ = BRep_Tool::Surface(face);
-}
-
-	//=================================================================================================//
+    for (TopExp_Explorer explorer(step_shape, TopAbs_FACE); explorer.More(); explorer.Next())
+    {
+        addFace(TopoDS::Face(explorer.Current()));
+    }
+    if (faces_.empty())
+    {
+        std::cout << "\n Error: the input file:" << filepathname << " has no face" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        throw;
+    }
+    surface_ = faces_[0].surface_;
 }
+//=================================================================================================//
+} // namespace SPH
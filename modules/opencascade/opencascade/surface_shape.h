@@ -28,6 +28,9 @@
 
 #include <opencascade/Standard_TypeDef.hxx>
 #include <opencascade/Geom_Surface.hxx>
+#include <opencascade/TopoDS_Face.hxx>
+
+#include "tbb/enumerable_thread_specific.h"
 
 #include <iostream>
 #include <string>
@@ -37,31 +40,56 @@ namespace fs = std::filesystem;
 
 namespace SPH
 {
-	class SurfaceShape : public Shape
-        {
-              public:
-                explicit SurfaceShape(const std::string &shape_name)
-                    : Shape(shape_name){};
-                virtual bool checkContain(const Vecd &pnt, bool BOUNDARY_INCLUDED = true) override;
-                virtual Vecd findClosestPoint(const Vecd &input_pnt) override;
-                Vecd getCartesianPoint(Standard_Real u, Standard_Real v);
-              
-                Handle_Geom_Surface surface_;
-              protected:
-                virtual BoundingBox findBounds() override;   
-        };
+/** A face of the surface with its parameter range and spatial bounds. */
+struct SurfaceFace
+{
+    Handle_Geom_Surface surface_;
+    Standard_Real u_min_, u_max_, v_min_, v_max_;
+    BoundingBox bounds_;
+};
+
+/** Initialized projection structures of a face, which are not re-entrant and kept for each thread. */
+class SurfaceFaceProjector;
+
+class SurfaceShape : public Shape
+{
+  public:
+    explicit SurfaceShape(const std::string &shape_name)
+        : Shape(shape_name){};
+    virtual ~SurfaceShape(){};
+    virtual bool checkContain(const Vecd &pnt, bool BOUNDARY_INCLUDED = true) override;
+    virtual Vecd findClosestPoint(const Vecd &input_pnt) override;
+    /** Find the closest point warm-started from the face index and the (u,v) parameters of
+     * the last projection, which are updated. A negative face index starts a full search. */
+    Vecd findClosestPoint(const Vecd &input_pnt, int &face_index, Vec2d &parameters);
+    Vecd getPointOnFace(int face_index, const Vec2d &parameters);
+    Vecd findNormalDirection(int face_index, const Vec2d &parameters);
+    Vecd getCartesianPoint(Standard_Real u, Standard_Real v);
+    size_t NumberOfFaces() { return faces_.size(); };
 
-        class SurfaceShapeSTEP : public SurfaceShape
-        {
-               
-              public:
-                // constructor for load STEP file from out side
-                explicit SurfaceShapeSTEP(Standard_CString &filepathname,
-                                          const std::string &shape_name = "SurfaceShapeSTEP");
-                virtual ~SurfaceShapeSTEP(){};
-               
-        };
-	
-}
+    Handle_Geom_Surface surface_; /**< surface of the first face */
+
+  protected:
+    StdVec<SurfaceFace> faces_;
+    tbb::enumerable_thread_specific<StdVec<SharedPtr<SurfaceFaceProjector>>> face_projectors_;
+
+    void addFace(const TopoDS_Face &face);
+    StdVec<SharedPtr<SurfaceFaceProjector>> &getFaceProjectors();
+    bool projectOnFaceLocally(SurfaceFaceProjector &projector, const gp_Pnt &pnt, Vec2d &parameters);
+    /** Global search on the faces, pre-selected by their bounding boxes, closer than the distance bound,
+     * except the face given by the face index. Returns the updated distance bound. */
+    Real searchFaces(const gp_Pnt &pnt, Real distance_bound, int &face_index, Vec2d &parameters);
+    virtual BoundingBox findBounds() override;
+};
+
+class SurfaceShapeSTEP : public SurfaceShape
+{
+  public:
+    // constructor for load STEP file from out side, all faces of the STEP shape are used
+    explicit SurfaceShapeSTEP(Standard_CString &filepathname,
+                              const std::string &shape_name = "SurfaceShapeSTEP");
+    virtual ~SurfaceShapeSTEP(){};
+};
+} // namespace SPH
 
-#endif //SURFACE_SHAPE_H
+#endif // SURFACE_SHAPE_H
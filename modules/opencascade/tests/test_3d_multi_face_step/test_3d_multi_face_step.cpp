@@ -0,0 +1,125 @@
+/**
+ * @file 	test_3d_multi_face_step.cpp
+ * @brief 	Test of the projection on a STEP surface with several faces and of the surface relaxation on it.
+ * @details	The surface is an open shell of two square faces folded at a right angle along the line x = 10, z = 0.
+ */
+#include "relax_dynamics_surface.h"
+#include "sphinxsys.h" // SPHinXsys Library.
+#include "surface_shape.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Set the file path to the data file.
+//----------------------------------------------------------------------
+Standard_CString full_path_to_geometry = "./input/bent_sheet.STEP";
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real sheet_length = 10.0;
+Real particle_spacing_ref = 1.0;
+Real thickness = 1.0;
+BoundingBox system_domain_bounds(Vec3d(-2.0, -2.0, -2.0), Vec3d(12.0, 12.0, 12.0));
+
+namespace SPH
+{
+class BentSheet;
+template <>
+class ParticleGenerator<SurfaceParticles, BentSheet> : public ParticleGenerator<SurfaceParticles>
+{
+  public:
+    explicit ParticleGenerator(SPHBody &sph_body, SurfaceParticles &surface_particles)
+        : ParticleGenerator<SurfaceParticles>(sph_body, surface_particles){};
+    virtual void prepareGeometricData() override
+    {
+        // particles slightly off both faces, to be projected back by the surface bounding
+        int particle_number = int(sheet_length / particle_spacing_ref);
+        for (int i = 0; i < particle_number; i++)
+        {
+            for (int j = 0; j < particle_number; j++)
+            {
+                Real s = (i + 0.5) * particle_spacing_ref;
+                Real t = (j + 0.5) * particle_spacing_ref;
+                Real offset = 0.1 * particle_spacing_ref * ((i + j) % 2 == 0 ? 1.0 : -1.0);
+                addPositionAndVolumetricMeasure(Vec3d(s, t, offset), particle_spacing_ref * particle_spacing_ref);
+                addSurfaceProperties(Vec3d(0.0, 0.0, 1.0), thickness);
+                addPositionAndVolumetricMeasure(Vec3d(sheet_length + offset, t, s), particle_spacing_ref * particle_spacing_ref);
+                addSurfaceProperties(Vec3d(1.0, 0.0, 0.0), thickness);
+            }
+        }
+    }
+};
+} // namespace SPH
+
+Real distanceToSheet(const Vec3d &position)
+{
+    return SMIN(ABS(position[2]), ABS(position[0] - sheet_length));
+}
+
+TEST(SurfaceShapeSTEP, ProjectionOnMultipleFaces)
+{
+    SurfaceShapeSTEP bent_sheet(full_path_to_geometry, "BentSheet");
+    ASSERT_EQ(bent_sheet.NumberOfFaces(), 2);
+
+    BoundingBox bounds = bent_sheet.getBounds();
+    for (int k = 0; k != 3; ++k)
+    {
+        EXPECT_NEAR(bounds.first_[k], 0.0, 1.0e-3);
+        EXPECT_NEAR(bounds.second_[k], sheet_length, 1.0e-3);
+    }
+
+    EXPECT_LT((bent_sheet.findClosestPoint(Vec3d(5.0, 5.0, 1.0)) - Vec3d(5.0, 5.0, 0.0)).norm(), 1.0e-6);
+    EXPECT_LT((bent_sheet.findClosestPoint(Vec3d(11.0, 5.0, 5.0)) - Vec3d(10.0, 5.0, 5.0)).norm(), 1.0e-6);
+    // closer to the second face, although inside the bounding box of the first one
+    EXPECT_LT((bent_sheet.findClosestPoint(Vec3d(9.0, 5.0, 6.0)) - Vec3d(10.0, 5.0, 6.0)).norm(), 1.0e-6);
+
+    // warm start from the last projection, also when the point moves to the other face
+    int face_index = -1;
+    Vec2d parameters = Vec2d::Zero();
+    Vec3d projected = bent_sheet.findClosestPoint(Vec3d(2.0, 3.0, 0.5), face_index, parameters);
+    EXPECT_LT((projected - Vec3d(2.0, 3.0, 0.0)).norm(), 1.0e-6);
+    int first_face_index = face_index;
+    projected = bent_sheet.findClosestPoint(Vec3d(2.5, 3.5, -0.5), face_index, parameters);
+    EXPECT_LT((projected - Vec3d(2.5, 3.5, 0.0)).norm(), 1.0e-6);
+    EXPECT_EQ(face_index, first_face_index);
+    projected = bent_sheet.findClosestPoint(Vec3d(12.0, 3.0, 4.0), face_index, parameters);
+    EXPECT_LT((projected - Vec3d(10.0, 3.0, 4.0)).norm(), 1.0e-6);
+    EXPECT_NE(face_index, first_face_index);
+}
+
+TEST(SurfaceShapeSTEP, RelaxationOnMultipleFaces)
+{
+    SPHSystem sph_system(system_domain_bounds, particle_spacing_ref);
+    SolidBody bent_sheet(sph_system, makeShared<SurfaceShapeSTEP>(full_path_to_geometry, "BentSheet"));
+    bent_sheet.defineMaterial<Solid>();
+    bent_sheet.generateParticles<SurfaceParticles, BentSheet>();
+    InnerRelation bent_sheet_inner(bent_sheet);
+
+    using namespace relax_dynamics;
+    RelaxationStepInnerFirstHalf relaxation_first_half(bent_sheet_inner);
+    RelaxationStepInnerSecondHalf relaxation_second_half(bent_sheet_inner);
+    SimpleDynamics<SurfaceNormalDirection> surface_normal_direction(bent_sheet);
+
+    relaxation_second_half.SurfaceBounding().exec();
+    for (int ite = 0; ite < 100; ite++)
+    {
+        relaxation_first_half.exec();
+        relaxation_second_half.exec();
+    }
+    surface_normal_direction.exec();
+
+    BaseParticles &particles = bent_sheet.getBaseParticles();
+    Vec3d *pos = particles.ParticlePositions();
+    Vec3d *n = particles.getVariableDataByName<Vec3d>("NormalDirection");
+    for (size_t index_i = 0; index_i < particles.TotalRealParticles(); index_i++)
+    {
+        EXPECT_LT(distanceToSheet(pos[index_i]), 1.0e-6);
+        EXPECT_NEAR(n[index_i].norm(), 1.0, 1.0e-6);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -8,6 +8,23 @@
 
 #include "structural_simulation_class.h"
 
+#include "tbb/task_arena.h"
+#include "tbb/task_group.h"
+
+#include <fstream>
+#include <mutex>
+
+namespace SPH
+{
+void ParticleGenerator<BaseParticles, PreprocessedParticles>::prepareGeometricData()
+{
+    for (size_t i = 0; i < preprocessed_particles_.pos_0_.size(); ++i)
+    {
+        addPositionAndVolumetricMeasure(preprocessed_particles_.pos_0_[i], preprocessed_particles_.volume_[i]);
+    }
+}
+} // namespace SPH
+
 ////////////////////////////////////////////////////
 /* global functions in StructuralSimulation  */
 ////////////////////////////////////////////////////
@@ -22,19 +39,26 @@ BodyPartFromMesh::BodyPartFromMesh(SPHBody &body, SharedPtr<TriangleMeshShape> t
 
 SolidBodyFromMesh::SolidBodyFromMesh(
     SPHSystem &system, SharedPtr<TriangleMeshShape> triangle_mesh_shape, Real resolution,
-    SharedPtr<SaintVenantKirchhoffSolid> material_model, Vecd *pos_0, Real *volume)
+    SharedPtr<SaintVenantKirchhoffSolid> material_model, const PreprocessedParticles &preprocessed_particles)
     : SolidBody(system, triangle_mesh_shape)
 {
     defineAdaptationRatios(1.15, system.resolution_ref_ / resolution);
     defineBodyLevelSetShape()->cleanLevelSet();
     assignMaterial(material_model.get());
-    generateParticles<BaseParticles, Lattice>();
+    if (preprocessed_particles.pos_0_.empty())
+    {
+        generateParticles<BaseParticles, Lattice>();
+    }
+    else
+    {
+        generateParticles<BaseParticles, PreprocessedParticles>(preprocessed_particles);
+    }
 }
 
 SolidBodyForSimulation::SolidBodyForSimulation(
     SPHSystem &system, SharedPtr<TriangleMeshShape> triangle_mesh_shape, Real resolution,
-    Real physical_viscosity, SharedPtr<SaintVenantKirchhoffSolid> material_model, Vecd *pos_0, Real *volume)
-    : solid_body_from_mesh_(system, triangle_mesh_shape, resolution, material_model, pos_0, volume),
+    Real physical_viscosity, SharedPtr<SaintVenantKirchhoffSolid> material_model, const PreprocessedParticles &preprocessed_particles)
+    : solid_body_from_mesh_(system, triangle_mesh_shape, resolution, material_model, preprocessed_particles),
       inner_body_relation_(solid_body_from_mesh_),
       initial_normal_direction_(SimpleDynamics<NormalDirectionFromBodyShape>(solid_body_from_mesh_)),
       correct_configuration_(inner_body_relation_),
@@ -61,6 +85,18 @@ void expandBoundingBox(BoundingBox *original, BoundingBox *additional)
     }
 }
 
+bool checkBoundingBoxOverlap(const BoundingBox &first, const BoundingBox &second)
+{
+    for (int i = 0; i < first.first_.size(); i++)
+    {
+        if (first.second_[i] < second.first_[i] || second.second_[i] < first.first_[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 void relaxParticlesSingleResolution(bool write_particle_relaxation_data,
                                     SolidBody &solid_body_from_mesh,
                                     InnerRelation &solid_body_from_mesh_inner)
@@ -76,7 +112,7 @@ void relaxParticlesSingleResolution(bool write_particle_relaxation_data,
     //----------------------------------------------------------------------
     //	Particle relaxation starts here.
     //----------------------------------------------------------------------
-    random_solid_body_from_mesh_particles.exec(0.25);
+    random_solid_body_from_mesh_particles.exec(particle_randomization_factor);
     relaxation_step_inner.SurfaceBounding().exec();
     if (write_particle_relaxation_data)
     {
@@ -87,7 +123,7 @@ void relaxParticlesSingleResolution(bool write_particle_relaxation_data,
     //	Particle relaxation time stepping start here.
     //----------------------------------------------------------------------
     int ite_p = 0;
-    while (ite_p < 1000)
+    while (ite_p < particle_relaxation_steps)
     {
         relaxation_step_inner.exec();
         ite_p += 1;
@@ -103,24 +139,109 @@ void relaxParticlesSingleResolution(bool write_particle_relaxation_data,
     std::cout << "The physics relaxation process of the imported model finished !" << std::endl;
 }
 
-std::tuple<Vecd *, Real *> generateAndRelaxParticlesFromMesh(
-    SharedPtr<TriangleMeshShape> triangle_mesh_shape, Real resolution, bool particle_relaxation, bool write_particle_relaxation_data)
+void generateAndRelaxParticlesFromMesh(SharedPtr<TriangleMeshShape> triangle_mesh_shape, Real resolution,
+                                       bool write_particle_relaxation_data, PreprocessedParticles &relaxed_particles)
 {
+    // the bodies are preprocessed concurrently, but they share the input and output folders
+    static std::mutex io_environment_mutex;
+
     BoundingBox bb = triangle_mesh_shape->getBounds();
     SPHSystem system(bb, resolution);
+    {
+        std::lock_guard<std::mutex> lock(io_environment_mutex);
+        system.setIOEnvironment(false);
+    }
     SolidBody model(system, triangle_mesh_shape);
     model.defineBodyLevelSetShape()->cleanLevelSet();
     model.defineMaterial<Solid>();
     model.generateParticles<BaseParticles, Lattice>();
 
-    if (particle_relaxation)
+    InnerRelation inner_relation(model);
+    relaxParticlesSingleResolution(write_particle_relaxation_data, model, inner_relation);
+
+    // copy the relaxed particles, as the system and the body are temporary
+    BaseParticles &particles = model.getBaseParticles();
+    size_t total_real_particles = particles.TotalRealParticles();
+    Vecd *pos = particles.ParticlePositions();
+    Real *Vol = particles.VolumetricMeasures();
+    relaxed_particles.pos_0_.assign(pos, pos + total_real_particles);
+    relaxed_particles.volume_.assign(Vol, Vol + total_real_particles);
+}
+
+uint64_t hashParticleCacheKey(TriangleMeshShape &triangle_mesh_shape, Real resolution)
+{
+    uint64_t seed = std::hash<Real>{}(resolution);
+    auto hash_combine = [&](uint64_t value)
+    { seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2); };
+    hash_combine(std::hash<int>{}(particle_relaxation_steps));
+    hash_combine(std::hash<Real>{}(particle_randomization_factor));
+
+    SimTK::ContactGeometry::TriangleMesh *triangle_mesh = triangle_mesh_shape.getTriangleMesh();
+    for (int i = 0; i < triangle_mesh->getNumVertices(); i++)
+    {
+        const SimTK::Vec3 &vertex = triangle_mesh->getVertexPosition(i);
+        for (int k = 0; k < 3; k++)
+        {
+            hash_combine(std::hash<Real>{}(vertex[k]));
+        }
+    }
+    for (int i = 0; i < triangle_mesh->getNumFaces(); i++)
+    {
+        for (int k = 0; k < 3; k++)
+        {
+            hash_combine(std::hash<int>{}(triangle_mesh->getFaceVertex(i, k)));
+        }
+    }
+    return seed;
+}
+
+bool readParticleCache(const std::string &file_path, uint64_t cache_key, PreprocessedParticles &cached_particles)
+{
+    std::ifstream in_file(file_path, std::ios::binary);
+    if (!in_file.is_open())
+    {
+        return false;
+    }
+
+    uint32_t header[3] = {0, 0, 0};
+    uint64_t key = 0;
+    in_file.read(reinterpret_cast<char *>(header), sizeof(header));
+    in_file.read(reinterpret_cast<char *>(&key), sizeof(uint64_t));
+    if (!in_file || header[0] != particle_cache_format_version || header[1] != sizeof(Real) ||
+        header[2] != sizeof(Vecd) || key != cache_key)
+    {
+        std::cout << "\n Particle cache " << file_path << " does not match the format, "
+                  << "precision or relaxation parameters and will be regenerated." << std::endl;
+        return false;
+    }
+
+    size_t total_particles = 0;
+    in_file.read(reinterpret_cast<char *>(&total_particles), sizeof(size_t));
+    cached_particles.pos_0_.resize(total_particles);
+    cached_particles.volume_.resize(total_particles);
+    in_file.read(reinterpret_cast<char *>(cached_particles.pos_0_.data()), total_particles * sizeof(Vecd));
+    in_file.read(reinterpret_cast<char *>(cached_particles.volume_.data()), total_particles * sizeof(Real));
+
+    if (!in_file || total_particles == 0)
     {
-        system.setIOEnvironment();
-        InnerRelation inner_relation(model);
-        relaxParticlesSingleResolution(write_particle_relaxation_data, model, inner_relation);
+        std::cout << "\n Particle cache " << file_path << " is corrupted and will be regenerated." << std::endl;
+        cached_particles.pos_0_.clear();
+        cached_particles.volume_.clear();
+        return false;
     }
+    return true;
+}
 
-    return std::tuple<Vecd *, Real *>(model.getBaseParticles().ParticlePositions(), model.getBaseParticles().VolumetricMeasures());
+void writeParticleCache(const std::string &file_path, uint64_t cache_key, const PreprocessedParticles &cached_particles)
+{
+    std::ofstream out_file(file_path, std::ios::binary | std::ios::trunc);
+    uint32_t header[3] = {particle_cache_format_version, uint32_t(sizeof(Real)), uint32_t(sizeof(Vecd))};
+    out_file.write(reinterpret_cast<const char *>(header), sizeof(header));
+    out_file.write(reinterpret_cast<const char *>(&cache_key), sizeof(uint64_t));
+    size_t total_particles = cached_particles.pos_0_.size();
+    out_file.write(reinterpret_cast<const char *>(&total_particles), sizeof(size_t));
+    out_file.write(reinterpret_cast<const char *>(cached_particles.pos_0_.data()), total_particles * sizeof(Vecd));
+    out_file.write(reinterpret_cast<const char *>(cached_particles.volume_.data()), total_particles * sizeof(Real));
 }
 
 BodyPartByParticle *createBodyPartFromMesh(SPHBody &body, const StlList &stl_list, size_t body_index, SharedPtr<TriangleMeshShape> tmesh)
@@ -152,6 +273,7 @@ StructuralSimulationInput::StructuralSimulationInput(
       physical_viscosity_(physical_viscosity),
       contacting_body_pairs_list_(contacting_bodies_list),
       time_dep_contacting_body_pairs_list_({}),
+      all_bodies_may_contact_(false),
       particle_relaxation_list_({})
 {
     for (size_t i = 0; i < resolution_list_.size(); i++)
@@ -159,6 +281,8 @@ StructuralSimulationInput::StructuralSimulationInput(
         particle_relaxation_list_.push_back(true);
     }
     write_particle_relaxation_data_ = false;
+    use_relaxed_particles_ = false;
+    particle_cache_path_ = "";
     // scale system boundaries
     scale_system_boundaries_ = 1;
     // boundary conditions
@@ -191,10 +315,13 @@ StructuralSimulation::StructuralSimulation(const StructuralSimulationInput &inpu
       physical_viscosity_(input.physical_viscosity_),
       contacting_body_pairs_list_(input.contacting_body_pairs_list_),
       time_dep_contacting_body_pairs_list_(input.time_dep_contacting_body_pairs_list_),
+      all_bodies_may_contact_(input.all_bodies_may_contact_),
 
       // default system, optional: particle relaxation, scale_system_boundaries
       particle_relaxation_list_(input.particle_relaxation_list_),
       write_particle_relaxation_data_(input.write_particle_relaxation_data_),
+      use_relaxed_particles_(input.use_relaxed_particles_),
+      particle_cache_path_(input.particle_cache_path_),
       system_resolution_(0.0),
       system_(SPHSystem(BoundingBox(Vec3d::Zero(), Vec3d::Zero()), system_resolution_)),
       scale_system_boundaries_(input.scale_system_boundaries_),
@@ -227,10 +354,13 @@ StructuralSimulation::StructuralSimulation(const StructuralSimulationInput &inpu
     // set up the system
     calculateSystemBoundaries();
     system_.setRunParticleRelaxation(true);
+    // level set and particle relaxation of the independent bodies
+    preprocessBodyParticles();
     // initialize solid bodies with their properties
     initializeElasticSolidBodies();
     // contacts
     initializeAllContacts();
+    initializeContactBroadPhase();
     // boundary conditions
     initializeGravity();
     initializeExternalForceInBoundingBox();
@@ -299,15 +429,115 @@ void StructuralSimulation::calculateSystemBoundaries()
 
 void StructuralSimulation::createBodyMeshList()
 {
-    body_mesh_list_ = {};
-    for (size_t i = 0; i < imported_stl_list_.size(); i++)
-    {
-        std::string relative_input_path_copy = relative_input_path_;
+    // the STL files of the bodies are independent and imported concurrently
+    body_mesh_list_.resize(imported_stl_list_.size());
+    parallel_for(
+        IndexRange(0, imported_stl_list_.size(), 1),
+        [&](const IndexRange &r)
+        {
+            for (size_t i = r.begin(); i != r.end(); ++i)
+            {
+                std::string relative_input_path_copy = relative_input_path_;
 #ifdef __EMSCRIPTEN__
-        body_mesh_list_.push_back(makeShared<TriangleMeshShapeSTL>(reinterpret_cast<const uint8_t *>(imported_stl_list_[i].ptr), translation_list_[i], scale_stl_, imported_stl_list_[i].name));
+                body_mesh_list_[i] = makeShared<TriangleMeshShapeSTL>(reinterpret_cast<const uint8_t *>(imported_stl_list_[i].ptr), translation_list_[i], scale_stl_, imported_stl_list_[i].name);
 #else
-        body_mesh_list_.push_back(makeShared<TriangleMeshShapeSTL>(relative_input_path_copy.append(imported_stl_list_[i]), translation_list_[i], scale_stl_, imported_stl_list_[i]));
+                body_mesh_list_[i] = makeShared<TriangleMeshShapeSTL>(relative_input_path_copy.append(imported_stl_list_[i]), translation_list_[i], scale_stl_, imported_stl_list_[i]);
 #endif
+            }
+        },
+        tbb::auto_partitioner());
+}
+
+void StructuralSimulation::preprocessBodyParticles()
+{
+    preprocessed_particles_list_ = StdVec<PreprocessedParticles>(body_mesh_list_.size());
+
+    // without relaxed particles, the bodies are created from lattice particles
+    if (!use_relaxed_particles_)
+    {
+        return;
+    }
+
+    // check the particle cache and find the bodies still to be relaxed
+    StdVec<std::string> cache_file_list(body_mesh_list_.size(), "");
+    StdVec<uint64_t> cache_key_list(body_mesh_list_.size(), 0);
+    IndexVector bodies_to_relax;
+    for (size_t i = 0; i < body_mesh_list_.size(); i++)
+    {
+        if (!particle_relaxation_list_[i])
+        {
+            continue;
+        }
+        if (!particle_cache_path_.empty())
+        {
+            if (!fs::exists(particle_cache_path_))
+            {
+                fs::create_directories(particle_cache_path_);
+            }
+            cache_key_list[i] = hashParticleCacheKey(*body_mesh_list_[i], resolution_list_[i]);
+            std::stringstream cache_file_name;
+            cache_file_name << body_mesh_list_[i]->getName() << "_" << std::hex << cache_key_list[i] << ".dat";
+            cache_file_list[i] = (fs::path(particle_cache_path_) / cache_file_name.str()).string();
+            if (readParticleCache(cache_file_list[i], cache_key_list[i], preprocessed_particles_list_[i]))
+            {
+                std::cout << "\n Relaxed particles of " << body_mesh_list_[i]->getName()
+                          << " are reloaded from the particle cache." << std::endl;
+                continue;
+            }
+        }
+        bodies_to_relax.push_back(i);
+    }
+    if (bodies_to_relax.empty())
+    {
+        return;
+    }
+
+    // each body is relaxed in its own task arena, the threads are shared out by the estimated particle numbers
+    StdVec<Real> estimated_particles;
+    Real total_estimated_particles = 0.0;
+    for (size_t i : bodies_to_relax)
+    {
+        BoundingBox bounds = body_mesh_list_[i]->getBounds();
+        Vecd extent = bounds.second_ - bounds.first_;
+        estimated_particles.push_back(extent.prod() / pow(resolution_list_[i], Dimensions));
+        total_estimated_particles += estimated_particles.back();
+    }
+    int total_threads = tbb::this_task_arena::max_concurrency();
+    StdVec<UniquePtr<tbb::task_arena>> body_arenas;
+    StdVec<UniquePtr<tbb::task_group>> body_task_groups;
+    for (size_t k = 0; k != bodies_to_relax.size(); ++k)
+    {
+        int body_threads = SMAX(1, int(std::round(total_threads * estimated_particles[k] / (total_estimated_particles + TinyReal))));
+        body_arenas.push_back(makeUnique<tbb::task_arena>(body_threads, 0));
+        body_task_groups.push_back(makeUnique<tbb::task_group>());
+    }
+
+    for (size_t k = 0; k != bodies_to_relax.size(); ++k)
+    {
+        size_t i = bodies_to_relax[k];
+        body_arenas[k]->execute(
+            [&, i, k]()
+            {
+                body_task_groups[k]->run(
+                    [&, i]()
+                    {
+                        generateAndRelaxParticlesFromMesh(body_mesh_list_[i], resolution_list_[i],
+                                                          write_particle_relaxation_data_, preprocessed_particles_list_[i]);
+                    });
+            });
+    }
+    for (size_t k = 0; k != bodies_to_relax.size(); ++k)
+    {
+        body_arenas[k]->execute([&, k]()
+                                { body_task_groups[k]->wait(); });
+    }
+
+    for (size_t i : bodies_to_relax)
+    {
+        if (!cache_file_list[i].empty())
+        {
+            writeParticleCache(cache_file_list[i], cache_key_list[i], preprocessed_particles_list_[i]);
+        }
     }
 }
 
@@ -317,25 +547,9 @@ void StructuralSimulation::initializeElasticSolidBodies()
     particle_normal_update_ = {};
     for (size_t i = 0; i < body_mesh_list_.size(); i++)
     {
-        std::string temp_name = "";
-#ifdef __EMSCRIPTEN__
-        temp_name.append(imported_stl_list_[i].name);
-#else  // __EMSCRIPTEN__
-        temp_name.append(imported_stl_list_[i]);
-#endif // __EMSCRIPTEN__
-       // we delete the .stl ending
-        temp_name.erase(temp_name.size() - 4);
-        // create the initial particles from the triangle mesh shape with particle relaxation option
-        std::tuple<Vecd *, Real *> particles =
-            generateAndRelaxParticlesFromMesh(body_mesh_list_[i], resolution_list_[i], particle_relaxation_list_[i], write_particle_relaxation_data_);
-
-        // get the particles' initial position and their volume
-        Vecd *pos_0 = std::get<0>(particles);
-        Real *volume = std::get<1>(particles);
-
-        // create the SolidBodyForSimulation
+        // create the SolidBodyForSimulation with the relaxed particles, if any
         solid_body_list_.emplace_back(makeShared<SolidBodyForSimulation>(
-            system_, body_mesh_list_[i], resolution_list_[i], physical_viscosity_[i], material_model_list_[i], pos_0, volume));
+            system_, body_mesh_list_[i], resolution_list_[i], physical_viscosity_[i], material_model_list_[i], preprocessed_particles_list_[i]));
 
         // update normal direction of particles
         particle_normal_update_.emplace_back(makeShared<SimpleDynamics<solid_dynamics::UpdateElasticNormalDirection>>(*solid_body_list_[i]->getSolidBodyFromMesh()));
@@ -363,6 +577,23 @@ void StructuralSimulation::initializeAllContacts()
     contact_list_ = {};
     contact_density_list_ = {};
     contact_force_list_ = {};
+    // all the other bodies become the contact targets of each body
+    if (all_bodies_may_contact_)
+    {
+        contacting_body_pairs_list_ = {};
+        for (size_t i = 0; i < solid_body_list_.size(); i++)
+        {
+            IndexVector target_indices = {};
+            for (size_t j = 0; j < solid_body_list_.size(); j++)
+            {
+                if (j != i)
+                {
+                    target_indices.push_back(j);
+                }
+            }
+            contacting_body_pairs_list_.push_back(target_indices);
+        }
+    }
     // first place all the regular contacts into the lists
     for (size_t i = 0; i < contacting_body_pairs_list_.size(); i++)
     {
@@ -388,6 +619,23 @@ void StructuralSimulation::initializeAllContacts()
     }
 }
 
+void StructuralSimulation::initializeContactBroadPhase()
+{
+    position_lower_bound_ = {};
+    position_upper_bound_ = {};
+    for (size_t i = 0; i < solid_body_list_.size(); i++)
+    {
+        SolidBodyFromMesh *solid_body = solid_body_list_[i]->getSolidBodyFromMesh();
+        position_lower_bound_.emplace_back(makeShared<ReduceDynamics<PositionLowerBound>>(*solid_body));
+        position_upper_bound_.emplace_back(makeShared<ReduceDynamics<PositionUpperBound>>(*solid_body));
+    }
+    body_bounds_ = StdVec<BoundingBox>(solid_body_list_.size());
+    broad_phase_overlaps_ = StdVec<IndexVector>(solid_body_list_.size());
+    // the general contacts are active until the first broad phase
+    is_contact_active_ = StdVec<bool>(contacting_body_pairs_list_.size(), true);
+    was_contact_active_ = StdVec<bool>(contacting_body_pairs_list_.size(), true);
+}
+
 void StructuralSimulation::initializeGravity()
 {
     // collect all the body indices with non-zero gravity
@@ -667,7 +915,11 @@ void StructuralSimulation::executeContactFactorSummation()
     {
         if (i < number_of_general_contacts)
         {
-            contact_density_list_[i]->exec();
+            // a just deactivated contact is executed once more to release its contact force
+            if (is_contact_active_[i] || was_contact_active_[i])
+            {
+                contact_density_list_[i]->exec();
+            }
         }
         else
         {
@@ -692,7 +944,11 @@ void StructuralSimulation::executeContactForce()
     {
         if (i < number_of_general_contacts)
         {
-            contact_force_list_[i]->exec();
+            // a just deactivated contact is executed once more to release its contact force
+            if (is_contact_active_[i] || was_contact_active_[i])
+            {
+                contact_force_list_[i]->exec();
+            }
         }
         else
         {
@@ -789,6 +1045,56 @@ void StructuralSimulation::executeUpdateCellLinkedList()
     }
 }
 
+void StructuralSimulation::executeContactBroadPhase()
+{
+    // refit the bounding boxes of the bodies, enlarged by the cut-off radius
+    for (size_t i = 0; i < solid_body_list_.size(); i++)
+    {
+        Real margin = solid_body_list_[i]->getSolidBodyFromMesh()->sph_adaptation_->getKernel()->CutOffRadius();
+        body_bounds_[i].first_ = position_lower_bound_[i]->exec() - margin * Vecd::Ones();
+        body_bounds_[i].second_ = position_upper_bound_[i]->exec() + margin * Vecd::Ones();
+        broad_phase_overlaps_[i].clear();
+    }
+    // sweep and prune along the x axis
+    IndexVector sorted_bodies(solid_body_list_.size());
+    std::iota(sorted_bodies.begin(), sorted_bodies.end(), 0);
+    std::sort(sorted_bodies.begin(), sorted_bodies.end(),
+              [&](size_t a, size_t b)
+              { return body_bounds_[a].first_[0] < body_bounds_[b].first_[0]; });
+    IndexVector sweeping_bodies = {};
+    for (size_t body : sorted_bodies)
+    {
+        // prune the bodies ending before the current body starts
+        sweeping_bodies.erase(
+            std::remove_if(sweeping_bodies.begin(), sweeping_bodies.end(),
+                           [&](size_t other)
+                           { return body_bounds_[other].second_[0] < body_bounds_[body].first_[0]; }),
+            sweeping_bodies.end());
+        for (size_t other : sweeping_bodies)
+        {
+            if (checkBoundingBoxOverlap(body_bounds_[body], body_bounds_[other]))
+            {
+                broad_phase_overlaps_[body].push_back(other);
+                broad_phase_overlaps_[other].push_back(body);
+            }
+        }
+        sweeping_bodies.push_back(body);
+    }
+    // only the contact bodies overlapping with the body are searched in the narrow phase
+    for (size_t i = 0; i < contacting_body_pairs_list_.size(); i++)
+    {
+        IndexVector &overlaps = broad_phase_overlaps_[i];
+        was_contact_active_[i] = is_contact_active_[i];
+        is_contact_active_[i] = false;
+        for (size_t k = 0; k < contacting_body_pairs_list_[i].size(); k++)
+        {
+            bool is_active = std::find(overlaps.begin(), overlaps.end(), contacting_body_pairs_list_[i][k]) != overlaps.end();
+            contact_list_[i]->setContactActive(k, is_active);
+            is_contact_active_[i] = is_contact_active_[i] || is_active;
+        }
+    }
+}
+
 void StructuralSimulation::executeContactUpdateConfiguration()
 {
     // number of contacts that are not time dependent: contact pairs * 2
@@ -798,7 +1104,10 @@ void StructuralSimulation::executeContactUpdateConfiguration()
         // general contacts = contacting_bodies * 2
         if (i < number_of_general_contacts)
         {
-            contact_list_[i]->updateConfiguration();
+            if (is_contact_active_[i] || was_contact_active_[i])
+            {
+                contact_list_[i]->updateConfiguration();
+            }
         }
         // time dependent contacts = time dep. contacting_bodies * 2
         else
@@ -822,6 +1131,7 @@ void StructuralSimulation::initializeSimulation()
 
     /** INITIALIZE SYSTEM */
     system_.initializeSystemCellLinkedLists();
+    executeContactBroadPhase();
     system_.initializeSystemConfigurations();
 
     /** INITIAL CONDITION */
@@ -881,6 +1191,7 @@ void StructuralSimulation::runSimulationStep(Real &dt, Real &integration_time)
     executeUpdateCellLinkedList();
 
     /** UPDATE CONTACT CONFIGURATION */
+    executeContactBroadPhase();
     executeContactUpdateConfiguration();
 }
 
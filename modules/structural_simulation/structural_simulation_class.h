@@ -69,6 +69,32 @@ using StlList = StdVec<StlData>;
 using StlList = StdVec<std::string>;
 #endif
 
+/**
+ * @brief Particle positions and volumes of a body prepared, e.g. by particle relaxation,
+ * before the body is created in the simulation system. Empty if no preprocessing is done.
+ */
+struct PreprocessedParticles
+{
+    StdLargeVec<Vecd> pos_0_;
+    StdLargeVec<Real> volume_;
+};
+
+namespace SPH
+{
+template <> // generate particles from preprocessed particle positions and volumes
+class ParticleGenerator<BaseParticles, PreprocessedParticles> : public ParticleGenerator<BaseParticles>
+{
+  public:
+    ParticleGenerator(SPHBody &sph_body, BaseParticles &base_particles, const PreprocessedParticles &preprocessed_particles)
+        : ParticleGenerator<BaseParticles>(sph_body, base_particles), preprocessed_particles_(preprocessed_particles){};
+    virtual ~ParticleGenerator(){};
+    virtual void prepareGeometricData() override;
+
+  protected:
+    const PreprocessedParticles &preprocessed_particles_;
+};
+} // namespace SPH
+
 class BodyPartFromMesh : public BodyRegionByParticle
 {
   public:
@@ -80,7 +106,7 @@ class SolidBodyFromMesh : public SolidBody
 {
   public:
     SolidBodyFromMesh(SPHSystem &system, SharedPtr<TriangleMeshShape> triangle_mesh_shape, Real resolution,
-                      SharedPtr<SaintVenantKirchhoffSolid> material_model, Vec3d *pos_0, Real *volume);
+                      SharedPtr<SaintVenantKirchhoffSolid> material_model, const PreprocessedParticles &preprocessed_particles);
     ~SolidBodyFromMesh(){};
 };
 
@@ -97,10 +123,10 @@ class SolidBodyForSimulation
     DampingWithRandomChoice<InteractionSplit<DampingPairwiseInner<Vec3d, FixedDampingRate>>> damping_random_;
 
   public:
-    // no particle reload --> direct generator
+    // no preprocessed particles --> direct lattice generator
     SolidBodyForSimulation(
         SPHSystem &system, SharedPtr<TriangleMeshShape> triangle_mesh_shape, Real resolution,
-        Real physical_viscosity, SharedPtr<SaintVenantKirchhoffSolid> material_model, Vec3d *pos_0, Real *volume);
+        Real physical_viscosity, SharedPtr<SaintVenantKirchhoffSolid> material_model, const PreprocessedParticles &preprocessed_particles);
     ~SolidBodyForSimulation(){};
 
     SolidBodyFromMesh *getSolidBodyFromMesh() { return &solid_body_from_mesh_; };
@@ -116,11 +142,30 @@ class SolidBodyForSimulation
 
 void expandBoundingBox(BoundingBox *original, BoundingBox *additional);
 
-void relaxParticlesSingleResolution(bool write_particles_to_file,
-                                    SolidBodyFromMesh &solid_body_from_mesh,
-                                    BaseParticles &solid_body_from_mesh_particles,
+bool checkBoundingBoxOverlap(const BoundingBox &first, const BoundingBox &second);
+
+// parameters of the particle relaxation, which are also part of the particle cache key
+const int particle_relaxation_steps = 1000;
+const Real particle_randomization_factor = 0.25;
+// version of the particle cache file format and of the relaxation procedure, to be increased if either changes
+const uint32_t particle_cache_format_version = 1;
+
+void relaxParticlesSingleResolution(bool write_particle_relaxation_data,
+                                    SolidBody &solid_body_from_mesh,
                                     InnerRelation &solid_body_from_mesh_inner);
 
+void generateAndRelaxParticlesFromMesh(SharedPtr<TriangleMeshShape> triangle_mesh_shape, Real resolution,
+                                       bool write_particle_relaxation_data, PreprocessedParticles &relaxed_particles);
+
+// hash of the mesh geometry, the particle resolution and the relaxation parameters, used as the key of the particle cache
+uint64_t hashParticleCacheKey(TriangleMeshShape &triangle_mesh_shape, Real resolution);
+
+// the cache file starts with a header of the format version, the sizes of Real and Vecd and the key,
+// a file with a different header is not read
+bool readParticleCache(const std::string &file_path, uint64_t cache_key, PreprocessedParticles &cached_particles);
+
+void writeParticleCache(const std::string &file_path, uint64_t cache_key, const PreprocessedParticles &cached_particles);
+
 static inline Real getPhysicalViscosityGeneral(Real rho, Real youngs_modulus, Real length_scale, Real shape_constant = 1.0)
 {
     // the physical viscosity is defined in the paper pf prof. Hu
@@ -143,11 +188,17 @@ class StructuralSimulationInput
     StdVec<Real> physical_viscosity_;
     StdVec<IndexVector> contacting_body_pairs_list_;
     StdVec<std::pair<std::array<int, 2>, std::array<Real, 2>>> time_dep_contacting_body_pairs_list_;
+    // if true, each body may contact all other bodies and contacting_body_pairs_list_ is ignored
+    bool all_bodies_may_contact_;
     // scale system boundaries
     Real scale_system_boundaries_;
     // particle relaxation
     StdVec<bool> particle_relaxation_list_;
     bool write_particle_relaxation_data_;
+    // if true, the bodies with particle relaxation are created from the relaxed particles instead of lattice particles
+    bool use_relaxed_particles_;
+    // if not empty, relaxed particles are cached in this folder and reused for the same mesh and resolution
+    std::string particle_cache_path_;
     // boundary conditions
     StdVec<GravityPair> non_zero_gravity_;
     StdVec<AccelTuple> force_bounding_box_tuple_;
@@ -192,8 +243,11 @@ class StructuralSimulation
     StdVec<Real> physical_viscosity_;
     StdVec<IndexVector> contacting_body_pairs_list_;
     StdVec<std::pair<std::array<int, 2>, std::array<Real, 2>>> time_dep_contacting_body_pairs_list_; // optional: time dependent contact
+    bool all_bodies_may_contact_;                                                                    // optional: contact between all bodies
     StdVec<bool> particle_relaxation_list_;                                                          // optional: particle relaxation
     bool write_particle_relaxation_data_;
+    bool use_relaxed_particles_;      // optional: create bodies from relaxed particles
+    std::string particle_cache_path_; // optional: cache of relaxed particles
 
     // internal members
     Real system_resolution_;
@@ -202,12 +256,20 @@ class StructuralSimulation
     IOEnvironment io_environment_;
     Real &physical_time_;
 
+    StdVec<PreprocessedParticles> preprocessed_particles_list_;
     StdVec<SharedPtr<SolidBodyForSimulation>> solid_body_list_;
     StdVec<SharedPtr<SimpleDynamics<solid_dynamics::UpdateElasticNormalDirection>>> particle_normal_update_;
 
     StdVec<SharedPtr<SurfaceContactRelation>> contact_list_;
     StdVec<SharedPtr<InteractionDynamics<solid_dynamics::ContactFactorSummation>>> contact_density_list_;
     StdVec<SharedPtr<InteractionDynamics<solid_dynamics::ContactForce>>> contact_force_list_;
+    // for the contact broad phase of the general contacts, bounding boxes are refit every step
+    StdVec<SharedPtr<ReduceDynamics<PositionLowerBound>>> position_lower_bound_;
+    StdVec<SharedPtr<ReduceDynamics<PositionUpperBound>>> position_upper_bound_;
+    StdVec<BoundingBox> body_bounds_;
+    StdVec<IndexVector> broad_phase_overlaps_;
+    StdVec<bool> is_contact_active_;
+    StdVec<bool> was_contact_active_;
 
     // for initializeATimeStep
     StdVec<Gravity> gravity_list_;
@@ -255,9 +317,11 @@ class StructuralSimulation
     void setSystemResolutionMax();
     void createBodyMeshList();
     void calculateSystemBoundaries();
+    void preprocessBodyParticles();
     void initializeElasticSolidBodies();
     void initializeContactBetweenTwoBodies(int first, int second);
     void initializeAllContacts();
+    void initializeContactBroadPhase();
 
     // for initializeBoundaryConditions
     void initializeGravity();
@@ -295,6 +359,7 @@ class StructuralSimulation
     void executeDamping(Real dt);
     void executeStressRelaxationSecondHalf(Real dt);
     void executeUpdateCellLinkedList();
+    void executeContactBroadPhase();
     void executeContactUpdateConfiguration();
 
     void initializeSimulation();
@@ -307,6 +372,8 @@ class StructuralSimulation
 
     StdVec<SharedPtr<SolidBodyForSimulation>> get_solid_body_list_() { return solid_body_list_; };
     Real getMaxDisplacement(int body_index);
+    // indices of the bodies whose bounding boxes overlap with the given body at the latest broad phase
+    IndexVector getBroadPhaseOverlaps(int body_index) { return broad_phase_overlaps_[body_index]; };
 
     // For c++
     void runSimulation(Real end_time);
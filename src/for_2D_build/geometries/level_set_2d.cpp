@@ -14,8 +14,6 @@ void LevelSet::initializeDataForSingularPackage(const size_t package_index, Real
     auto &phi = phi_.DataField()[package_index];
     auto &near_interface_id = near_interface_id_.DataField()[package_index];
     auto &phi_gradient = phi_gradient_.DataField()[package_index];
-    auto &kernel_weight = kernel_weight_.DataField()[package_index];
-    auto &kernel_gradient = kernel_gradient_.DataField()[package_index];
 
     for_each_cell_data(
         [&](int i, int j)
@@ -23,6 +21,17 @@ void LevelSet::initializeDataForSingularPackage(const size_t package_index, Real
             phi[i][j] = far_field_level_set;
             near_interface_id[i][j] = far_field_level_set < 0.0 ? -2 : 2;
             phi_gradient[i][j] = Vecd::Ones();
+        });
+}
+//=================================================================================================//
+void LevelSet::initializeKernelIntegralsForSingularPackage(const size_t package_index, Real far_field_level_set)
+{
+    auto &kernel_weight = kernel_weight_.DataField()[package_index];
+    auto &kernel_gradient = kernel_gradient_.DataField()[package_index];
+
+    for_each_cell_data(
+        [&](int i, int j)
+        {
             kernel_weight[i][j] = far_field_level_set < 0.0 ? 0 : 1.0;
             kernel_gradient[i][j] = Vec2d::Zero();
         });
@@ -49,6 +58,65 @@ void LevelSet::initializeCellNeighborhood()
                           }
                       });
 }
+//=================================================================================================//
+void LevelSet::flattenDataPackages(UnsignedInt package_offset, UnsignedInt *package_neighbor,
+                                   Real *phi, Vecd *phi_gradient, Real *kernel_weight, Vecd *kernel_gradient)
+{
+    if (is_kernel_integrals_needed_)
+        prepareAllKernelIntegrals();
+    parallel_for(
+        IndexRange(0, num_grid_pkgs_),
+        [&](const IndexRange &r)
+        {
+            for (size_t package_index = r.begin(); package_index != r.end(); ++package_index)
+            {
+                // the singular packages have no neighborhood and only refer to themselves
+                UnsignedInt *neighbor = package_neighbor + package_index * 9;
+                for (int l = 0; l != 3; ++l)
+                    for (int m = 0; m != 3; ++m)
+                    {
+                        neighbor[l * 3 + m] = package_offset + (package_index < 2 ? package_index
+                                                                                  : cell_neighborhood_[package_index][l][m]);
+                    }
+
+                size_t data_offset = package_index * pkg_size * pkg_size;
+                auto &phi_data = phi_.DataField()[package_index];
+                auto &phi_gradient_data = phi_gradient_.DataField()[package_index];
+                for_each_cell_data(
+                    [&](int i, int j)
+                    {
+                        size_t data_index = data_offset + i * pkg_size + j;
+                        phi[data_index] = phi_data[i][j];
+                        phi_gradient[data_index] = phi_gradient_data[i][j];
+                    });
+
+                if (is_kernel_integrals_needed_)
+                {
+                    auto &kernel_weight_data = kernel_weight_.DataField()[package_index];
+                    auto &kernel_gradient_data = kernel_gradient_.DataField()[package_index];
+                    for_each_cell_data(
+                        [&](int i, int j)
+                        {
+                            size_t data_index = data_offset + i * pkg_size + j;
+                            kernel_weight[data_index] = kernel_weight_data[i][j];
+                            kernel_gradient[data_index] = kernel_gradient_data[i][j];
+                        });
+                }
+                else
+                {
+                    // the kernel integrals are disabled and never computed
+                    for_each_cell_data(
+                        [&](int i, int j)
+                        {
+                            size_t data_index = data_offset + i * pkg_size + j;
+                            kernel_weight[data_index] = 0.0;
+                            kernel_gradient[data_index] = Vecd::Zero();
+                        });
+                }
+            }
+        },
+        ap);
+}
 //=============================================================================================//
 bool LevelSet::isInnerPackage(const Arrayi &cell_index)
 {
@@ -186,11 +254,17 @@ void LevelSet::initializeBasicDataForAPackage(const Arrayi &cell_index, const si
     // size_t package_index = PackageIndexFromCellIndex(cell_index);
     auto &phi = phi_.DataField()[package_index];
     auto &near_interface_id = near_interface_id_.DataField()[package_index];
+    StdVec<Vecd> positions;
+    for_each_cell_data(
+        [&](int i, int j)
+        { positions.push_back(DataPositionFromIndex(cell_index, Array2i(i, j))); });
+    // the batched query allows the shape to reuse its search among the close data points of the package
+    StdVec<Real> signed_distances = shape.findSignedDistances(positions);
+    size_t data_index = 0;
     for_each_cell_data(
         [&](int i, int j)
         {
-            Vec2d position = DataPositionFromIndex(cell_index, Array2i(i, j));
-            phi[i][j] = shape.findSignedDistance(position);
+            phi[i][j] = signed_distances[data_index++];
             near_interface_id[i][j] = phi[i][j] < 0.0 ? -2 : 2;
         });
 }
@@ -273,6 +347,8 @@ void LevelSet::redistanceInterfaceForAPackage(const size_t package_index)
 //=============================================================================================//
 void LevelSet::writeMeshFieldToPlt(std::ofstream &output_file)
 {
+    if (is_kernel_integrals_needed_)
+        prepareAllKernelIntegrals();
     Arrayi number_of_operation = global_mesh_.AllGridPoints();
 
     output_file << "\n";
@@ -285,10 +361,13 @@ void LevelSet::writeMeshFieldToPlt(std::ofstream &output_file)
                 << "n_x, "
                 << "n_y "
                 << "near_interface_id ";
-    output_file << "kernel_weight, "
-                << "kernel_gradient_x, "
-                << "kernel_gradient_y "
-                << "\n";
+    if (is_kernel_integrals_needed_)
+    {
+        output_file << "kernel_weight, "
+                    << "kernel_gradient_x, "
+                    << "kernel_gradient_y ";
+    }
+    output_file << "\n";
     output_file << "zone i=" << number_of_operation[0] << "  j=" << number_of_operation[1] << "  k=" << 1
                 << "  DATAPACKING=BLOCK  SOLUTIONTIME=" << 0 << "\n";
 
@@ -352,6 +431,9 @@ void LevelSet::writeMeshFieldToPlt(std::ofstream &output_file)
         output_file << " \n";
     }
 
+    if (!is_kernel_integrals_needed_)
+        return;
+
     for (int j = 0; j != number_of_operation[1]; ++j)
     {
         for (int i = 0; i != number_of_operation[0]; ++i)
@@ -62,14 +62,25 @@ boost_multi_poly MultiPolygon::
     return multi_poly_tmp_out;
 }
 //=================================================================================================//
+void MultiPolygon::setMultiPoly(const boost_multi_poly &multi_poly)
+{
+    multi_poly_ = multi_poly;
+    StdVec<boost_segment> segments;
+    boost::geometry::for_each_segment(
+        multi_poly_, [&](const model::referring_segment<model::d2::point_xy<Real>> &segment)
+        { segments.push_back(boost_segment(segment.first, segment.second)); });
+    // the range constructor builds the tree with the packing algorithm
+    segment_rtree_ = boost_segment_rtree(segments);
+}
+//=================================================================================================//
 void MultiPolygon::addAMultiPolygon(MultiPolygon &multi_polygon_op, ShapeBooleanOps op)
 {
-    multi_poly_ = MultiPolygonByBooleanOps(multi_poly_, multi_polygon_op.getBoostMultiPoly(), op);
+    setMultiPoly(MultiPolygonByBooleanOps(multi_poly_, multi_polygon_op.getBoostMultiPoly(), op));
 }
 //=================================================================================================//
 void MultiPolygon::addABoostMultiPoly(boost_multi_poly &boost_multi_poly_op, ShapeBooleanOps op)
 {
-    multi_poly_ = MultiPolygonByBooleanOps(multi_poly_, boost_multi_poly_op, op);
+    setMultiPoly(MultiPolygonByBooleanOps(multi_poly_, boost_multi_poly_op, op));
 }
 //=================================================================================================//
 void MultiPolygon::addABox(Transform transform, const Vecd &halfsize, ShapeBooleanOps op)
@@ -115,7 +126,7 @@ void MultiPolygon::addACircle(const Vecd &center, Real radius, int resolution, S
         throw;
     }
 
-    multi_poly_ = MultiPolygonByBooleanOps(multi_poly_, multi_poly_circle, op);
+    setMultiPoly(MultiPolygonByBooleanOps(multi_poly_, multi_poly_circle, op));
 }
 //=================================================================================================//
 void MultiPolygon::addAPolygon(const std::vector<Vecd> &points, ShapeBooleanOps op)
@@ -145,7 +156,7 @@ void MultiPolygon::addAPolygon(const std::vector<Vecd> &points, ShapeBooleanOps
     boost_multi_poly multi_poly_polygon;
     convert(poly, multi_poly_polygon);
 
-    multi_poly_ = MultiPolygonByBooleanOps(multi_poly_, multi_poly_polygon, op);
+    setMultiPoly(MultiPolygonByBooleanOps(multi_poly_, multi_poly_polygon, op));
 }
 //=================================================================================================//
 void MultiPolygon::
@@ -176,80 +187,107 @@ void MultiPolygon::
 //=================================================================================================//
 bool MultiPolygon::checkContain(const Vec2d &probe_point, bool BOUNDARY_INCLUDED /*= true*/)
 {
-    if (BOUNDARY_INCLUDED)
+    typedef model::d2::point_xy<Real> pnt_type;
+    typedef model::box<pnt_type> box_type;
+    namespace bgi = boost::geometry::index;
+    if (segment_rtree_.empty())
+        return false;
+
+    pnt_type input_p(probe_point[0], probe_point[1]);
+    for (auto it = segment_rtree_.qbegin(bgi::intersects(input_p)); it != segment_rtree_.qend(); ++it)
     {
-        return covered_by(model::d2::point_xy<Real>(probe_point[0], probe_point[1]), multi_poly_);
+        if (boost::geometry::intersects(input_p, *it))
+            return BOUNDARY_INCLUDED;
     }
-    else
+
+    /** Crossing number of the ray toward positive x direction with the half-open rule. */
+    Real x_max = segment_rtree_.bounds().max_corner().get<0>();
+    if (probe_point[0] > x_max)
+        return false;
+    box_type ray_box(input_p, pnt_type(x_max, probe_point[1]));
+    bool is_inside = false;
+    for (auto it = segment_rtree_.qbegin(bgi::intersects(ray_box)); it != segment_rtree_.qend(); ++it)
     {
-        return within(model::d2::point_xy<Real>(probe_point[0], probe_point[1]), multi_poly_);
+        Vecd p_0(get<0, 0>(*it), get<0, 1>(*it));
+        Vecd p_1(get<1, 0>(*it), get<1, 1>(*it));
+        if ((p_0[1] > probe_point[1]) != (p_1[1] > probe_point[1]))
+        {
+            Real x_crossing = p_0[0] + (probe_point[1] - p_0[1]) * (p_1[0] - p_0[0]) / (p_1[1] - p_0[1]);
+            if (probe_point[0] < x_crossing)
+                is_inside = !is_inside;
+        }
     }
+    return is_inside;
 }
 //=================================================================================================//
-Vecd MultiPolygon::findClosestPoint(const Vecd &probe_point)
+Vecd MultiPolygon::findClosestPointOnSegment(const Vecd &probe_point, const boost_segment &segment)
 {
-    typedef model::d2::point_xy<Real> pnt_type;
-    typedef model::referring_segment<model::d2::point_xy<Real>> seg_type;
-    /**
-     * typedef model::segment<model::d2::point_xy<Real>> seg_type;
-     * From the documentation on segment and referring_segment, the only difference between the two is that
-     * referring_segment holds a reference to the points.
-     * This is what is needed in a for each that modifies the segment since the points modified should be
-     * reflected in the line string. In a for each that does not modify the points, it should still take a
-     * reference (most likely a const reference) since it reduces the amount of copying.
-     */
-    pnt_type input_p(probe_point[0], probe_point[1]);
-    model::segment<model::d2::point_xy<Real>> closest_seg;
-    Real closest_dist_2seg = boost::numeric::bounds<Real>::highest();
-    std::function<void(seg_type)> findclosestsegment = [&closest_seg, &closest_dist_2seg, &input_p](seg_type seg)
-    {
-        Real dist = boost::geometry::distance(input_p, seg);
-        if (dist < closest_dist_2seg)
-        {
-            closest_dist_2seg = dist;
-            // closest_seg.append(seg);
-            Real x0 = boost::geometry::get<0, 0>(seg);
-            Real y0 = boost::geometry::get<0, 1>(seg);
-            Real x1 = boost::geometry::get<1, 0>(seg);
-            Real y1 = boost::geometry::get<1, 1>(seg);
-            boost::geometry::set<0, 0>(closest_seg, x0);
-            boost::geometry::set<0, 1>(closest_seg, y0);
-            boost::geometry::set<1, 0>(closest_seg, x1);
-            boost::geometry::set<1, 1>(closest_seg, y1);
-        }
-    };
-    boost::geometry::for_each_segment(multi_poly_, findclosestsegment);
-
-    Vecd p_find = Vecd::Zero();
-
-    Real x0 = boost::geometry::get<0, 0>(closest_seg);
-    Real y0 = boost::geometry::get<0, 1>(closest_seg);
-    Real x1 = boost::geometry::get<1, 0>(closest_seg);
-    Real y1 = boost::geometry::get<1, 1>(closest_seg);
-    Vecd p_0(x0, y0);
-    Vecd p_1(x1, y1);
+    Vecd p_0(get<0, 0>(segment), get<0, 1>(segment));
+    Vecd p_1(get<1, 0>(segment), get<1, 1>(segment));
     Vecd vec_v = p_1 - p_0;
     Vecd vec_w = probe_point - p_0;
 
     Real c1 = vec_v.dot(vec_w);
     if (c1 <= 0)
     {
-        p_find = p_0;
+        return p_0;
     }
-    else
+
+    Real c2 = vec_v.dot(vec_v);
+    if (c2 <= c1)
     {
-        Real c2 = vec_v.dot(vec_v);
-        if (c2 <= c1)
-        {
-            p_find = p_1;
-        }
-        else
+        return p_1;
+    }
+    return p_0 + vec_v * c1 / c2;
+}
+//=================================================================================================//
+boost_segment MultiPolygon::findClosestSegment(const Vecd &probe_point)
+{
+    StdVec<boost_segment> closest_segment;
+    segment_rtree_.query(boost::geometry::index::nearest(model::d2::point_xy<Real>(probe_point[0], probe_point[1]), 1),
+                         std::back_inserter(closest_segment));
+    return closest_segment[0];
+}
+//=================================================================================================//
+Vecd MultiPolygon::findClosestPoint(const Vecd &probe_point)
+{
+    if (segment_rtree_.empty())
+        return probe_point;
+
+    return findClosestPointOnSegment(probe_point, findClosestSegment(probe_point));
+}
+//=================================================================================================//
+StdVec<Real> MultiPolygon::findSignedDistances(const StdVec<Vecd> &probe_points)
+{
+    typedef model::d2::point_xy<Real> pnt_type;
+    namespace bgi = boost::geometry::index;
+    StdVec<Real> signed_distances;
+    signed_distances.reserve(probe_points.size());
+    if (probe_points.empty() || segment_rtree_.empty())
+        return signed_distances;
+
+    /** The closest segment of the previous point bounds the search region of the next one. */
+    boost_segment closest_segment = findClosestSegment(probe_points[0]);
+    for (const Vecd &probe_point : probe_points)
+    {
+        Real distance_bound = (findClosestPointOnSegment(probe_point, closest_segment) - probe_point).norm();
+        Vecd lower_bound = probe_point - distance_bound * Vecd::Ones();
+        Vecd upper_bound = probe_point + distance_bound * Vecd::Ones();
+        model::box<pnt_type> search_box(pnt_type(lower_bound[0], lower_bound[1]), pnt_type(upper_bound[0], upper_bound[1]));
+
+        Real distance = distance_bound;
+        for (auto it = segment_rtree_.qbegin(bgi::intersects(search_box)); it != segment_rtree_.qend(); ++it)
         {
-            p_find = p_0 + vec_v * c1 / c2;
+            Real segment_distance = (findClosestPointOnSegment(probe_point, *it) - probe_point).norm();
+            if (segment_distance < distance)
+            {
+                distance = segment_distance;
+                closest_segment = *it;
+            }
         }
+        signed_distances.push_back(checkContain(probe_point) ? -distance : distance);
     }
-
-    return p_find;
+    return signed_distances;
 }
 //=================================================================================================//
 BoundingBox MultiPolygon::findBounds()
@@ -279,6 +317,11 @@ Vecd MultiPolygonShape::findClosestPoint(const Vecd &probe_point)
     return multi_polygon_.findClosestPoint(probe_point);
 }
 //=================================================================================================//
+StdVec<Real> MultiPolygonShape::findSignedDistances(const StdVec<Vecd> &probe_points)
+{
+    return multi_polygon_.findSignedDistances(probe_points);
+}
+//=================================================================================================//
 BoundingBox MultiPolygonShape::findBounds()
 {
     return multi_polygon_.findBounds();
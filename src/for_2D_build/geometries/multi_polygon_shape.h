@@ -41,6 +41,8 @@
 #include <boost/geometry/geometries/adapted/boost_tuple.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/polygon.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+#include <boost/geometry/index/rtree.hpp>
 #include <boost/geometry/strategies/transform.hpp>
 #include <boost/geometry/strategies/transform/matrix_transformers.hpp>
 
@@ -61,10 +63,15 @@ class Kernel;
 
 typedef model::polygon<model::d2::point_xy<Real>> boost_poly;
 typedef model::multi_polygon<boost_poly> boost_multi_poly;
+typedef model::segment<model::d2::point_xy<Real>> boost_segment;
+typedef boost::geometry::index::rtree<boost_segment, boost::geometry::index::rstar<16>> boost_segment_rtree;
 
 /**
  * @class MultiPolygon
  * @brief used to define a closed region
+ * @details The segments of all rings are kept in a packed R-tree, which is rebuilt after each boolean operation.
+ * The closest point is found by nearest-neighbor traversal and the containment by counting
+ * the crossings of a ray with the segments filtered by the R-tree.
  */
 class MultiPolygon
 {
@@ -72,11 +79,13 @@ class MultiPolygon
     MultiPolygon(){};
     explicit MultiPolygon(const std::vector<Vecd> &points);
     explicit MultiPolygon(const Vecd &center, Real radius, int resolution);
-    boost_multi_poly &getBoostMultiPoly() { return multi_poly_; };
+    const boost_multi_poly &getBoostMultiPoly() { return multi_poly_; };
 
     BoundingBox findBounds();
     bool checkContain(const Vecd &pnt, bool BOUNDARY_INCLUDED = true);
     Vecd findClosestPoint(const Vecd &probe_point);
+    /** Batched signed distances for spatially coherent probe points, such as those of a level-set package. */
+    StdVec<Real> findSignedDistances(const StdVec<Vecd> &probe_points);
 
     void addAMultiPolygon(MultiPolygon &multi_polygon, ShapeBooleanOps op);
     void addABoostMultiPoly(boost_multi_poly &boost_multi_poly, ShapeBooleanOps op);
@@ -87,6 +96,11 @@ class MultiPolygon
 
   protected:
     boost_multi_poly multi_poly_;
+    boost_segment_rtree segment_rtree_;
+
+    void setMultiPoly(const boost_multi_poly &multi_poly);
+    Vecd findClosestPointOnSegment(const Vecd &probe_point, const boost_segment &segment);
+    boost_segment findClosestSegment(const Vecd &probe_point);
     boost_multi_poly MultiPolygonByBooleanOps(boost_multi_poly multi_poly_in,
                                               boost_multi_poly multi_poly_op,
                                               ShapeBooleanOps boolean_op);
@@ -109,6 +123,7 @@ class MultiPolygonShape : public Shape
     virtual bool isValid() override;
     virtual bool checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED = true) override;
     virtual Vecd findClosestPoint(const Vecd &probe_point) override;
+    virtual StdVec<Real> findSignedDistances(const StdVec<Vecd> &probe_points) override;
 
   protected:
     MultiPolygon multi_polygon_;
@@ -199,6 +199,7 @@ void ANSYSMesh::getMinimumDistanceBetweenNodes()
 //=================================================================================================//
 void BaseInnerRelationInFVM::resetNeighborhoodCurrentSize()
 {
+    total_configuration_updates_++;
     parallel_for(
         IndexRange(0, base_particles_.TotalRealParticles()),
         [&](const IndexRange &r)
@@ -14,8 +14,6 @@ void LevelSet::initializeDataForSingularPackage(const size_t package_index, Real
     auto &phi = phi_.DataField()[package_index];
     auto &near_interface_id = near_interface_id_.DataField()[package_index];
     auto &phi_gradient = phi_gradient_.DataField()[package_index];
-    auto &kernel_weight = kernel_weight_.DataField()[package_index];
-    auto &kernel_gradient = kernel_gradient_.DataField()[package_index];
 
     for_each_cell_data(
         [&](int i, int j, int k)
@@ -23,6 +21,17 @@ void LevelSet::initializeDataForSingularPackage(const size_t package_index, Real
             phi[i][j][k] = far_field_level_set;
             near_interface_id[i][j][k] = far_field_level_set < 0.0 ? -2 : 2;
             phi_gradient[i][j][k] = Vecd::Ones();
+        });
+}
+//=================================================================================================//
+void LevelSet::initializeKernelIntegralsForSingularPackage(const size_t package_index, Real far_field_level_set)
+{
+    auto &kernel_weight = kernel_weight_.DataField()[package_index];
+    auto &kernel_gradient = kernel_gradient_.DataField()[package_index];
+
+    for_each_cell_data(
+        [&](int i, int j, int k)
+        {
             kernel_weight[i][j][k] = far_field_level_set < 0.0 ? 0 : 1.0;
             kernel_gradient[i][j][k] = Vec3d::Zero();
         });
@@ -50,6 +59,67 @@ void LevelSet::initializeCellNeighborhood()
                           }
                       });
 }
+//=================================================================================================//
+void LevelSet::flattenDataPackages(UnsignedInt package_offset, UnsignedInt *package_neighbor,
+                                   Real *phi, Vecd *phi_gradient, Real *kernel_weight, Vecd *kernel_gradient)
+{
+    if (is_kernel_integrals_needed_)
+        prepareAllKernelIntegrals();
+    parallel_for(
+        IndexRange(0, num_grid_pkgs_),
+        [&](const IndexRange &r)
+        {
+            for (size_t package_index = r.begin(); package_index != r.end(); ++package_index)
+            {
+                // the singular packages have no neighborhood and only refer to themselves
+                UnsignedInt *neighbor = package_neighbor + package_index * 27;
+                for (int l = 0; l != 3; ++l)
+                    for (int m = 0; m != 3; ++m)
+                        for (int n = 0; n != 3; ++n)
+                        {
+                            neighbor[(l * 3 + m) * 3 + n] =
+                                package_offset + (package_index < 2 ? package_index
+                                                                    : cell_neighborhood_[package_index][l][m][n]);
+                        }
+
+                size_t data_offset = package_index * pkg_size * pkg_size * pkg_size;
+                auto &phi_data = phi_.DataField()[package_index];
+                auto &phi_gradient_data = phi_gradient_.DataField()[package_index];
+                for_each_cell_data(
+                    [&](int i, int j, int k)
+                    {
+                        size_t data_index = data_offset + (i * pkg_size + j) * pkg_size + k;
+                        phi[data_index] = phi_data[i][j][k];
+                        phi_gradient[data_index] = phi_gradient_data[i][j][k];
+                    });
+
+                if (is_kernel_integrals_needed_)
+                {
+                    auto &kernel_weight_data = kernel_weight_.DataField()[package_index];
+                    auto &kernel_gradient_data = kernel_gradient_.DataField()[package_index];
+                    for_each_cell_data(
+                        [&](int i, int j, int k)
+                        {
+                            size_t data_index = data_offset + (i * pkg_size + j) * pkg_size + k;
+                            kernel_weight[data_index] = kernel_weight_data[i][j][k];
+                            kernel_gradient[data_index] = kernel_gradient_data[i][j][k];
+                        });
+                }
+                else
+                {
+                    // the kernel integrals are disabled and never computed
+                    for_each_cell_data(
+                        [&](int i, int j, int k)
+                        {
+                            size_t data_index = data_offset + (i * pkg_size + j) * pkg_size + k;
+                            kernel_weight[data_index] = 0.0;
+                            kernel_gradient[data_index] = Vecd::Zero();
+                        });
+                }
+            }
+        },
+        ap);
+}
 //=============================================================================================//
 bool LevelSet::isInnerPackage(const Arrayi &cell_index)
 {
@@ -187,11 +257,17 @@ void LevelSet::initializeBasicDataForAPackage(const Arrayi &cell_index, const si
 {
     auto &phi = phi_.DataField()[package_index];
     auto &near_interface_id = near_interface_id_.DataField()[package_index];
+    StdVec<Vecd> positions;
+    for_each_cell_data(
+        [&](int i, int j, int k)
+        { positions.push_back(DataPositionFromIndex(cell_index, Array3i(i, j, k))); });
+    // the batched query allows the shape to reuse its search among the close data points of the package
+    StdVec<Real> signed_distances = shape.findSignedDistances(positions);
+    size_t data_index = 0;
     for_each_cell_data(
         [&](int i, int j, int k)
         {
-            Vec3d position = DataPositionFromIndex(cell_index, Array3i(i, j, k));
-            phi[i][j][k] = shape.findSignedDistance(position);
+            phi[i][j][k] = signed_distances[data_index++];
             near_interface_id[i][j][k] = phi[i][j][k] < 0.0 ? -2 : 2;
         });
 }
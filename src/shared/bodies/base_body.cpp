@@ -1,5 +1,6 @@
 #include "base_body.h"
 
+#include "base_body_part.h"
 #include "base_body_relation.h"
 #include "base_particles.hpp"
 #include "sph_system.h"
@@ -10,6 +11,7 @@ namespace SPH
 SPHBody::SPHBody(SPHSystem &sph_system, Shape &shape, const std::string &name)
     : sph_system_(sph_system), body_name_(name), newly_updated_(true),
       base_particles_(nullptr), is_bound_set_(false), initial_shape_(&shape), total_body_parts_(0),
+      total_body_parts_by_particle_(0),
       sph_adaptation_(sph_adaptation_ptr_keeper_.createPtr<SPHAdaptation>(sph_system.ReferenceResolution())),
       base_material_(base_material_ptr_keeper_.createPtr<BaseMaterial>())
 {
@@ -42,6 +44,27 @@ int SPHBody::getNewBodyPartID()
     return total_body_parts_;
 };
 //=================================================================================================//
+int SPHBody::getNewSortableBodyPartID()
+{
+    total_body_parts_by_particle_++;
+    return total_body_parts_by_particle_;
+};
+//=================================================================================================//
+void SPHBody::removeBodyPartByParticle(BodyPartByParticle *body_part)
+{
+    body_parts_by_particle_.erase(
+        std::remove(body_parts_by_particle_.begin(), body_parts_by_particle_.end(), body_part),
+        body_parts_by_particle_.end());
+}
+//=================================================================================================//
+void SPHBody::updateBodyPartsAfterSorting()
+{
+    for (auto &body_part : body_parts_by_particle_)
+    {
+        body_part->updateAfterParticleSorting();
+    }
+}
+//=================================================================================================//
 SPHSystem &SPHBody::getSPHSystem()
 {
     return sph_system_;
@@ -52,6 +52,7 @@ namespace SPH
 {
 class SPHRelation;
 class BodySurface;
+class BodyPartByParticle;
 
 /**
  * @class SPHBody
@@ -79,6 +80,8 @@ class SPHBody
     int total_body_parts_;
     StdVec<execution::Implementation<Base> *> all_simple_reduce_computing_kernels_;
     /**< total number of body parts */
+    StdVec<BodyPartByParticle *> body_parts_by_particle_; /**< body parts updated after particle sorting */
+    int total_body_parts_by_particle_;                    /**< for the sortable IDs of the body parts by particle */
 
   public:
     SPHAdaptation *sph_adaptation_;        /**< numerical adaptation policy */
@@ -112,6 +115,11 @@ class SPHBody
     void registerComputingKernel(execution::Implementation<Base> *implementation);
     int getNewBodyPartID();
     int getTotalBodyParts() { return total_body_parts_; };
+    int getNewSortableBodyPartID();
+    void addBodyPartByParticle(BodyPartByParticle *body_part) { body_parts_by_particle_.push_back(body_part); };
+    void removeBodyPartByParticle(BodyPartByParticle *body_part);
+    StdVec<BodyPartByParticle *> &getBodyPartsByParticle() { return body_parts_by_particle_; };
+    void updateBodyPartsAfterSorting();
     //----------------------------------------------------------------------
     //		Object factory template functions
     //----------------------------------------------------------------------
@@ -4,13 +4,97 @@
 namespace SPH
 {
 //=================================================================================================//
+BodyPartByParticle::BodyPartByParticle(SPHBody &sph_body, const std::string &body_part_name)
+    : BodyPart(sph_body, body_part_name),
+      body_part_bounds_(Vecd::Zero(), Vecd::Zero()), body_part_bounds_set_(false),
+      sortable_id_(sph_body.getNewSortableBodyPartID()),
+      body_part_id_(base_particles_.registerStateVariable<int>("BodyPartID")),
+      original_id_(base_particles_.ParticleOriginalIds()), sorted_id_(base_particles_.ParticleSortedIds()),
+      is_contiguous_(false), contiguous_range_(0, 0)
+{
+    base_particles_.addVariableToSort<int>("BodyPartID");
+    sph_body.addBodyPartByParticle(this);
+}
+//=================================================================================================//
+BodyPartByParticle::~BodyPartByParticle()
+{
+    if (is_contiguous_)
+    {
+        for (size_t i = 0; i != base_particles_.TotalRealParticles(); ++i)
+        {
+            if (body_part_id_[i] == sortable_id_)
+                body_part_id_[i] = 0;
+        }
+    }
+    sph_body_.removeBodyPartByParticle(this);
+}
+//=================================================================================================//
 void BodyPartByParticle::tagParticles(TaggingParticleMethod &tagging_particle_method)
 {
     for (size_t i = 0; i < base_particles_.TotalRealParticles(); ++i)
     {
         tagging_particle_method(i);
     }
+    assignBodyPartID();
 };
+//=================================================================================================//
+void BodyPartByParticle::assignBodyPartID()
+{
+    if (UnsignedInt(sortable_id_) > MaxSortableBodyPartID)
+    {
+        std::cout << "WARNING: the body part " << body_part_name_ << " of " << sph_body_.getName()
+                  << " is not kept contiguous by particle sorting, as only " << MaxSortableBodyPartID
+                  << " body parts by particle are sortable with this precision." << std::endl;
+    }
+    is_contiguous_ = !body_part_particles_.empty() && UnsignedInt(sortable_id_) <= MaxSortableBodyPartID;
+    for (size_t index_i : body_part_particles_)
+    {
+        if (body_part_id_[index_i] != 0)
+        {
+            is_contiguous_ = false;
+            break;
+        }
+    }
+
+    if (is_contiguous_)
+    {
+        for (size_t index_i : body_part_particles_)
+        {
+            body_part_id_[index_i] = sortable_id_;
+        }
+    }
+    else
+    {
+        original_ids_.resize(body_part_particles_.size());
+        for (size_t k = 0; k != body_part_particles_.size(); ++k)
+        {
+            original_ids_[k] = original_id_[body_part_particles_[k]];
+        }
+    }
+}
+//=================================================================================================//
+void BodyPartByParticle::updateAfterParticleSorting()
+{
+    if (is_contiguous_)
+    {
+        int *begin = body_part_id_;
+        int *end = body_part_id_ + base_particles_.TotalRealParticles();
+        int *range_begin = std::lower_bound(begin, end, sortable_id_);
+        int *range_end = std::upper_bound(range_begin, end, sortable_id_);
+        contiguous_range_ = IndexRange(range_begin - begin, range_end - begin);
+
+        body_part_particles_.resize(contiguous_range_.size());
+        std::iota(body_part_particles_.begin(), body_part_particles_.end(), contiguous_range_.begin());
+    }
+    else
+    {
+        for (size_t k = 0; k != body_part_particles_.size(); ++k)
+        {
+            body_part_particles_[k] = sorted_id_[original_ids_[k]];
+        }
+        std::sort(body_part_particles_.begin(), body_part_particles_.end());
+    }
+}
 //=============================================================================================//
 size_t BodyPartByCell::SizeOfLoopRange()
 {
@@ -64,9 +64,28 @@ class BodyPart
     Vecd *pos_;
 };
 
+/**
+ * The Morton order of the cell occupies the lower bits of the particle sorting sequence
+ * and the body part ID the higher bits. Therefore, the particles of a body part
+ * are sorted into a contiguous range, in which they are still ordered by cells.
+ * Note that a 32-bit sequence, i.e. with single precision, leaves room for three sortable body parts only.
+ * Only the body parts by particle are given sortable IDs.
+ */
+constexpr UnsignedInt MaxSortableBodyPartID = (UnsignedInt(1) << (8 * sizeof(UnsignedInt) - Mesh::MortonOrderBits)) - 1;
+inline UnsignedInt SortingSequence(int body_part_id, UnsignedInt morton_order)
+{
+    return (UnsignedInt(body_part_id) << Mesh::MortonOrderBits) | morton_order;
+};
+
 /**
  * @class BodyPartByParticle
  * @brief A body part with a collection of particles.
+ * @details The particles tagged to a body part carry its sortable ID in the state variable "BodyPartID",
+ * which is used as the primary key for particle sorting and is copied with the particle state
+ * when particles are moved by buffer operations. After each sorting, the body part
+ * becomes a contiguous range of particles and the particle collection is re-derived.
+ * If the tagged particles already belong to another body part,
+ * the collection is instead re-mapped by the original particle IDs.
  */
 class BodyPartByParticle : public BodyPart
 {
@@ -76,10 +95,8 @@ class BodyPartByParticle : public BodyPart
     IndexVector &LoopRange() { return body_part_particles_; };
     size_t SizeOfLoopRange() { return body_part_particles_.size(); };
 
-    BodyPartByParticle(SPHBody &sph_body, const std::string &body_part_name)
-        : BodyPart(sph_body, body_part_name),
-          body_part_bounds_(Vecd::Zero(), Vecd::Zero()), body_part_bounds_set_(false){};
-    virtual ~BodyPartByParticle(){};
+    BodyPartByParticle(SPHBody &sph_body, const std::string &body_part_name);
+    virtual ~BodyPartByParticle();
 
     void setBodyPartBounds(BoundingBox bbox)
     {
@@ -94,12 +111,26 @@ class BodyPartByParticle : public BodyPart
         return body_part_bounds_;
     }
 
+    bool isContiguous() { return is_contiguous_; };
+    /** The range of the body part particles, only valid for a contiguous body part after sorting. */
+    IndexRange ContiguousRange() { return contiguous_range_; };
+    void updateAfterParticleSorting();
+
   protected:
     BoundingBox body_part_bounds_;
     bool body_part_bounds_set_;
+    int sortable_id_; /**< ID tagged on the particles, counted among the body parts by particle only */
+    int *body_part_id_;
+    UnsignedInt *original_id_;
+    UnsignedInt *sorted_id_;
+    bool is_contiguous_;
+    IndexRange contiguous_range_;
+    IndexVector original_ids_; /**< original IDs of the particles in a non-contiguous body part. */
 
     typedef std::function<void(size_t)> TaggingParticleMethod;
     void tagParticles(TaggingParticleMethod &tagging_particle_method);
+    /** assign part ID to the tagged particles, or record their original IDs if they are already claimed */
+    void assignBodyPartID();
 };
 
 /**
@@ -243,6 +243,7 @@ TreeTerminates::TreeTerminates(SPHBody &sph_body)
             body_part_particles_.push_back(particle_index);
         }
     }
+    assignBodyPartID();
 }
 //=================================================================================================//
 } // namespace SPH
@@ -29,6 +29,7 @@ BaseInnerRelation::BaseInnerRelation(RealBody &real_body)
 //=================================================================================================//
 void BaseInnerRelation::resetNeighborhoodCurrentSize()
 {
+    total_configuration_updates_++;
     parallel_for(
         IndexRange(0, base_particles_.TotalRealParticles()),
         [&](const IndexRange &r)
@@ -57,6 +58,7 @@ BaseContactRelation::BaseContactRelation(SPHBody &sph_body, RealBodyVector conta
 //=================================================================================================//
 void BaseContactRelation::resetNeighborhoodCurrentSize()
 {
+    total_configuration_updates_++;
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
     {
         parallel_for(
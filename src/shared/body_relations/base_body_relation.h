@@ -113,10 +113,13 @@ class SPHRelation
 
     void subscribeToBody() { sph_body_.body_relations_.push_back(this); };
     virtual void updateConfiguration() = 0;
+    /** number of configuration updates, for keeping data derived from the configuration up to date. */
+    size_t TotalConfigurationUpdates() { return total_configuration_updates_; };
 
   protected:
     SPHBody &sph_body_;
     BaseParticles &base_particles_;
+    size_t total_configuration_updates_ = 0; /**< counted when the neighborhoods are reset for an update. */
 };
 
 /**
@@ -43,6 +43,7 @@ ShellSurfaceContactRelation::ShellSurfaceContactRelation(SPHBody &sph_body, Real
 //=================================================================================================//
 void ShellSurfaceContactRelation::resetNeighborhoodCurrentSize()
 {
+    total_configuration_updates_++;
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
     {
         particle_for(execution::ParallelPolicy(), body_part_particles_,
@@ -186,7 +187,8 @@ void ContactRelationFromFluidToShell::updateConfiguration()
 SurfaceContactRelation::SurfaceContactRelation(SPHBody &sph_body, RealBodyVector contact_bodies, StdVec<bool> normal_corrections)
     : ContactRelationCrossResolution(sph_body, std::move(contact_bodies)),
       body_surface_layer_(shape_surface_ptr_keeper_.createPtr<BodySurfaceLayer>(sph_body)),
-      body_part_particles_(body_surface_layer_->body_part_particles_)
+      body_part_particles_(body_surface_layer_->body_part_particles_),
+      is_contact_active_(contact_bodies_.size(), true)
 {
     // Check if the source body is a shell body
     // Fix invalid list of particles ids with shell (in case body shape is absent by the time of construction)
@@ -221,6 +223,7 @@ SurfaceContactRelation::SurfaceContactRelation(SPHBody &sph_body, RealBodyVector
 //=================================================================================================//
 void SurfaceContactRelation::resetNeighborhoodCurrentSize()
 {
+    total_configuration_updates_++;
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
     {
         particle_for(execution::ParallelPolicy(), body_part_particles_,
@@ -236,9 +239,12 @@ void SurfaceContactRelation::updateConfiguration()
     resetNeighborhoodCurrentSize();
     for (size_t k = 0; k != contact_bodies_.size(); ++k)
     {
-        target_cell_linked_lists_[k]->searchNeighborsByParticles(
-            *body_surface_layer_, contact_configuration_[k],
-            *get_search_depths_[k], *get_contact_neighbors_[k]);
+        if (is_contact_active_[k])
+        {
+            target_cell_linked_lists_[k]->searchNeighborsByParticles(
+                *body_surface_layer_, contact_configuration_[k],
+                *get_search_depths_[k], *get_contact_neighbors_[k]);
+        }
     }
 }
 //=================================================================================================//
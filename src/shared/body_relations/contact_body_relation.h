@@ -215,11 +215,16 @@ class SurfaceContactRelation : public ContactRelationCrossResolution
     ~SurfaceContactRelation() override = default;
     void updateConfiguration() override;
     BodySurfaceLayer *get_body_surface_layer() { return body_surface_layer_; }
+    /** An inactive contact body is skipped in the neighbor search and has no contact neighbors,
+     *  e.g. when a broad phase has found it far away from the body. */
+    void setContactActive(size_t k, bool is_active) { is_contact_active_[k] = is_active; };
+    bool isContactActive(size_t k) { return is_contact_active_[k]; };
 
   private:
     BodySurfaceLayer *body_surface_layer_;
     IndexVector &body_part_particles_;
     StdVec<NeighborBuilder *> get_contact_neighbors_;
+    StdVec<bool> is_contact_active_;
 
     void resetNeighborhoodCurrentSize() override;
 };
@@ -57,6 +57,7 @@ SelfSurfaceContactRelation::
 //=================================================================================================//
 void SelfSurfaceContactRelation::resetNeighborhoodCurrentSize()
 {
+    total_configuration_updates_++;
     particle_for(execution::ParallelPolicy(), body_part_particles_,
                  [&](size_t index_i)
                  {
@@ -78,6 +79,7 @@ TreeInnerRelation::TreeInnerRelation(RealBody &real_body)
 //=================================================================================================//
 void TreeInnerRelation::updateConfiguration()
 {
+    total_configuration_updates_++;
     generative_tree_.buildParticleConfiguration(inner_configuration_);
 }
 //=================================================================================================//
@@ -43,7 +43,9 @@
 namespace SPH
 {
 
-static tbb::affinity_partitioner ap;
+/** An affinity partitioner must not be shared by concurrently running algorithms,
+ * so each thread launching parallel loops, e.g. in concurrent body preprocessing, keeps its own. */
+static thread_local tbb::affinity_partitioner ap;
 typedef tbb::blocked_range<size_t> IndexRange;
 typedef tbb::blocked_range2d<size_t> IndexRange2d;
 typedef tbb::blocked_range3d<size_t> IndexRange3d;
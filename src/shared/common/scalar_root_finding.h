@@ -0,0 +1,109 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	scalar_root_finding.h
+ * @brief 	Safeguarded solver for a scalar nonlinear equation with a known bracket,
+ *          as used by the per-particle return mapping of inelastic materials.
+ * @author	Xiangyu Hu
+ */
+#ifndef SCALAR_ROOT_FINDING_H
+#define SCALAR_ROOT_FINDING_H
+
+#include "scalar_functions.h"
+
+#include <atomic>
+
+namespace SPH
+{
+/**
+ * @class SafeguardedNewtonSolver
+ * @brief Newton iterations kept within a bracket which is shrunk by the sign of the residual.
+ * A bisection step is taken whenever the Newton step leaves the bracket or does not halve the residual.
+ * The solve stops when the residual is below the tolerance relative to a given scale,
+ * or when the bracket is narrower than the tolerance relative to the solution.
+ * Solves reaching the iteration cap return the best estimate and are counted for diagnostics.
+ */
+class SafeguardedNewtonSolver
+{
+  public:
+    explicit SafeguardedNewtonSolver(Real tolerance = 1.0e-10, size_t max_iterations = 50)
+        : tolerance_(tolerance), max_iterations_(max_iterations){};
+
+    void setTolerance(Real tolerance) { tolerance_ = tolerance; };
+    void setMaxIterations(size_t max_iterations) { max_iterations_ = max_iterations; };
+    Real Tolerance() { return tolerance_; };
+    size_t MaxIterations() { return max_iterations_; };
+    size_t NumberOfNonConvergedSolves() { return number_of_non_converged_solves_.load(); };
+    void resetNumberOfNonConvergedSolves() { number_of_non_converged_solves_ = 0; };
+
+    /**
+     * The function returns the residual and its derivative, whose signs at the lower and upper bounds differ.
+     * The residual scale defines the convergence tolerance of the residual.
+     */
+    template <class FunctionAndDerivative>
+    Real solve(const FunctionAndDerivative &function, Real lower, Real upper, Real initial_guess, Real residual_scale)
+    {
+        Real residual_tolerance = tolerance_ * ABS(residual_scale);
+        Real lower_residual = function(lower).first;
+        if (ABS(lower_residual) <= residual_tolerance)
+            return lower;
+        bool is_lower_negative = lower_residual < 0.0;
+
+        Real x = clamp(initial_guess, lower, upper);
+        Real previous_residual = MaxReal;
+        for (size_t k = 0; k != max_iterations_; ++k)
+        {
+            std::pair<Real, Real> residual_and_derivative = function(x);
+            Real residual = residual_and_derivative.first;
+            if (ABS(residual) <= residual_tolerance)
+                return x;
+
+            if ((residual < 0.0) == is_lower_negative)
+            {
+                lower = x;
+            }
+            else
+            {
+                upper = x;
+            }
+            if (upper - lower <= tolerance_ * ABS(x))
+                return x;
+
+            Real derivative = residual_and_derivative.second;
+            Real x_newton = x - residual / (derivative + TinyReal);
+            bool is_newton_acceptable = x_newton > lower && x_newton < upper &&
+                                        ABS(residual) < 0.5 * ABS(previous_residual) && std::isfinite(x_newton);
+            x = is_newton_acceptable ? x_newton : 0.5 * (lower + upper);
+            previous_residual = residual;
+        }
+        number_of_non_converged_solves_++;
+        return x;
+    };
+
+  protected:
+    Real tolerance_;
+    size_t max_iterations_;
+    std::atomic<size_t> number_of_non_converged_solves_{0};
+};
+} // namespace SPH
+#endif // SCALAR_ROOT_FINDING_H
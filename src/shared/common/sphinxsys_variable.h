@@ -78,10 +78,22 @@ class SingularVariable : public Entity
 
     DataType *ValueAddress() { return delegated_; };
 
-    void setValue(const DataType &value) { *delegated_ = value; };
-    DataType getValue() { return *delegated_; };
+    void setValue(const DataType &value)
+    {
+        synchronizeDelegate();
+        *delegated_ = value;
+    };
+    DataType getValue()
+    {
+        synchronizeDelegate();
+        return *delegated_;
+    };
 
-    void incrementValue(const DataType &value) { *delegated_ += value; };
+    void incrementValue(const DataType &value)
+    {
+        synchronizeDelegate();
+        *delegated_ += value;
+    };
 
     template <class ExecutionPolicy>
     DataType *DelegatedData(const ExecutionPolicy &ex_policy) { return delegated_; };
@@ -96,11 +108,23 @@ class SingularVariable : public Entity
         return delegated_;
     };
     bool isValueDelegated() { return value_ != delegated_; };
-    void setDelegateValueAddress(DataType *new_delegated) { delegated_ = new_delegated; };
+    /** The synchronizer completes the device work which may access the delegated value. */
+    void setDelegateValueAddress(DataType *new_delegated, void (*synchronizer)() = nullptr)
+    {
+        delegated_ = new_delegated;
+        delegate_synchronizer_ = synchronizer;
+    };
 
   protected:
     DataType *value_;
     DataType *delegated_;
+    void (*delegate_synchronizer_)() = nullptr;
+
+    void synchronizeDelegate()
+    {
+        if (delegate_synchronizer_ != nullptr)
+            delegate_synchronizer_();
+    };
 };
 
 template <typename DataType>
@@ -6,13 +6,18 @@ namespace SPH
 BoundingBox Shape::getBounds()
 {
     if (!is_bounds_found_)
-    {
-        bounding_box_ = findBounds();
-        is_bounds_found_ = true;
-    }
+        updateBounds();
     return bounding_box_;
 }
 //=================================================================================================//
+void Shape::updateBounds()
+{
+    bounding_box_ = findBounds();
+    is_bounds_found_ = true;
+    if (parent_shape_ != nullptr)
+        parent_shape_->updateBounds();
+}
+//=================================================================================================//
 bool Shape::checkNotFar(const Vecd &probe_point, Real threshold)
 {
     return checkContain(probe_point) || checkNearSurface(probe_point, threshold) ? true : false;
@@ -30,6 +35,17 @@ Real Shape::findSignedDistance(const Vecd &probe_point)
     return checkContain(probe_point) ? -distance_to_surface : distance_to_surface;
 }
 //=================================================================================================//
+StdVec<Real> Shape::findSignedDistances(const StdVec<Vecd> &probe_points)
+{
+    StdVec<Real> signed_distances;
+    signed_distances.reserve(probe_points.size());
+    for (const Vecd &probe_point : probe_points)
+    {
+        signed_distances.push_back(findSignedDistance(probe_point));
+    }
+    return signed_distances;
+}
+//=================================================================================================//
 Vecd Shape::findNormalDirection(const Vecd &probe_point)
 {
     bool is_contain = checkContain(probe_point);
@@ -46,16 +62,44 @@ Vecd Shape::findNormalDirection(const Vecd &probe_point)
     return is_contain ? direction_to_surface : -1.0 * direction_to_surface;
 }
 //=================================================================================================//
+std::pair<Real, Vecd> Shape::findSignedDistanceAndNormal(const Vecd &probe_point)
+{
+    bool is_contain = checkContain(probe_point);
+    Vecd displacement_to_surface = findClosestPoint(probe_point) - probe_point;
+    Real distance_to_surface = displacement_to_surface.norm();
+    if (distance_to_surface < Eps)
+        return std::make_pair(is_contain ? -distance_to_surface : distance_to_surface, findNormalDirection(probe_point));
+
+    Vecd direction_to_surface = displacement_to_surface / distance_to_surface;
+    return is_contain ? std::make_pair(-distance_to_surface, direction_to_surface)
+                      : std::make_pair(distance_to_surface, Vecd(-1.0 * direction_to_surface));
+}
+//=================================================================================================//
+Real Shape::findDistanceToBounds(const Vecd &probe_point)
+{
+    BoundingBox bounds = getBounds();
+    Vecd outside = (bounds.first_ - probe_point).cwiseMax(probe_point - bounds.second_).cwiseMax(Vecd::Zero());
+    return outside.norm();
+}
+//=================================================================================================//
 bool BinaryShapes::isValid()
 {
     return sub_shapes_and_ops_.size() == 0 ? false : true;
 }
 //=================================================================================================//
+void BinaryShapes::addSubShapeAndOp(Shape *sub_shape, ShapeBooleanOps operation)
+{
+    sub_shape->getBounds();
+    sub_shape->setParentShape(this);
+    sub_shapes_and_ops_.push_back(SubShapeAndOp(sub_shape, operation));
+    is_bounds_found_ = false;
+}
+//=================================================================================================//
 BoundingBox BinaryShapes::findBounds()
 {
     // initial reference values
     Vecd lower_bound = MaxReal * Vecd::Ones();
-    Vecd upper_bound = MinReal * Vecd::Ones();
+    Vecd upper_bound = -MaxReal * Vecd::Ones();
 
     for (auto &sub_shape_and_op : sub_shapes_and_ops_)
     {
@@ -71,25 +115,59 @@ BoundingBox BinaryShapes::findBounds()
 //=================================================================================================//
 bool BinaryShapes::checkContain(const Vecd &pnt, bool BOUNDARY_INCLUDED)
 {
-    bool exist = false;
-    bool inside = false;
+    // the last sub-shape containing the point decides
+    for (auto it = sub_shapes_and_ops_.rbegin(); it != sub_shapes_and_ops_.rend(); ++it)
+    {
+        Shape *geometry = it->first;
+        ShapeBooleanOps operation_string = it->second;
+        if (operation_string != ShapeBooleanOps::add && operation_string != ShapeBooleanOps::sub)
+        {
+            std::cout << "\n FAILURE: the boolean operation is not applicable!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            throw;
+        }
 
+        if (geometry->findDistanceToBounds(pnt) <= 0.0 && geometry->checkContain(pnt))
+        {
+            return operation_string == ShapeBooleanOps::add;
+        }
+    }
+    return false;
+}
+//=================================================================================================//
+std::pair<Real, SubShapeAndOp *> BinaryShapes::findSignedDistanceBySubShapes(const Vecd &probe_point)
+{
+    Real signed_distance = MaxReal;
+    SubShapeAndOp *closest_sub_shape_and_op = nullptr;
     for (auto &sub_shape_and_op : sub_shapes_and_ops_)
     {
         Shape *geometry = sub_shape_and_op.first;
-        ShapeBooleanOps operation_string = sub_shape_and_op.second;
-        switch (operation_string)
+        // the sub-shape distance is larger than this lower bound if the point is out of the bounds
+        Real distance_to_bounds = geometry->findDistanceToBounds(probe_point);
+        switch (sub_shape_and_op.second)
         {
         case ShapeBooleanOps::add:
         {
-            inside = geometry->checkContain(pnt);
-            exist = exist || inside;
+            if (distance_to_bounds > 0.0 && distance_to_bounds >= signed_distance)
+                break;
+            Real sub_shape_distance = geometry->findSignedDistance(probe_point);
+            if (sub_shape_distance < signed_distance)
+            {
+                signed_distance = sub_shape_distance;
+                closest_sub_shape_and_op = &sub_shape_and_op;
+            }
             break;
         }
         case ShapeBooleanOps::sub:
         {
-            inside = geometry->checkContain(pnt);
-            exist = exist && (!inside);
+            if (distance_to_bounds > 0.0 && -distance_to_bounds <= signed_distance)
+                break;
+            Real sub_shape_distance = -geometry->findSignedDistance(probe_point);
+            if (sub_shape_distance > signed_distance)
+            {
+                signed_distance = sub_shape_distance;
+                closest_sub_shape_and_op = &sub_shape_and_op;
+            }
             break;
         }
         default:
@@ -100,31 +178,31 @@ bool BinaryShapes::checkContain(const Vecd &pnt, bool BOUNDARY_INCLUDED)
         }
         }
     }
-    return exist;
+    return std::make_pair(signed_distance, closest_sub_shape_and_op);
 }
 //=================================================================================================//
 Vecd BinaryShapes::findClosestPoint(const Vecd &probe_point)
 {
-    // a big positive number
-    Real large_number(MaxReal);
-    Real dist_min = large_number;
-    Vecd pnt_closest = Vecd::Zero();
-    Vecd pnt_found = Vecd::Zero();
-
-    for (auto &sub_shape_and_op : sub_shapes_and_ops_)
-    {
-        Shape *geometry = sub_shape_and_op.first;
-        pnt_found = geometry->findClosestPoint(probe_point);
-        Real dist = (probe_point - pnt_found).norm();
-
-        if (dist <= dist_min)
-        {
-            dist_min = dist;
-            pnt_closest = pnt_found;
-        }
-    }
+    SubShapeAndOp *closest_sub_shape_and_op = findSignedDistanceBySubShapes(probe_point).second;
+    return closest_sub_shape_and_op == nullptr ? probe_point
+                                               : closest_sub_shape_and_op->first->findClosestPoint(probe_point);
+}
+//=================================================================================================//
+Real BinaryShapes::findSignedDistance(const Vecd &probe_point)
+{
+    return findSignedDistanceBySubShapes(probe_point).first;
+}
+//=================================================================================================//
+std::pair<Real, Vecd> BinaryShapes::findSignedDistanceAndNormal(const Vecd &probe_point)
+{
+    std::pair<Real, SubShapeAndOp *> distance_and_sub_shape = findSignedDistanceBySubShapes(probe_point);
+    SubShapeAndOp *closest_sub_shape_and_op = distance_and_sub_shape.second;
+    if (closest_sub_shape_and_op == nullptr)
+        return Shape::findSignedDistanceAndNormal(probe_point);
 
-    return pnt_closest;
+    Vecd normal = closest_sub_shape_and_op->first->findSignedDistanceAndNormal(probe_point).second;
+    return std::make_pair(distance_and_sub_shape.first,
+                          closest_sub_shape_and_op->second == ShapeBooleanOps::sub ? Vecd(-normal) : normal);
 }
 //=================================================================================================//
 SubShapeAndOp *BinaryShapes::getSubShapeAndOpByName(const std::string &name)
@@ -65,11 +65,14 @@ class Shape
   public:
     BoundingBox bounding_box_;
 
-    explicit Shape(const std::string &shape_name) : name_(shape_name), is_bounds_found_(false){};
+    explicit Shape(const std::string &shape_name)
+        : name_(shape_name), is_bounds_found_(false), parent_shape_(nullptr){};
     virtual ~Shape(){};
 
     std::string getName() { return name_; };
     void setName(const std::string &name) { name_ = name; };
+    /** set when the shape is added to the binary shapes, whose bounds are then updated together */
+    void setParentShape(Shape *parent_shape) { parent_shape_ = parent_shape; };
     BoundingBox getBounds();
     virtual bool isValid() { return true; };
     virtual bool checkContain(const Vecd &pnt, bool BOUNDARY_INCLUDED = true) = 0;
@@ -78,15 +81,28 @@ class Shape
     bool checkNotFar(const Vecd &probe_point, Real threshold);
     bool checkNearSurface(const Vecd &probe_point, Real threshold);
     /** Signed distance is negative for point within the shape. */
-    Real findSignedDistance(const Vecd &probe_point);
+    virtual Real findSignedDistance(const Vecd &probe_point);
+    /** Signed distances of a batch of probe points, which shapes with spatial indices may answer faster. */
+    virtual StdVec<Real> findSignedDistances(const StdVec<Vecd> &probe_points);
     /** Normal direction point toward outside of the shape. */
     Vecd findNormalDirection(const Vecd &probe_point);
+    /** Signed distance and outward normal direction from a single closest-point and containment query. */
+    virtual std::pair<Real, Vecd> findSignedDistanceAndNormal(const Vecd &probe_point);
+    /** Distance from the probe point to the bounding box, zero for point within the bounds. */
+    Real findDistanceToBounds(const Vecd &probe_point);
 
   protected:
     std::string name_;
     bool is_bounds_found_;
+    /** the binary shapes which this shape is a sub-shape of */
+    Shape *parent_shape_;
 
     virtual BoundingBox findBounds() = 0;
+    /**
+     * find the bounds again after the shape is changed, so that concurrent queries only read them,
+     * and also those of the parent shape, which enclose the bounds of this shape
+     */
+    void updateBounds();
 };
 
 using SubShapeAndOp = std::pair<Shape *, ShapeBooleanOps>;
@@ -96,6 +112,8 @@ using SubShapeAndOp = std::pair<Shape *, ShapeBooleanOps>;
  * This class has ownership of all shapes by using a unique pointer vector.
  * In this way, add or subtract a shape will call the shape's constructor other than
  * passing the shape pointer.
+ * The operations are applied in the order the sub-shapes are added.
+ * Hence, a point is contained if the last sub-shape containing it is an added one.
  */
 class BinaryShapes : public Shape
 {
@@ -108,21 +126,21 @@ class BinaryShapes : public Shape
     void add(Args &&... args)
     {
         Shape *sub_shape = sub_shape_ptrs_keeper_.createPtr<SubShapeType>(std::forward<Args>(args)...);
-        SubShapeAndOp sub_shape_and_op(sub_shape, ShapeBooleanOps::add);
-        sub_shapes_and_ops_.push_back(sub_shape_and_op);
+        addSubShapeAndOp(sub_shape, ShapeBooleanOps::add);
     };
 
     template <class SubShapeType, typename... Args>
     void subtract(Args &&... args)
     {
         Shape *sub_shape = sub_shape_ptrs_keeper_.createPtr<SubShapeType>(std::forward<Args>(args)...);
-        SubShapeAndOp sub_shape_and_op(sub_shape, ShapeBooleanOps::sub);
-        sub_shapes_and_ops_.push_back(sub_shape_and_op);
+        addSubShapeAndOp(sub_shape, ShapeBooleanOps::sub);
     };
 
     virtual bool isValid() override;
     virtual bool checkContain(const Vecd &pnt, bool BOUNDARY_INCLUDED = true) override;
     virtual Vecd findClosestPoint(const Vecd &probe_point) override;
+    virtual Real findSignedDistance(const Vecd &probe_point) override;
+    virtual std::pair<Real, Vecd> findSignedDistanceAndNormal(const Vecd &probe_point) override;
     Shape *getSubShapeByName(const std::string &name);
     SubShapeAndOp *getSubShapeAndOpByName(const std::string &name);
     size_t getSubShapeIndexByName(const std::string &name);
@@ -131,7 +149,19 @@ class BinaryShapes : public Shape
     UniquePtrsKeeper<Shape> sub_shape_ptrs_keeper_;
     StdVec<SubShapeAndOp> sub_shapes_and_ops_;
 
+    /**
+     * The bounds of the sub-shape are found here once, as the queries,
+     * which may run concurrently in particle loops, only read them.
+     */
+    void addSubShapeAndOp(Shape *sub_shape, ShapeBooleanOps operation);
     virtual BoundingBox findBounds() override;
+    /**
+     * Signed distance by the constructive solid geometry of the sub-shapes,
+     * i.e. the minimum for union and the maximum of the current and negative sub-shape distance for subtraction.
+     * Sub-shapes whose bounding boxes are farther than the current distance are skipped.
+     * The sub-shape which determines the distance is also returned.
+     */
+    std::pair<Real, SubShapeAndOp *> findSignedDistanceBySubShapes(const Vecd &probe_point);
 };
 
 /**
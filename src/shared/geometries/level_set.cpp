@@ -38,8 +38,7 @@ LevelSet::LevelSet(BoundingBox tentative_bounds, Real data_spacing, size_t buffe
       phi_(*registerMeshVariable<Real>("Levelset")),
       near_interface_id_(*registerMeshVariable<int>("NearInterfaceID")),
       phi_gradient_(*registerMeshVariable<Vecd>("LevelsetGradient")),
-      kernel_weight_(*registerMeshVariable<Real>("KernelWeight")),
-      kernel_gradient_(*registerMeshVariable<Vecd>("KernelGradient")),
+      kernel_weight_("KernelWeight", 0), kernel_gradient_("KernelGradient", 0),
       kernel_(*sph_adaptation.getKernel()) {}
 //=================================================================================================//
 LevelSet::LevelSet(BoundingBox tentative_bounds, Real data_spacing,
@@ -78,7 +77,7 @@ void LevelSet::finishDataPackages()
         });
 
     updateLevelSetGradient();
-    updateKernelIntegrals();
+    resetKernelIntegrals();
 }
 //=================================================================================================//
 void LevelSet::initializeIndexMesh()
@@ -100,6 +99,19 @@ bool LevelSet::isWithinCorePackage(Vecd position)
     return isCoreDataPackage(cell_index);
 }
 //=================================================================================================//
+void LevelSet::flattenIndexMesh(UnsignedInt package_offset, int *cell_category, UnsignedInt *cell_package_index)
+{
+    mesh_parallel_for(MeshRange(Arrayi::Zero(), all_cells_),
+                      [&](const Arrayi &cell_index)
+                      {
+                          size_t linear_index = LinearCellIndexFromCellIndex(cell_index);
+                          cell_category[linear_index] = isCoreDataPackage(cell_index)    ? 2
+                                                        : isInnerDataPackage(cell_index) ? 1
+                                                                                         : 0;
+                          cell_package_index[linear_index] = package_offset + PackageIndexFromCellIndex(cell_index);
+                      });
+}
+//=================================================================================================//
 void LevelSet::updateLevelSetGradient()
 {
     package_parallel_for(
@@ -109,10 +121,41 @@ void LevelSet::updateLevelSetGradient()
         });
 }
 //=================================================================================================//
-void LevelSet::updateKernelIntegrals()
+void LevelSet::resetKernelIntegrals()
 {
-    package_parallel_for(
-        [&](size_t package_index)
+    kernel_integrals_updated_.reset(new std::once_flag[num_grid_pkgs_]);
+}
+//=================================================================================================//
+void LevelSet::allocateKernelIntegrals()
+{
+    if (!is_kernel_integrals_needed_)
+    {
+        std::cout << "\n Error: the kernel integrals of " << name_ << " are probed after being disabled!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    std::call_once(
+        kernel_integrals_allocated_,
+        [&]()
+        {
+            kernel_weight_.allocateAllMeshVariableData(num_grid_pkgs_);
+            kernel_gradient_.allocateAllMeshVariableData(num_grid_pkgs_);
+
+            Real far_field_distance = grid_spacing_ * (Real)buffer_width_;
+            initializeKernelIntegralsForSingularPackage(0, -far_field_distance);
+            initializeKernelIntegralsForSingularPackage(1, far_field_distance);
+        });
+}
+//=================================================================================================//
+void LevelSet::updateKernelIntegrals(const size_t package_index)
+{
+    if (package_index < 2)
+        return; // the singular packages are initialized at allocation
+
+    std::call_once(
+        kernel_integrals_updated_[package_index],
+        [&]()
         {
             Arrayi cell_index = meta_data_cell_[package_index].first;
             assignByPosition(
@@ -124,6 +167,30 @@ void LevelSet::updateKernelIntegrals()
         });
 }
 //=================================================================================================//
+void LevelSet::prepareKernelIntegrals(const Arrayi &cell_index)
+{
+    allocateKernelIntegrals();
+    if (isInnerDataPackage(cell_index))
+    {
+        // the interpolation within a package uses the data from its neighbor packages
+        mesh_for_each(-Arrayi::Ones(), 2 * Arrayi::Ones(),
+                      [&](const Arrayi &shift)
+                      {
+                          updateKernelIntegrals(PackageIndexFromCellIndex(cell_index + shift));
+                      });
+    }
+}
+//=================================================================================================//
+void LevelSet::prepareAllKernelIntegrals()
+{
+    allocateKernelIntegrals();
+    package_parallel_for(
+        [&](size_t package_index)
+        {
+            updateKernelIntegrals(package_index);
+        });
+}
+//=================================================================================================//
 Vecd LevelSet::probeNormalDirection(const Vecd &position)
 {
     Vecd probed_value = probeLevelSetGradient(position);
@@ -151,11 +218,13 @@ Real LevelSet::probeSignedDistance(const Vecd &position)
 //=================================================================================================//
 Real LevelSet::probeKernelIntegral(const Vecd &position, Real h_ratio)
 {
+    prepareKernelIntegrals(CellIndexFromPosition(position));
     return probeMesh(kernel_weight_, position);
 }
 //=================================================================================================//
 Vecd LevelSet::probeKernelGradientIntegral(const Vecd &position, Real h_ratio)
 {
+    prepareKernelIntegrals(CellIndexFromPosition(position));
     return probeMesh(kernel_gradient_, position);
 }
 //=================================================================================================//
@@ -178,7 +247,7 @@ void LevelSet::cleanInterface(Real small_shift_factor)
     redistanceInterface();
     reinitializeLevelSet();
     updateLevelSetGradient();
-    updateKernelIntegrals();
+    resetKernelIntegrals();
 }
 //=============================================================================================//
 void LevelSet::correctTopology(Real small_shift_factor)
@@ -187,7 +256,7 @@ void LevelSet::correctTopology(Real small_shift_factor)
     for (size_t i = 0; i != 10; ++i)
         diffuseLevelSetSign();
     updateLevelSetGradient();
-    updateKernelIntegrals();
+    resetKernelIntegrals();
 }
 //=================================================================================================//
 bool LevelSet::probeIsWithinMeshBound(const Vecd &position)
@@ -358,6 +427,12 @@ Vecd MultilevelLevelSet::probeKernelGradientIntegral(const Vecd &position, Real
     return alpha * coarse_level_value + (1.0 - alpha) * fine_level_value;
 }
 //=================================================================================================//
+void MultilevelLevelSet::disableKernelIntegrals()
+{
+    for (size_t l = 0; l != total_levels_; ++l)
+        mesh_levels_[l]->disableKernelIntegrals();
+}
+//=================================================================================================//
 bool MultilevelLevelSet::probeIsWithinMeshBound(const Vecd &position)
 {
     bool is_bounded = true;
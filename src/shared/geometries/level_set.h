@@ -55,6 +55,8 @@ class BaseLevelSet : public BaseMeshField
     virtual Vecd probeLevelSetGradient(const Vecd &position) = 0;
     virtual Real probeKernelIntegral(const Vecd &position, Real h_ratio = 1.0) = 0;
     virtual Vecd probeKernelGradientIntegral(const Vecd &position, Real h_ratio = 1.0) = 0;
+    /** declare that the kernel integrals will not be probed, so that they are never allocated. */
+    virtual void disableKernelIntegrals() = 0;
 
   protected:
     Shape &shape_; /**< the geometry is described by the level set. */
@@ -96,20 +98,37 @@ class LevelSet : public MeshWithGridDataPackages<4>,
     virtual Vecd probeLevelSetGradient(const Vecd &position) override;
     virtual Real probeKernelIntegral(const Vecd &position, Real h_ratio = 1.0) override;
     virtual Vecd probeKernelGradientIntegral(const Vecd &position, Real h_ratio = 1.0) override;
+    virtual void disableKernelIntegrals() override { is_kernel_integrals_needed_ = false; };
     virtual void writeMeshFieldToPlt(std::ofstream &output_file) override;
     bool isWithinCorePackage(Vecd position);
     Real computeKernelIntegral(const Vecd &position);
     Vecd computeKernelGradientIntegral(const Vecd &position);
+    /** the number of data packages including the two singular ones. */
+    size_t NumberOfDataPackages() { return num_grid_pkgs_; };
+    /** copy the category and the package index of all cells into contiguous arrays. */
+    void flattenIndexMesh(UnsignedInt package_offset, int *cell_category, UnsignedInt *cell_package_index);
+    /** compute the kernel integrals of all packages which are not computed yet. */
+    void prepareAllKernelIntegrals();
+    /** copy the package neighborhoods and the package data into contiguous arrays,
+     *  with zero kernel integrals if they are disabled. */
+    void flattenDataPackages(UnsignedInt package_offset, UnsignedInt *package_neighbor,
+                             Real *phi, Vecd *phi_gradient, Real *kernel_weight, Vecd *kernel_gradient);
 
   protected:
     MeshVariable<Real> &phi_;
     MeshVariable<int> &near_interface_id_;
     MeshVariable<Vecd> &phi_gradient_;
-    MeshVariable<Real> &kernel_weight_;
-    MeshVariable<Vecd> &kernel_gradient_;
+    /** The kernel integrals are not registered with the other mesh variables,
+     *  as they are allocated and computed package by package at the first probe. */
+    MeshVariable<Real> kernel_weight_;
+    MeshVariable<Vecd> kernel_gradient_;
     Kernel &kernel_;
+    bool is_kernel_integrals_needed_ = true;
+    std::once_flag kernel_integrals_allocated_;
+    UniquePtr<std::once_flag[]> kernel_integrals_updated_; /**< one flag for each package. */
 
     void initializeDataForSingularPackage(const size_t package_index, Real far_field_level_set);
+    void initializeKernelIntegralsForSingularPackage(const size_t package_index, Real far_field_level_set);
     void initializeBasicDataForAPackage(const Arrayi &cell_index, const size_t package_index, Shape &shape);
     void redistanceInterfaceForAPackage(const size_t package_index);
 
@@ -118,7 +137,11 @@ class LevelSet : public MeshWithGridDataPackages<4>,
     void markNearInterface(Real small_shift_factor);
     void redistanceInterface();
     void diffuseLevelSetSign();
-    void updateKernelIntegrals();
+    void resetKernelIntegrals();
+    void allocateKernelIntegrals();
+    void updateKernelIntegrals(const size_t package_index);
+    /** make sure the kernel integrals used for probing within a cell are computed. */
+    void prepareKernelIntegrals(const Arrayi &cell_index);
     bool isInnerPackage(const Arrayi &cell_index);
     void initializeDataInACell(const Arrayi &cell_index);
     void tagACellIsInnerPackage(const Arrayi &cell_index);
@@ -159,6 +182,7 @@ class MultilevelLevelSet : public MultilevelMesh<BaseLevelSet, LevelSet>
     virtual Vecd probeLevelSetGradient(const Vecd &position) override;
     virtual Real probeKernelIntegral(const Vecd &position, Real h_ratio = 1.0) override;
     virtual Vecd probeKernelGradientIntegral(const Vecd &position, Real h_ratio = 1.0) override;
+    virtual void disableKernelIntegrals() override;
 
   protected:
     inline size_t getProbeLevel(const Vecd &position);
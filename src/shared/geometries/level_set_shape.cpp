@@ -31,6 +31,15 @@ void LevelSetShape::writeLevelSet(SPHSystem &sph_system)
     write_level_set_to_plt.writeToFile(0);
 }
 //=================================================================================================//
+LevelSetCK &LevelSetShape::getLevelSetCK()
+{
+    if (level_set_ck_ == nullptr)
+    {
+        level_set_ck_ = level_set_ck_keeper_.createPtr<LevelSetCK>(level_set_);
+    }
+    return *level_set_ck_;
+}
+//=================================================================================================//
 LevelSetShape *LevelSetShape::cleanLevelSet(Real small_shift_factor)
 {
     level_set_.cleanInterface(small_shift_factor);
@@ -43,6 +52,12 @@ LevelSetShape *LevelSetShape::correctLevelSetSign(Real small_shift_factor)
     return this;
 }
 //=================================================================================================//
+LevelSetShape *LevelSetShape::disableKernelIntegrals()
+{
+    level_set_.disableKernelIntegrals();
+    return this;
+}
+//=================================================================================================//
 bool LevelSetShape::checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED)
 {
     return level_set_.probeSignedDistance(probe_point) < 0.0 ? true : false;
@@ -55,6 +70,16 @@ Vecd LevelSetShape::findClosestPoint(const Vecd &probe_point)
     return probe_point - phi * normal;
 }
 //=================================================================================================//
+Real LevelSetShape::findSignedDistance(const Vecd &probe_point)
+{
+    return level_set_.probeSignedDistance(probe_point);
+}
+//=================================================================================================//
+std::pair<Real, Vecd> LevelSetShape::findSignedDistanceAndNormal(const Vecd &probe_point)
+{
+    return std::make_pair(level_set_.probeSignedDistance(probe_point), level_set_.probeNormalDirection(probe_point));
+}
+//=================================================================================================//
 BoundingBox LevelSetShape::findBounds()
 {
     if (!is_bounds_found_)
@@ -31,6 +31,7 @@
 
 #include "base_geometry.h"
 #include "level_set.h"
+#include "level_set_ck.h"
 
 #include <string>
 
@@ -47,6 +48,8 @@ class LevelSetShape : public Shape
   private:
     UniquePtrKeeper<BaseLevelSet> level_set_keeper_;
     SharedPtr<SPHAdaptation> sph_adaptation_;
+    UniquePtrKeeper<LevelSetCK> level_set_ck_keeper_;
+    LevelSetCK *level_set_ck_ = nullptr;
 
   public:
     /** refinement_ratio is between body reference resolution and level set resolution */
@@ -57,6 +60,8 @@ class LevelSetShape : public Shape
 
     virtual bool checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED = true) override;
     virtual Vecd findClosestPoint(const Vecd &probe_point) override;
+    virtual Real findSignedDistance(const Vecd &probe_point) override;
+    virtual std::pair<Real, Vecd> findSignedDistanceAndNormal(const Vecd &probe_point) override;
 
     Vecd findLevelSetGradient(const Vecd &probe_point);
     Real computeKernelIntegral(const Vecd &probe_point, Real h_ratio = 1.0);
@@ -65,7 +70,11 @@ class LevelSetShape : public Shape
     LevelSetShape *cleanLevelSet(Real small_shift_factor = 1.0);
     /** required to build level set from triangular mesh in stl file format. */
     LevelSetShape *correctLevelSetSign(Real small_shift_factor = 1.0);
+    /** for shapes never used for relaxation or kernel corrections, such as walls and observers. */
+    LevelSetShape *disableKernelIntegrals();
     void writeLevelSet(SPHSystem &sph_system);
+    /** flattened level set for computing kernels, created at the first request. */
+    LevelSetCK &getLevelSetCK();
 
   protected:
     BaseLevelSet &level_set_; /**< narrow bounded level set mesh. */
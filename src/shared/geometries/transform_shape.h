@@ -54,7 +54,11 @@ class TransformShape : public BaseShapeType
 
     /** variable transform is introduced here */
     Transform &getTransform() { return transform_; };
-    void setTransform(const Transform &transform) { transform_ = transform; };
+    void setTransform(const Transform &transform)
+    {
+        transform_ = transform;
+        this->updateBounds();
+    };
 
     virtual bool checkContain(const Vecd &probe_point, bool BOUNDARY_INCLUDED = true) override
     {
@@ -69,14 +73,76 @@ class TransformShape : public BaseShapeType
         return transform_.shiftFrameStationToBase(closest_point_origin);
     };
 
+    virtual Real findSignedDistance(const Vecd &probe_point) override
+    {
+        if constexpr (has_own_signed_distance_)
+            return BaseShapeType::findSignedDistance(transform_.shiftBaseStationToFrame(probe_point));
+        else
+            return Shape::findSignedDistance(probe_point);
+    };
+
+    virtual StdVec<Real> findSignedDistances(const StdVec<Vecd> &probe_points) override
+    {
+        if constexpr (has_own_signed_distances_)
+        {
+            StdVec<Vecd> input_pnts_origin;
+            input_pnts_origin.reserve(probe_points.size());
+            for (const Vecd &probe_point : probe_points)
+                input_pnts_origin.push_back(transform_.shiftBaseStationToFrame(probe_point));
+            return BaseShapeType::findSignedDistances(input_pnts_origin);
+        }
+        else
+            return Shape::findSignedDistances(probe_points);
+    };
+
+    virtual std::pair<Real, Vecd> findSignedDistanceAndNormal(const Vecd &probe_point) override
+    {
+        if constexpr (has_own_signed_distance_and_normal_)
+        {
+            std::pair<Real, Vecd> distance_and_normal_origin =
+                BaseShapeType::findSignedDistanceAndNormal(transform_.shiftBaseStationToFrame(probe_point));
+            return std::make_pair(distance_and_normal_origin.first,
+                                  transform_.xformFrameVecToBase(distance_and_normal_origin.second));
+        }
+        else
+            return Shape::findSignedDistanceAndNormal(probe_point);
+    };
+
   protected:
     Transform transform_;
+    /**
+     * The signed distance functions of the base shape are used in the frame
+     * only if it overrides them, e.g. binary shapes.
+     * Otherwise, the default ones call back the transformed closest point and containment,
+     * and so are used directly.
+     */
+    static constexpr bool has_own_signed_distance_ =
+        !std::is_same_v<decltype(&BaseShapeType::findSignedDistance), Real (Shape::*)(const Vecd &)>;
+    static constexpr bool has_own_signed_distances_ =
+        !std::is_same_v<decltype(&BaseShapeType::findSignedDistances), StdVec<Real> (Shape::*)(const StdVec<Vecd> &)>;
+    static constexpr bool has_own_signed_distance_and_normal_ =
+        !std::is_same_v<decltype(&BaseShapeType::findSignedDistanceAndNormal),
+                        std::pair<Real, Vecd> (Shape::*)(const Vecd &)>;
 
+    /** The bounds enclose all transformed corners so that they remain valid under rotation. */
     virtual BoundingBox findBounds() override
     {
         BoundingBox original_bound = BaseShapeType::findBounds();
-        return BoundingBox(transform_.shiftFrameStationToBase(original_bound.first_),
-                           transform_.shiftFrameStationToBase(original_bound.second_));
+        Vecd lower_bound = MaxReal * Vecd::Ones();
+        Vecd upper_bound = -MaxReal * Vecd::Ones();
+        for (int corner = 0; corner != (1 << Dimensions); ++corner)
+        {
+            Vecd original_corner = original_bound.first_;
+            for (int j = 0; j != Dimensions; ++j)
+            {
+                if (corner & (1 << j))
+                    original_corner[j] = original_bound.second_[j];
+            }
+            Vecd transformed_corner = transform_.shiftFrameStationToBase(original_corner);
+            lower_bound = lower_bound.cwiseMin(transformed_corner);
+            upper_bound = upper_bound.cwiseMax(transformed_corner);
+        }
+        return BoundingBox(lower_bound, upper_bound);
     };
 };
 } // namespace SPH
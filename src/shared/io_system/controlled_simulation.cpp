@@ -0,0 +1,103 @@
+#include "controlled_simulation.h"
+
+namespace SPH
+{
+//=============================================================================================//
+void ControlledSimulation::addActuator(const std::string &name, const std::function<void(Real)> &actuator,
+                                       Real initial_action)
+{
+    actuators_.push_back(Actuator{name, actuator, initial_action});
+}
+//=============================================================================================//
+void ControlledSimulation::
+    addObservable(const std::string &name, size_t size, const std::function<void(Real *)> &observer)
+{
+    observables_.push_back(Observable{name, observation_size_, size, observer});
+    observation_size_ += size;
+}
+//=============================================================================================//
+StdVec<std::string> ControlledSimulation::ActuatorNames()
+{
+    StdVec<std::string> names;
+    for (const Actuator &actuator : actuators_)
+        names.push_back(actuator.name_);
+    return names;
+}
+//=============================================================================================//
+StdVec<std::string> ControlledSimulation::ObservableNames()
+{
+    StdVec<std::string> names;
+    for (const Observable &observable : observables_)
+        names.push_back(observable.name_);
+    return names;
+}
+//=============================================================================================//
+ControlledSimulation::Observable &ControlledSimulation::getObservable(const std::string &name)
+{
+    for (Observable &observable : observables_)
+    {
+        if (observable.name_ == name)
+            return observable;
+    }
+    std::cout << "\n Error: the observable " << name << " is not registered!" << std::endl;
+    std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+    exit(1);
+}
+//=============================================================================================//
+size_t ControlledSimulation::ObservableOffset(const std::string &name)
+{
+    return getObservable(name).offset_;
+}
+//=============================================================================================//
+size_t ControlledSimulation::ObservableSize(const std::string &name)
+{
+    return getObservable(name).size_;
+}
+//=============================================================================================//
+void ControlledSimulation::setActions(const Real *actions)
+{
+    for (size_t k = 0; k != actuators_.size(); ++k)
+        actuators_[k].action_ = actions[k];
+}
+//=============================================================================================//
+void ControlledSimulation::applyActuators()
+{
+    for (Actuator &actuator : actuators_)
+        actuator.apply_(actuator.action_);
+}
+//=============================================================================================//
+void ControlledSimulation::observe(Real *observations)
+{
+    for (Observable &observable : observables_)
+        observable.observe_(observations + observable.offset_);
+}
+//=============================================================================================//
+StdVec<Real> ControlledSimulation::observe()
+{
+    StdVec<Real> observations(observation_size_);
+    observe(observations.data());
+    return observations;
+}
+//=============================================================================================//
+void ControlledSimulation::step(const Real *actions, Real duration, Real *observations)
+{
+    setActions(actions);
+    advance(duration);
+    observe(observations);
+}
+//=============================================================================================//
+StdVec<Real> ControlledSimulation::step(const StdVec<Real> &actions, Real duration)
+{
+    if (actions.size() != actuators_.size())
+    {
+        std::cout << "\n Error: " << actions.size() << " actions are given for "
+                  << actuators_.size() << " actuators!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    StdVec<Real> observations(observation_size_);
+    step(actions.data(), duration, observations.data());
+    return observations;
+}
+//=============================================================================================//
+} // namespace SPH
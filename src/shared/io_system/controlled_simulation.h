@@ -0,0 +1,151 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	controlled_simulation.h
+ * @brief 	Base class of a simulation case controlled by an external agent,
+ *          such as a reinforcement learning agent in Python.
+ * @details The case registers named actuators, which apply the actions at each sub-step,
+ *          and named observables, which are gathered into one contiguous observation array.
+ *          The case only implements advancing the simulation by a given duration.
+ * @author	Mai Ye and Xiangyu Hu
+ */
+
+#ifndef CONTROLLED_SIMULATION_H
+#define CONTROLLED_SIMULATION_H
+
+#include "io_observation.h"
+
+#include <functional>
+
+namespace SPH
+{
+/** Number of the real-valued components of an observed data type. */
+template <typename DataType>
+struct ComponentSize
+{
+    static constexpr size_t value = DataType::SizeAtCompileTime;
+};
+
+template <>
+struct ComponentSize<Real>
+{
+    static constexpr size_t value = 1;
+};
+
+/**
+ * @class ControlledSimulation
+ * @brief A case advanced step by step with actions from and observations to an external agent.
+ */
+class ControlledSimulation
+{
+  public:
+    ControlledSimulation(){};
+    virtual ~ControlledSimulation(){};
+
+    /** The actuator applies the action to the simulation, e.g. setting a damping coefficient. */
+    void addActuator(const std::string &name, const std::function<void(Real)> &actuator, Real initial_action = 0.0);
+    /** The observer writes a given number of values into the observation array. */
+    void addObservable(const std::string &name, size_t size, const std::function<void(Real *)> &observer);
+
+    template <class LocalReduceMethodType>
+    void addObservable(const std::string &name, ReducedQuantityRecording<LocalReduceMethodType> &reduced_quantity_recording)
+    {
+        using VariableType = typename LocalReduceMethodType::ReturnType;
+        addObservable(name, ComponentSize<VariableType>::value,
+                      [&](Real *observation)
+                      { copyComponents(reduced_quantity_recording.getReducedQuantity(), observation); });
+    };
+
+    /** The observed values are arranged component-major,
+     *  i.e. the first components of all observers followed by the second ones and so on. */
+    template <typename VariableType>
+    void addObservable(const std::string &name, ObservedQuantityRecording<VariableType> &observed_quantity_recording)
+    {
+        size_t number_of_observers = observed_quantity_recording.getSPHBody().getBaseParticles().TotalRealParticles();
+        addObservable(name, number_of_observers * ComponentSize<VariableType>::value,
+                      [&, number_of_observers](Real *observation)
+                      {
+                          observed_quantity_recording.exec();
+                          VariableType *observed_quantity = observed_quantity_recording.getObservedQuantity();
+                          for (size_t i = 0; i != number_of_observers; ++i)
+                          {
+                              for (size_t k = 0; k != ComponentSize<VariableType>::value; ++k)
+                              {
+                                  observation[k * number_of_observers + i] = getComponent(observed_quantity[i], k);
+                              }
+                          }
+                      });
+    };
+
+    size_t ActionSize() { return actuators_.size(); };
+    size_t ObservationSize() { return observation_size_; };
+    StdVec<std::string> ActuatorNames();
+    StdVec<std::string> ObservableNames();
+    /** The position of the first value of an observable in the observation array. */
+    size_t ObservableOffset(const std::string &name);
+    size_t ObservableSize(const std::string &name);
+    /** Set the actions, advance the simulation by the duration and gather all observables. */
+    void step(const Real *actions, Real duration, Real *observations);
+    StdVec<Real> step(const StdVec<Real> &actions, Real duration);
+    void observe(Real *observations);
+    StdVec<Real> observe();
+
+  protected:
+    struct Actuator
+    {
+        std::string name_;
+        std::function<void(Real)> apply_;
+        Real action_;
+    };
+
+    struct Observable
+    {
+        std::string name_;
+        size_t offset_, size_;
+        std::function<void(Real *)> observe_;
+    };
+
+    StdVec<Actuator> actuators_;
+    StdVec<Observable> observables_;
+    size_t observation_size_ = 0;
+
+    static void copyComponents(Real value, Real *components) { components[0] = value; };
+    static Real getComponent(Real value, size_t k) { return value; };
+    template <typename DataType>
+    static Real getComponent(const DataType &value, size_t k) { return value[k]; };
+    template <typename DataType>
+    static void copyComponents(const DataType &value, Real *components)
+    {
+        Eigen::Map<DataType> mapped_components(components);
+        mapped_components = value;
+    };
+
+    void setActions(const Real *actions);
+    /** To be called by the case at each sub-step to apply the current actions. */
+    void applyActuators();
+    /** Advance the simulation of the case by the given duration. */
+    virtual void advance(Real duration) = 0;
+    Observable &getObservable(const std::string &name);
+};
+} // namespace SPH
+#endif // CONTROLLED_SIMULATION_H
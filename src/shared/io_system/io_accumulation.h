@@ -0,0 +1,252 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	io_accumulation.h
+ * @brief 	Classes for observing quantities accumulated at every time step.
+ * @details Sampling a quantity only at output is prone to aliasing of high-frequency content.
+ *          Here, the running time integral, the extrema and the windowed average
+ *          are updated at every (acoustic) time step and kept in memory.
+ *          The aggregated values are only returned or written on request.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef IO_ACCUMULATION_H
+#define IO_ACCUMULATION_H
+
+#include "io_base.h"
+
+#include "io_columnar_recording.h"
+
+namespace SPH
+{
+/**
+ * @class QuantityAccumulation
+ * @brief Time integrated statistics of a quantity sampled at every time step.
+ * The quantity is assumed to be constant over the time step following the sample.
+ * The latest samples are kept in a ring buffer of fixed size for the windowed average.
+ * For a vector quantity, the extrema are component-wise.
+ */
+template <typename DataType>
+class QuantityAccumulation
+{
+  public:
+    explicit QuantityAccumulation(size_t window_size)
+        : window_size_(SMAX(window_size, size_t(1))), ring_buffer_(window_size_){};
+    virtual ~QuantityAccumulation(){};
+
+    void accumulate(const DataType &quantity, Real dt)
+    {
+        minimum_ = number_of_samples_ == 0 ? quantity : lowerBound(minimum_, quantity);
+        maximum_ = number_of_samples_ == 0 ? quantity : upperBound(maximum_, quantity);
+        integral_ += quantity * dt;
+        duration_ += dt;
+        ring_buffer_[number_of_samples_ % window_size_] = Sample{quantity, dt};
+        number_of_samples_++;
+    };
+
+    void reset()
+    {
+        number_of_samples_ = 0;
+        duration_ = 0.0;
+        integral_ = ZeroData<DataType>::value;
+        minimum_ = ZeroData<DataType>::value;
+        maximum_ = ZeroData<DataType>::value;
+    };
+
+    size_t WindowSize() { return window_size_; };
+    size_t NumberOfSamples() { return number_of_samples_; };
+    Real Duration() { return duration_; };
+    DataType Integral() { return integral_; };
+    DataType Minimum() { return minimum_; };
+    DataType Maximum() { return maximum_; };
+    /** time average since the start or the last reset. */
+    DataType Average() { return integral_ / (duration_ + TinyReal); };
+    /** time average over the latest samples in the ring buffer. */
+    DataType WindowAverage()
+    {
+        DataType window_integral = ZeroData<DataType>::value;
+        Real window_duration = 0.0;
+        for (size_t i = 0; i != SMIN(number_of_samples_, window_size_); ++i)
+        {
+            window_integral += ring_buffer_[i].quantity_ * ring_buffer_[i].dt_;
+            window_duration += ring_buffer_[i].dt_;
+        }
+        return window_integral / (window_duration + TinyReal);
+    };
+
+    void writeHeader(ColumnarRecording &recording, const std::string &quantity_name)
+    {
+        recording.addColumn(integral_, quantity_name + "_integral");
+        recording.addColumn(minimum_, quantity_name + "_minimum");
+        recording.addColumn(maximum_, quantity_name + "_maximum");
+        recording.addColumn(integral_, quantity_name + "_average");
+        recording.addColumn(integral_, quantity_name + "_window_average");
+    };
+
+    void writeAggregates(ColumnarRecording &recording)
+    {
+        recording.appendToRecord(Integral());
+        recording.appendToRecord(Minimum());
+        recording.appendToRecord(Maximum());
+        recording.appendToRecord(Average());
+        recording.appendToRecord(WindowAverage());
+    };
+
+  protected:
+    struct Sample
+    {
+        DataType quantity_;
+        Real dt_;
+    };
+
+    size_t window_size_;
+    StdVec<Sample> ring_buffer_;
+    size_t number_of_samples_ = 0;
+    Real duration_ = 0.0;
+    DataType integral_ = ZeroData<DataType>::value;
+    DataType minimum_ = ZeroData<DataType>::value;
+    DataType maximum_ = ZeroData<DataType>::value;
+
+    static Real lowerBound(Real a, Real b) { return SMIN(a, b); };
+    static Real upperBound(Real a, Real b) { return SMAX(a, b); };
+    template <typename VectorType>
+    static VectorType lowerBound(const VectorType &a, const VectorType &b) { return a.cwiseMin(b); };
+    template <typename VectorType>
+    static VectorType upperBound(const VectorType &a, const VectorType &b) { return a.cwiseMax(b); };
+};
+
+template <typename...>
+class ReducedQuantityAccumulation;
+/**
+ * @class ReducedQuantityAccumulation
+ * @brief Accumulate a reduced quantity of a body at every time step.
+ */
+template <class LocalReduceMethodType>
+class ReducedQuantityAccumulation<LocalReduceMethodType> : public BaseIO
+{
+  public:
+    /*< deduce variable type from reduce method. */
+    using VariableType = typename LocalReduceMethodType::ReturnType;
+
+  protected:
+    ReduceDynamics<LocalReduceMethodType> reduce_method_;
+    std::string dynamics_identifier_name_;
+    const std::string quantity_name_;
+    std::string filefullpath_output_;
+    ColumnarRecording recording_;
+    QuantityAccumulation<VariableType> accumulation_;
+
+  public:
+    template <class DynamicsIdentifier, typename... Args>
+    ReducedQuantityAccumulation(size_t window_size, DynamicsIdentifier &identifier, Args &&...args)
+        : BaseIO(identifier.getSPHBody().getSPHSystem()),
+          reduce_method_(identifier, std::forward<Args>(args)...),
+          dynamics_identifier_name_(reduce_method_.DynamicsIdentifierName()),
+          quantity_name_(reduce_method_.QuantityName()), accumulation_(window_size)
+    {
+        /** output for .dat or .bin file. */
+        recording_.open(io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" +
+                            quantity_name_ + "_accumulation",
+                        sph_system_.BinaryRecording());
+        filefullpath_output_ = recording_.FileFullPath();
+        recording_.addTimeColumn();
+        accumulation_.writeHeader(recording_, quantity_name_);
+        recording_.closeHeader();
+    };
+    virtual ~ReducedQuantityAccumulation(){};
+
+    /** to be called at every time step with the step size. */
+    void accumulate(Real dt) { accumulation_.accumulate(reduce_method_.exec(), dt); };
+    QuantityAccumulation<VariableType> &getAccumulation() { return accumulation_; };
+
+    virtual void writeToFile(size_t iteration_step = 0) override
+    {
+        recording_.beginRecord(sv_physical_time_.getValue());
+        accumulation_.writeAggregates(recording_);
+        recording_.closeRecord();
+    };
+};
+
+/**
+ * @class ObservedQuantityAccumulation
+ * @brief Accumulate a quantity interpolated at the observer particles at every time step.
+ */
+template <typename VariableType>
+class ObservedQuantityAccumulation : public BaseIO,
+                                     public ObservingAQuantity<VariableType>
+{
+  protected:
+    BaseParticles &base_particles_;
+    std::string dynamics_identifier_name_;
+    const std::string quantity_name_;
+    std::string filefullpath_output_;
+    ColumnarRecording recording_;
+    StdVec<QuantityAccumulation<VariableType>> accumulations_;
+
+  public:
+    ObservedQuantityAccumulation(size_t window_size, const std::string &quantity_name,
+                                 BaseContactRelation &contact_relation)
+        : BaseIO(contact_relation.getSPHBody().getSPHSystem()),
+          ObservingAQuantity<VariableType>(contact_relation, quantity_name),
+          base_particles_(contact_relation.getSPHBody().getBaseParticles()),
+          dynamics_identifier_name_(contact_relation.getSPHBody().getName()),
+          quantity_name_(quantity_name),
+          accumulations_(base_particles_.TotalRealParticles(), QuantityAccumulation<VariableType>(window_size))
+    {
+        /** Output for .dat or .bin file. */
+        recording_.open(io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" +
+                            quantity_name + "_accumulation",
+                        sph_system_.BinaryRecording());
+        filefullpath_output_ = recording_.FileFullPath();
+        recording_.addTimeColumn(false);
+        for (size_t i = 0; i != accumulations_.size(); ++i)
+        {
+            accumulations_[i].writeHeader(recording_, quantity_name + "[" + std::to_string(i) + "]");
+        }
+        recording_.closeHeader();
+    };
+    virtual ~ObservedQuantityAccumulation(){};
+
+    /** to be called at every time step with the step size, after updating the observer configuration. */
+    void accumulate(Real dt)
+    {
+        this->exec();
+        for (size_t i = 0; i != accumulations_.size(); ++i)
+        {
+            accumulations_[i].accumulate(this->interpolated_quantities_[i], dt);
+        }
+    };
+    QuantityAccumulation<VariableType> &getAccumulation(size_t observer_index) { return accumulations_[observer_index]; };
+
+    virtual void writeToFile(size_t iteration_step = 0) override
+    {
+        recording_.beginRecord(sv_physical_time_.getValue());
+        for (size_t i = 0; i != accumulations_.size(); ++i)
+        {
+            accumulations_[i].writeAggregates(recording_);
+        }
+        recording_.closeRecord();
+    };
+};
+} // namespace SPH
+#endif // IO_ACCUMULATION_H
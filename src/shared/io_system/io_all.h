@@ -27,11 +27,15 @@ io class used in SPHinXsys. **/
 #ifndef IO_ALL_H
 #define IO_ALL_H
 
+#include "controlled_simulation.h"
+#include "io_accumulation.h"
 #include "io_base.h"
+#include "io_columnar_recording.h"
 #include "io_observation.h"
 #include "io_plt.h"
 #include "io_simbody.h"
 #include "io_vtk.h"
 #include "io_vtk_fvm.h"
+#include "restart_remapping.h"
 
 #endif // IO_ALL_H
@@ -0,0 +1,291 @@
+#include "io_columnar_recording.h"
+
+namespace SPH
+{
+//=============================================================================================//
+namespace
+{
+const std::string columnar_recording_signature = "SPHinXsys columnar recording";
+const std::string columnar_recording_end_header = "end_header";
+std::string columnarRecordingDataType(size_t type_size)
+{
+    return type_size == sizeof(double) ? "float64" : "float32";
+}
+} // namespace
+//=============================================================================================//
+void ColumnarRecording::open(const std::string &filefullpath_without_extension, bool is_binary)
+{
+    close();
+    is_binary_ = is_binary;
+    filefullpath_ = filefullpath_without_extension + (is_binary_ ? ".bin" : ".dat");
+    std::ios_base::openmode mode = is_binary_ ? std::ios::app | std::ios::binary : std::ios::app;
+    out_file_.open(filefullpath_.c_str(), mode);
+    if (!out_file_.is_open())
+    {
+        std::cout << "\n Error: the recording file:" << filefullpath_ << " could not be opened." << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    column_names_.clear();
+    column_dimensions_.clear();
+    record_size_ = 0;
+}
+//=============================================================================================//
+void ColumnarRecording::close()
+{
+    if (out_file_.is_open())
+    {
+        flush();
+        out_file_.close();
+    }
+}
+//=============================================================================================//
+void ColumnarRecording::flush()
+{
+    if (is_binary_)
+    {
+        out_file_.write(reinterpret_cast<const char *>(binary_buffer_.data()), binary_buffer_.size() * sizeof(Real));
+        binary_buffer_.clear();
+    }
+    else
+    {
+        out_file_ << text_buffer_.str();
+        text_buffer_.str("");
+    }
+    out_file_.flush();
+    number_of_buffered_records_ = 0;
+}
+//=============================================================================================//
+void ColumnarRecording::addTimeColumn(bool is_quoted_in_text)
+{
+    column_names_.push_back("run_time");
+    column_dimensions_.push_back(1);
+    if (!is_binary_)
+    {
+        text_buffer_ << (is_quoted_in_text ? "\"run_time\"" : "run_time") << "   ";
+    }
+}
+//=============================================================================================//
+void ColumnarRecording::addColumn(const Real &quantity, const std::string &quantity_name)
+{
+    column_names_.push_back(quantity_name);
+    column_dimensions_.push_back(1);
+    if (!is_binary_)
+        plt_engine_.writeAQuantityHeader(text_buffer_, quantity, quantity_name);
+}
+//=============================================================================================//
+void ColumnarRecording::addColumn(const Vecd &quantity, const std::string &quantity_name)
+{
+    column_names_.push_back(quantity_name);
+    column_dimensions_.push_back(Dimensions);
+    if (!is_binary_)
+        plt_engine_.writeAQuantityHeader(text_buffer_, quantity, quantity_name);
+}
+//=============================================================================================//
+void ColumnarRecording::closeHeader()
+{
+    record_size_ = 0;
+    for (size_t dimension : column_dimensions_)
+        record_size_ += dimension;
+
+    if (is_binary_)
+    {
+        out_file_ << columnar_recording_signature << "\n"
+                  << "dtype " << columnarRecordingDataType(sizeof(Real)) << "\n"
+                  << "columns " << column_names_.size() << "\n";
+        for (size_t i = 0; i != column_names_.size(); ++i)
+            out_file_ << column_names_[i] << " " << column_dimensions_[i] << "\n";
+        out_file_ << columnar_recording_end_header << "\n";
+    }
+    else
+    {
+        text_buffer_ << "\n";
+    }
+    flush();
+}
+//=============================================================================================//
+void ColumnarRecording::beginRecord(Real time)
+{
+    current_record_size_ = 0;
+    if (!is_binary_)
+    {
+        // the time is written with the default format as in a newly opened file
+        text_buffer_.flags(default_flags_);
+        text_buffer_.precision(default_precision_);
+    }
+    appendToRecord(time);
+    if (!is_binary_)
+    {
+        text_buffer_ << "   ";
+    }
+}
+//=============================================================================================//
+void ColumnarRecording::appendToRecord(const Real &quantity)
+{
+    if (is_binary_)
+    {
+        binary_buffer_.push_back(quantity);
+    }
+    else if (current_record_size_ == 0)
+    {
+        text_buffer_ << quantity;
+    }
+    else
+    {
+        plt_engine_.writeAQuantity(text_buffer_, quantity);
+    }
+    current_record_size_++;
+}
+//=============================================================================================//
+void ColumnarRecording::appendToRecord(const Vecd &quantity)
+{
+    if (is_binary_)
+    {
+        for (int i = 0; i != Dimensions; ++i)
+            binary_buffer_.push_back(quantity[i]);
+    }
+    else
+    {
+        plt_engine_.writeAQuantity(text_buffer_, quantity);
+    }
+    current_record_size_ += Dimensions;
+}
+//=============================================================================================//
+void ColumnarRecording::closeRecord()
+{
+    if (current_record_size_ != record_size_)
+    {
+        std::cout << "\n Error: the record of " << current_record_size_ << " values does not match the header of "
+                  << record_size_ << " values in the file:" << filefullpath_ << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    if (!is_binary_)
+        text_buffer_ << "\n";
+
+    number_of_buffered_records_++;
+    if (number_of_buffered_records_ >= records_per_flush_)
+        flush();
+}
+//=============================================================================================//
+ColumnarRecordingReader::ColumnarRecordingReader(const std::string &filefullpath)
+{
+    std::ifstream in_file(filefullpath.c_str(), std::ios::binary);
+    if (!in_file.is_open())
+    {
+        std::cout << "\n Error: the recording file:" << filefullpath << " is not exists" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    std::string first_line;
+    std::getline(in_file, first_line);
+    is_binary_ = first_line == columnar_recording_signature;
+    if (is_binary_)
+    {
+        readBinary(in_file);
+    }
+    else
+    {
+        in_file.seekg(0);
+        readText(in_file);
+    }
+}
+//=============================================================================================//
+void ColumnarRecordingReader::readBinary(std::ifstream &in_file)
+{
+    std::string keyword, data_type;
+    size_t number_of_columns = 0;
+    in_file >> keyword >> data_type >> keyword >> number_of_columns;
+    in_file.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    for (size_t i = 0; i != number_of_columns; ++i)
+    {
+        // the dimension is the last entry of the line
+        std::string line;
+        std::getline(in_file, line);
+        size_t separator = line.find_last_of(' ');
+        column_names_.push_back(line.substr(0, separator));
+        column_dimensions_.push_back(std::stoul(line.substr(separator + 1)));
+        record_size_ += column_dimensions_.back();
+    }
+    std::string end_header;
+    std::getline(in_file, end_header);
+    if (end_header != columnar_recording_end_header)
+    {
+        std::cout << "\n Error: the header of the binary recording is not closed by " << columnar_recording_end_header << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    std::streampos data_begin = in_file.tellg();
+    in_file.seekg(0, std::ios::end);
+    size_t data_size = size_t(in_file.tellg() - data_begin);
+    in_file.seekg(data_begin);
+    if (data_type == columnarRecordingDataType(sizeof(Real)))
+    {
+        records_.resize(data_size / sizeof(Real));
+        in_file.read(reinterpret_cast<char *>(records_.data()), records_.size() * sizeof(Real));
+    }
+    else if (data_type == "float64")
+    {
+        StdVec<double> records(data_size / sizeof(double));
+        in_file.read(reinterpret_cast<char *>(records.data()), records.size() * sizeof(double));
+        records_.assign(records.begin(), records.end());
+    }
+    else
+    {
+        StdVec<float> records(data_size / sizeof(float));
+        in_file.read(reinterpret_cast<char *>(records.data()), records.size() * sizeof(float));
+        records_.assign(records.begin(), records.end());
+    }
+    // an incomplete last record, e.g. from an interrupted run, is dropped
+    records_.resize(record_size_ == 0 ? 0 : records_.size() / record_size_ * record_size_);
+}
+//=============================================================================================//
+void ColumnarRecordingReader::readText(std::ifstream &in_file)
+{
+    std::string line;
+    std::getline(in_file, line);
+    std::istringstream header(line);
+    std::string column_name;
+    while (header >> column_name)
+    {
+        column_name.erase(std::remove(column_name.begin(), column_name.end(), '\"'), column_name.end());
+        column_names_.push_back(column_name);
+        column_dimensions_.push_back(1);
+    }
+    record_size_ = column_names_.size();
+
+    while (std::getline(in_file, line))
+    {
+        std::istringstream record(line);
+        StdVec<Real> values;
+        Real value;
+        while (record >> value)
+            values.push_back(value);
+        if (values.size() == record_size_)
+            records_.insert(records_.end(), values.begin(), values.end());
+    }
+}
+//=============================================================================================//
+StdVec<Real> ColumnarRecordingReader::getColumn(const std::string &column_name, size_t component)
+{
+    size_t offset = 0;
+    for (size_t i = 0; i != column_names_.size(); ++i)
+    {
+        if (column_names_[i] == column_name)
+        {
+            StdVec<Real> column(NumberOfRecords());
+            for (size_t n = 0; n != column.size(); ++n)
+                column[n] = getValue(n, offset + component);
+            return column;
+        }
+        offset += column_dimensions_[i];
+    }
+    std::cout << "\n Error: the column " << column_name << " is not found in the recording!" << std::endl;
+    std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+    exit(1);
+}
+//=============================================================================================//
+} // namespace SPH
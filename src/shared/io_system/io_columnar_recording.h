@@ -0,0 +1,120 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	io_columnar_recording.h
+ * @brief 	Persistent and buffered files for the time series of observed or reduced quantities.
+ * @details The file is kept open during the simulation and the records are flushed in blocks.
+ *          The default text format is the same as the Tecplot-like .dat files written before.
+ *          The binary format is self-describing: an ASCII header with the column names,
+ *          dimensions and data type is followed by fixed-size records of Real values.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef IO_COLUMNAR_RECORDING_H
+#define IO_COLUMNAR_RECORDING_H
+
+#include "io_plt.h"
+
+namespace SPH
+{
+/**
+ * @class ColumnarRecording
+ * @brief Writes one record (row) per output time into a persistent and buffered file.
+ * The header is given column by column and closed before the first record.
+ */
+class ColumnarRecording
+{
+  public:
+    ColumnarRecording(){};
+    virtual ~ColumnarRecording() { close(); };
+
+    /** The extension .dat or .bin is appended according to the format. */
+    void open(const std::string &filefullpath_without_extension, bool is_binary = false);
+    void close();
+    void flush();
+    std::string FileFullPath() { return filefullpath_; };
+    bool isBinary() { return is_binary_; };
+    void setRecordsPerFlush(size_t records_per_flush) { records_per_flush_ = SMAX(records_per_flush, size_t(1)); };
+
+    /** The time column is named run_time, quoted or not in the text header. */
+    void addTimeColumn(bool is_quoted_in_text = true);
+    void addColumn(const Real &quantity, const std::string &quantity_name);
+    void addColumn(const Vecd &quantity, const std::string &quantity_name);
+    void closeHeader();
+
+    void beginRecord(Real time);
+    void appendToRecord(const Real &quantity);
+    void appendToRecord(const Vecd &quantity);
+    void closeRecord();
+
+  protected:
+    PltEngine plt_engine_;
+    std::string filefullpath_;
+    bool is_binary_ = false;
+    std::ofstream out_file_;
+    std::ostringstream text_buffer_;
+    std::ios_base::fmtflags default_flags_ = text_buffer_.flags();
+    std::streamsize default_precision_ = text_buffer_.precision();
+    StdVec<std::string> column_names_;
+    StdVec<size_t> column_dimensions_;
+    size_t record_size_ = 0;
+    size_t current_record_size_ = 0;
+    StdVec<Real> binary_buffer_;
+    size_t number_of_buffered_records_ = 0;
+    size_t records_per_flush_ = 64;
+};
+
+/**
+ * @class ColumnarRecordingReader
+ * @brief Reads a binary columnar recording or, as fallback, a text .dat recording.
+ * For the text format, each column has dimension one and is named by the quoted header entry.
+ */
+class ColumnarRecordingReader
+{
+  public:
+    explicit ColumnarRecordingReader(const std::string &filefullpath);
+    virtual ~ColumnarRecordingReader(){};
+
+    bool isBinary() { return is_binary_; };
+    StdVec<std::string> &ColumnNames() { return column_names_; };
+    StdVec<size_t> &ColumnDimensions() { return column_dimensions_; };
+    size_t RecordSize() { return record_size_; };
+    size_t NumberOfRecords() { return record_size_ == 0 ? 0 : records_.size() / record_size_; };
+    /** All records in row-major order. */
+    StdVec<Real> &Records() { return records_; };
+    Real getValue(size_t record_index, size_t value_index) { return records_[record_index * record_size_ + value_index]; };
+    /** The time series of a component of a named column. */
+    StdVec<Real> getColumn(const std::string &column_name, size_t component = 0);
+
+  protected:
+    bool is_binary_ = false;
+    StdVec<std::string> column_names_;
+    StdVec<size_t> column_dimensions_;
+    size_t record_size_ = 0;
+    StdVec<Real> records_;
+
+    void readBinary(std::ifstream &in_file);
+    void readText(std::ifstream &in_file);
+};
+} // namespace SPH
+#endif // IO_COLUMNAR_RECORDING_H
@@ -31,6 +31,7 @@
 
 #include "io_base.h"
 
+#include "io_columnar_recording.h"
 #include "io_plt.h"
 
 namespace SPH
@@ -50,6 +51,7 @@ class ObservedQuantityRecording<VariableType> : public BodyStatesRecording,
     std::string dynamics_identifier_name_;
     const std::string quantity_name_;
     std::string filefullpath_output_;
+    ColumnarRecording recording_;
 
   public:
     VariableType type_indicator_; /*< this is an indicator to identify the variable type. */
@@ -63,34 +65,33 @@ class ObservedQuantityRecording<VariableType> : public BodyStatesRecording,
           dynamics_identifier_name_(contact_relation.getSPHBody().getName()),
           quantity_name_(quantity_name)
     {
-        /** Output for .dat file. */
-        filefullpath_output_ = io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name + ".dat";
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << "run_time"
-                 << "   ";
+        /** Output for .dat or .bin file. */
+        recording_.open(io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name,
+                        sph_system_.BinaryRecording());
+        filefullpath_output_ = recording_.FileFullPath();
+        recording_.addTimeColumn(false);
         for (size_t i = 0; i != base_particles_.TotalRealParticles(); ++i)
         {
             std::string quantity_name_i = quantity_name + "[" + std::to_string(i) + "]";
-            plt_engine_.writeAQuantityHeader(out_file, this->interpolated_quantities_[i], quantity_name_i);
+            recording_.addColumn(this->interpolated_quantities_[i], quantity_name_i);
         }
-        out_file << "\n";
-        out_file.close();
+        recording_.closeHeader();
     };
     virtual ~ObservedQuantityRecording(){};
 
     virtual void writeWithFileName(const std::string &sequence) override
     {
         this->exec();
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << sv_physical_time_.getValue() << "   ";
+        recording_.beginRecord(sv_physical_time_.getValue());
         for (size_t i = 0; i != base_particles_.TotalRealParticles(); ++i)
         {
-            plt_engine_.writeAQuantity(out_file, this->interpolated_quantities_[i]);
+            recording_.appendToRecord(this->interpolated_quantities_[i]);
         }
-        out_file << "\n";
-        out_file.close();
+        recording_.closeRecord();
     };
 
+    ColumnarRecording &getRecording() { return recording_; };
+
     VariableType *getObservedQuantity()
     {
         return this->interpolated_quantities_;
@@ -112,6 +113,7 @@ class ReducedQuantityRecording<LocalReduceMethodType> : public BaseIO
     std::string dynamics_identifier_name_;
     const std::string quantity_name_;
     std::string filefullpath_output_;
+    ColumnarRecording recording_;
 
   public:
     /*< deduce variable type from reduce method. */
@@ -126,24 +128,28 @@ class ReducedQuantityRecording<LocalReduceMethodType> : public BaseIO
           dynamics_identifier_name_(reduce_method_.DynamicsIdentifierName()),
           quantity_name_(reduce_method_.QuantityName())
     {
-        /** output for .dat file. */
-        filefullpath_output_ = io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name_ + ".dat";
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << "\"run_time\""
-                 << "   ";
-        plt_engine_.writeAQuantityHeader(out_file, reduce_method_.Reference(), quantity_name_);
-        out_file << "\n";
-        out_file.close();
+        /** output for .dat or .bin file. */
+        recording_.open(io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name_,
+                        sph_system_.BinaryRecording());
+        filefullpath_output_ = recording_.FileFullPath();
+        recording_.addTimeColumn();
+        recording_.addColumn(reduce_method_.Reference(), quantity_name_);
+        recording_.closeHeader();
     };
     virtual ~ReducedQuantityRecording(){};
 
     virtual void writeToFile(size_t iteration_step = 0) override
     {
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << sv_physical_time_.getValue() << "   ";
-        plt_engine_.writeAQuantity(out_file, reduce_method_.exec());
-        out_file << "\n";
-        out_file.close();
+        recording_.beginRecord(sv_physical_time_.getValue());
+        recording_.appendToRecord(reduce_method_.exec());
+        recording_.closeRecord();
+    };
+
+    ColumnarRecording &getRecording() { return recording_; };
+
+    VariableType getReducedQuantity()
+    {
+        return reduce_method_.exec();
     };
 };
 } // namespace SPH
@@ -0,0 +1,344 @@
+#include "restart_remapping.h"
+
+#include "base_particle_generator.hpp"
+#include "base_particles.hpp"
+#include "mesh_iterators.hpp"
+#include "observer_body.h"
+#include "observer_particles.h"
+
+namespace SPH
+{
+//=============================================================================================//
+template <typename DataType>
+void RemappingRestartIO::RegisterSourceVariable::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables, BaseParticles &source_particles)
+{
+    if constexpr (DataTypeIndex<DataType>::value != DataTypeIndex<UnsignedInt>::value)
+    {
+        for (size_t k = 0; k != variables.size(); ++k)
+        {
+            const std::string &name = variables[k]->Name();
+            if (!isGeometricVariable(name))
+            {
+                source_particles.registerStateVariable<DataType>(name);
+                source_particles.addVariableToRestart<DataType>(name);
+            }
+        }
+    }
+}
+//=============================================================================================//
+template <typename DataType>
+void RemappingRestartIO::RemapAVariable::
+operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+           BaseParticles &target_particles, BaseParticles &source_particles,
+           ParticleConfiguration &configuration, RemappingWeights &weights,
+           const StdVec<std::string> &extensive_variables)
+{
+    if constexpr (DataTypeIndex<DataType>::value != DataTypeIndex<UnsignedInt>::value)
+    {
+        Real *Vol = target_particles.getVariableDataByName<Real>("VolumetricMeasure");
+        Real *source_Vol = source_particles.getVariableDataByName<Real>("VolumetricMeasure");
+        for (size_t k = 0; k != variables.size(); ++k)
+        {
+            const std::string &name = variables[k]->Name();
+            if (isGeometricVariable(name))
+                continue;
+
+            DataType *data = variables[k]->DataField();
+            DataType *source_data = source_particles.getVariableDataByName<DataType>(name);
+            bool is_extensive = std::find(extensive_variables.begin(), extensive_variables.end(), name) !=
+                                extensive_variables.end();
+            particle_for(
+                execution::ParallelPolicy(), IndexRange(0, target_particles.TotalRealParticles()),
+                [&](size_t index_i)
+                {
+                    Neighborhood &neighborhood = configuration[index_i];
+                    if constexpr (std::is_same_v<DataType, int>)
+                    {
+                        size_t nearest = 0;
+                        for (size_t n = 1; n != neighborhood.current_size_; ++n)
+                        {
+                            if (neighborhood.r_ij_[n] < neighborhood.r_ij_[nearest])
+                                nearest = n;
+                        }
+                        data[index_i] = source_data[neighborhood.j_[nearest]];
+                    }
+                    else
+                    {
+                        DataType remapped = ZeroData<DataType>::value;
+                        for (size_t n = 0; n != neighborhood.current_size_; ++n)
+                        {
+                            size_t index_j = neighborhood.j_[n];
+                            Real volume_ratio = is_extensive ? Vol[index_i] / source_Vol[index_j] : 1.0;
+                            remapped += weights[index_i][n] * volume_ratio * source_data[index_j];
+                        }
+                        data[index_i] = remapped;
+                    }
+                });
+        }
+    }
+}
+//=============================================================================================//
+RemappingRestartIO::RemappingRestartIO(SPHSystem &sph_system, Real source_spacing_ratio,
+                                       const StdVec<std::string> &extensive_variables)
+    : RestartIO(sph_system), source_spacing_ratio_(source_spacing_ratio),
+      extensive_variables_(extensive_variables) {}
+//=============================================================================================//
+bool RemappingRestartIO::isGeometricVariable(const std::string &name)
+{
+    return name == "Position" || name == "VolumetricMeasure";
+}
+//=============================================================================================//
+void RemappingRestartIO::readFromFile(size_t restart_step)
+{
+    for (size_t i = 0; i < bodies_.size(); ++i)
+    {
+        std::string filefullpath = file_names_[i] + padValueWithZeros(restart_step) + ".xml";
+
+        if (!fs::exists(filefullpath))
+        {
+            std::cout << "\n Error: the input file:" << filefullpath << " is not exists" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+
+        ParticleVariables &variables_to_restart = bodies_[i]->getBaseParticles().VariablesToRestart();
+        if (findVariableByName<Vecd>(variables_to_restart, "Position") != nullptr &&
+            findVariableByName<Real>(variables_to_restart, "VolumetricMeasure") != nullptr)
+        {
+            remapBody(*bodies_[i], filefullpath);
+        }
+    }
+}
+//=============================================================================================//
+void RemappingRestartIO::remapBody(SPHBody &body, const std::string &filefullpath)
+{
+    BaseParticles &particles = body.getBaseParticles();
+    SPHAdaptation &sph_adaptation = *body.sph_adaptation_;
+    Real source_spacing = sph_adaptation.ReferenceSpacing() * source_spacing_ratio_;
+    Real h_spacing_ratio = sph_adaptation.ReferenceSmoothingLength() / sph_adaptation.ReferenceSpacing();
+    //----------------------------------------------------------------------
+    // The source particles live in a temporary system at the source resolution.
+    //----------------------------------------------------------------------
+    SPHSystem source_system(sph_system_.system_domain_bounds_, source_spacing,
+                            tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism));
+    RealBody source_body(source_system, body.getInitialShape());
+    source_body.defineAdaptationRatios(h_spacing_ratio);
+    source_body.defineMaterial<BaseMaterial>();
+    source_body.generateParticles<BaseParticles, Restart>(filefullpath);
+    BaseParticles &source_particles = source_body.getBaseParticles();
+    OperationOnDataAssemble<ParticleVariables, RegisterSourceVariable> register_source_variables(
+        particles.VariablesToRestart());
+    register_source_variables(source_particles);
+    std::string source_filefullpath = filefullpath;
+    source_body.readParticlesFromXmlForRestart(source_filefullpath);
+    if (source_particles.TotalRealParticles() == 0)
+    {
+        std::cout << "\n Error: no particle of " << body.getName() << " is found in " << filefullpath << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    source_body.updateCellLinkedList();
+    //----------------------------------------------------------------------
+    // The present particles are regenerated at the lattice positions
+    // inside the region occupied by the source particles.
+    //----------------------------------------------------------------------
+    ObserverBody candidate_body(source_system, body.getName() + "RemappingCandidates");
+    candidate_body.defineAdaptationRatios(h_spacing_ratio);
+    candidate_body.generateParticles<ObserverParticles>(findCandidatePositions(body, source_particles));
+    ContactRelation candidate_contact(candidate_body, {&source_body});
+    candidate_contact.updateConfiguration();
+    resetTargetParticles(particles, selectTargetPositions(candidate_body.getBaseParticles(), source_particles,
+                                                          candidate_contact.contact_configuration_[0]));
+    //----------------------------------------------------------------------
+    // The temporary contact relation is unsubscribed from the body before it is destroyed.
+    //----------------------------------------------------------------------
+    ContactRelation remapping_contact(body, {&source_body});
+    remapping_contact.updateConfiguration();
+    StdVec<SPHRelation *> &body_relations = body.getBodyRelations();
+    body_relations.erase(std::remove(body_relations.begin(), body_relations.end(), &remapping_contact),
+                         body_relations.end());
+
+    ParticleConfiguration &configuration = remapping_contact.contact_configuration_[0];
+    for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+    {
+        if (configuration[i].current_size_ == 0)
+        {
+            std::cout << "\n Error: the remapped particle " << i << " of " << body.getName()
+                      << " has no source particle in its neighborhood!" << std::endl;
+            std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+            exit(1);
+        }
+    }
+    RemappingWeights weights(particles.TotalRealParticles());
+    computeRemappingWeights(particles, source_particles, configuration, weights);
+    OperationOnDataAssemble<ParticleVariables, RemapAVariable> remap_variables(particles.VariablesToRestart());
+    remap_variables(particles, source_particles, configuration, weights, extensive_variables_);
+    enforceEquationOfState(body);
+
+    std::cout << "\n Remapped " << source_particles.TotalRealParticles() << " particles of "
+              << body.getName() << " to " << particles.TotalRealParticles() << " particles." << std::endl;
+}
+//=============================================================================================//
+StdVec<Vecd> RemappingRestartIO::findCandidatePositions(SPHBody &body, BaseParticles &source_particles)
+{
+    Vecd *source_pos = source_particles.getVariableDataByName<Vecd>("Position");
+    BoundingBox source_bounds(source_pos[0], source_pos[0]);
+    for (size_t i = 1; i != source_particles.TotalRealParticles(); ++i)
+    {
+        source_bounds.first_ = source_bounds.first_.cwiseMin(source_pos[i]);
+        source_bounds.second_ = source_bounds.second_.cwiseMax(source_pos[i]);
+    }
+    //----------------------------------------------------------------------
+    // The lattice is aligned with the one generated in the initial shape,
+    // and covers the source particles with a margin of one source spacing.
+    //----------------------------------------------------------------------
+    Real spacing = body.sph_adaptation_->ReferenceSpacing();
+    Real margin = source_particles.getSPHBody().sph_adaptation_->ReferenceSpacing();
+    Vecd initial_lower_bound = body.getInitialShape().getBounds().first_;
+    Arrayi lower_shift = ((initial_lower_bound - source_bounds.first_).array() / spacing + margin / spacing)
+                             .ceil()
+                             .cast<int>();
+    Vecd lower_bound = initial_lower_bound - spacing * lower_shift.cast<Real>().matrix();
+    Arrayi number_of_lattices = ((source_bounds.second_ - lower_bound).array() / spacing + margin / spacing)
+                                    .ceil()
+                                    .cast<int>();
+
+    StdVec<Vecd> candidate_positions;
+    mesh_for_each(Arrayi::Zero(), number_of_lattices,
+                  [&](const Arrayi &index)
+                  {
+                      candidate_positions.push_back(
+                          lower_bound + spacing * (index.cast<Real>().matrix() + 0.5 * Vecd::Ones()));
+                  });
+    return candidate_positions;
+}
+//=============================================================================================//
+StdVec<Vecd> RemappingRestartIO::selectTargetPositions(BaseParticles &candidate_particles,
+                                                       BaseParticles &source_particles,
+                                                       ParticleConfiguration &configuration)
+{
+    Vecd *candidate_pos = candidate_particles.getVariableDataByName<Vecd>("Position");
+    Real *source_Vol = source_particles.getVariableDataByName<Real>("VolumetricMeasure");
+    size_t total_candidates = candidate_particles.TotalRealParticles();
+    StdLargeVec<Real> shepard_sum(total_candidates);
+    particle_for(execution::ParallelPolicy(), IndexRange(0, total_candidates),
+                 [&](size_t index_i)
+                 {
+                     Neighborhood &neighborhood = configuration[index_i];
+                     shepard_sum[index_i] = 0.0;
+                     for (size_t n = 0; n != neighborhood.current_size_; ++n)
+                     {
+                         shepard_sum[index_i] += neighborhood.W_ij_[n] * source_Vol[neighborhood.j_[n]];
+                     }
+                 });
+    // the Shepard sum is a half at the surface of the source fluid,
+    // and vanishes for a candidate without source neighbors
+    StdVec<Vecd> target_positions;
+    for (size_t i = 0; i != total_candidates; ++i)
+    {
+        if (shepard_sum[i] >= 0.5)
+            target_positions.push_back(candidate_pos[i]);
+    }
+    return target_positions;
+}
+//=============================================================================================//
+void RemappingRestartIO::resetTargetParticles(BaseParticles &target_particles, const StdVec<Vecd> &target_positions)
+{
+    size_t total_targets = target_positions.size();
+    if (total_targets > target_particles.RealParticlesBound())
+    {
+        std::cout << "\n Error: " << total_targets << " remapped particles of "
+                  << target_particles.getSPHBody().getName() << " exceed its bound of "
+                  << target_particles.RealParticlesBound() << " real particles!" << std::endl;
+        std::cout << " Reserve buffer particles for the body, e.g. with ReserveSizeFactor." << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+    // the added particles take the states of the first particle
+    // before their restart variables are remapped
+    size_t total_real_particles = target_particles.TotalRealParticles();
+    for (size_t i = total_real_particles; i < total_targets; ++i)
+    {
+        target_particles.createRealParticleFrom(0);
+    }
+    if (total_targets < total_real_particles)
+    {
+        target_particles.decrementTotalRealParticles(total_real_particles - total_targets);
+    }
+
+    Vecd *pos = target_particles.getVariableDataByName<Vecd>("Position");
+    Real *Vol = target_particles.getVariableDataByName<Real>("VolumetricMeasure");
+    UnsignedInt *original_id = target_particles.getVariableDataByName<UnsignedInt>("OriginalID");
+    UnsignedInt *sorted_id = target_particles.getVariableDataByName<UnsignedInt>("SortedID");
+    Real lattice_volume = pow(target_particles.getSPHBody().sph_adaptation_->ReferenceSpacing(), Dimensions);
+    for (size_t i = 0; i != total_targets; ++i)
+    {
+        pos[i] = target_positions[i];
+        Vol[i] = lattice_volume;
+        original_id[i] = i;
+        sorted_id[i] = i;
+    }
+}
+//=============================================================================================//
+void RemappingRestartIO::computeRemappingWeights(BaseParticles &target_particles, BaseParticles &source_particles,
+                                                 ParticleConfiguration &configuration, RemappingWeights &weights)
+{
+    using CorrectionMatrix = Eigen::Matrix<Real, Dimensions + 1, Dimensions + 1>;
+    using CorrectionVector = Eigen::Matrix<Real, Dimensions + 1, 1>;
+
+    Real *source_Vol = source_particles.getVariableDataByName<Real>("VolumetricMeasure");
+    Real inv_h = 1.0 / source_particles.getSPHBody().sph_adaptation_->ReferenceSmoothingLength();
+    particle_for(
+        execution::ParallelPolicy(), IndexRange(0, target_particles.TotalRealParticles()),
+        [&](size_t index_i)
+        {
+            Neighborhood &neighborhood = configuration[index_i];
+            StdVec<CorrectionVector> basis(neighborhood.current_size_);
+            CorrectionMatrix moment = CorrectionMatrix::Zero();
+            Real shepard_sum = 0.0;
+            for (size_t n = 0; n != neighborhood.current_size_; ++n)
+            {
+                Real weight_j = neighborhood.W_ij_[n] * source_Vol[neighborhood.j_[n]];
+                // scaled displacement from the target to the source particle
+                basis[n] << 1.0, -neighborhood.r_ij_[n] * inv_h * neighborhood.e_ij_[n];
+                moment += weight_j * basis[n] * basis[n].transpose();
+                shepard_sum += weight_j;
+            }
+
+            weights[index_i].resize(neighborhood.current_size_);
+            Eigen::SelfAdjointEigenSolver<CorrectionMatrix> eigen_solver(moment, Eigen::EigenvaluesOnly);
+            bool is_well_posed = eigen_solver.eigenvalues()[0] > 1.0e-3 * eigen_solver.eigenvalues()[Dimensions];
+            // the linear correction reproduces linear fields exactly,
+            // the Shepard interpolation is the fallback for insufficient neighbors
+            CorrectionVector coefficients = is_well_posed
+                                                ? CorrectionVector(moment.ldlt().solve(CorrectionVector::Unit(0)))
+                                                : CorrectionVector(CorrectionVector::Unit(0) / (shepard_sum + TinyReal));
+            for (size_t n = 0; n != neighborhood.current_size_; ++n)
+            {
+                Real weight_j = neighborhood.W_ij_[n] * source_Vol[neighborhood.j_[n]];
+                weights[index_i][n] = weight_j * coefficients.dot(basis[n]);
+            }
+        });
+}
+//=============================================================================================//
+void RemappingRestartIO::enforceEquationOfState(SPHBody &body)
+{
+    Fluid *fluid = dynamic_cast<Fluid *>(&body.getBaseMaterial());
+    if (fluid == nullptr)
+        return;
+
+    BaseParticles &particles = body.getBaseParticles();
+    Real *p = particles.getVariableDataByName<Real>("Pressure");
+    Real *rho = particles.getVariableDataByName<Real>("Density");
+    Real *mass = particles.getVariableDataByName<Real>("Mass");
+    Real *Vol = particles.getVariableDataByName<Real>("VolumetricMeasure");
+    particle_for(execution::ParallelPolicy(), IndexRange(0, particles.TotalRealParticles()),
+                 [&](size_t index_i)
+                 {
+                     rho[index_i] = fluid->DensityFromPressure(p[index_i]);
+                     mass[index_i] = rho[index_i] * Vol[index_i];
+                 });
+}
+//=============================================================================================//
+} // namespace SPH
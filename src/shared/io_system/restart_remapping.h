@@ -0,0 +1,102 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	restart_remapping.h
+ * @brief 	Restart a case from the restart files written by a run at a different resolution.
+ * @details The particles of the present run are regenerated on a lattice at the present resolution
+ *          covering the region occupied by the particles saved in the restart files,
+ *          so that a developed flow, which has left its initial shape, keeps all its fluid.
+ *          The restart variables are then interpolated from the saved particles
+ *          with first-order kernel-corrected SPH interpolation through a temporary contact relation.
+ *          For fluids, the density and mass are recovered from the pressure with the equation of state.
+ *          Typically, a case is spun up at a coarse resolution and only the measured phase runs fine.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef RESTART_REMAPPING_H
+#define RESTART_REMAPPING_H
+
+#include "io_base.h"
+
+namespace SPH
+{
+/**
+ * @class RemappingRestartIO
+ * @brief Read the restart files written at the particle spacing source_spacing_ratio times
+ *        of the present one and remap the restart variables onto the present particles.
+ * @details Only the bodies with the particle positions in their restart variables, e.g. fluid bodies,
+ *          are remapped. Other bodies, e.g. fixed walls, are kept as generated at the present resolution.
+ *          A lattice position of the present resolution is kept as a particle
+ *          if the Shepard sum of the source particles is at least a half there,
+ *          i.e. it is inside the source fluid, and so it always has source neighbors.
+ *          Integer variables take the value of the nearest source particle, the unsigned integer
+ *          variables, such as the particle IDs, are reset.
+ *          The extensive variables given by the caller, e.g. forces, are scaled with the particle volume
+ *          and remapped per unit volume. All others are remapped as intensive variables.
+ */
+class RemappingRestartIO : public RestartIO
+{
+  public:
+    RemappingRestartIO(SPHSystem &sph_system, Real source_spacing_ratio,
+                       const StdVec<std::string> &extensive_variables);
+    virtual ~RemappingRestartIO(){};
+
+    virtual void readFromFile(size_t restart_step = 0) override;
+
+  protected:
+    Real source_spacing_ratio_;
+    StdVec<std::string> extensive_variables_;
+
+    /** Weights of the neighboring source particles for a target particle, in the order of its neighborhood. */
+    using RemappingWeights = StdLargeVec<StdVec<Real>>;
+
+    struct RegisterSourceVariable
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        BaseParticles &source_particles);
+    };
+
+    struct RemapAVariable
+    {
+        template <typename DataType>
+        void operator()(DataContainerAddressKeeper<DiscreteVariable<DataType>> &variables,
+                        BaseParticles &target_particles, BaseParticles &source_particles,
+                        ParticleConfiguration &configuration, RemappingWeights &weights,
+                        const StdVec<std::string> &extensive_variables);
+    };
+
+    static bool isGeometricVariable(const std::string &name);
+    void remapBody(SPHBody &body, const std::string &filefullpath);
+    /** Lattice positions of the present resolution around the source particles. */
+    StdVec<Vecd> findCandidatePositions(SPHBody &body, BaseParticles &source_particles);
+    /** The candidates inside the region occupied by the source particles. */
+    StdVec<Vecd> selectTargetPositions(BaseParticles &candidate_particles, BaseParticles &source_particles,
+                                       ParticleConfiguration &configuration);
+    void resetTargetParticles(BaseParticles &target_particles, const StdVec<Vecd> &target_positions);
+    void computeRemappingWeights(BaseParticles &target_particles, BaseParticles &source_particles,
+                                 ParticleConfiguration &configuration, RemappingWeights &weights);
+    void enforceEquationOfState(SPHBody &body);
+};
+} // namespace SPH
+#endif // RESTART_REMAPPING_H
@@ -49,21 +49,23 @@ Matd NonLinearHardeningPlasticSolid::ElasticLeftCauchy(const Matd &F, size_t ind
     Matd deviatoric_Kirchhoff = DeviatoricKirchhoff(normalized_be - normalized_be_isentropic * Matd::Identity());
     Real deviatoric_Kirchhoff_norm = deviatoric_Kirchhoff.norm();
 
-    Real relax_increment = 0.0;
-    Real trial_function = deviatoric_Kirchhoff_norm - sqrt_2_over_3_ * NonlinearHardening(hardening_parameter_[index_i]);
+    Real hardening_parameter = hardening_parameter_[index_i];
+    Real trial_function = deviatoric_Kirchhoff_norm - sqrt_2_over_3_ * NonlinearHardening(hardening_parameter);
     if (trial_function > 0.0)
     {
         Real renormalized_shear_modulus = normalized_be_isentropic * G0_;
-        while (trial_function > 0.0)
-        {
-            Real function_relax_increment_derivative = -2.0 * renormalized_shear_modulus *
-                                                       (1.0 + NonlinearHardeningDerivative(hardening_parameter_[index_i] + sqrt_2_over_3_ * relax_increment) /
-                                                                  3.0 / renormalized_shear_modulus);
-            relax_increment -= trial_function / function_relax_increment_derivative;
-
-            trial_function = deviatoric_Kirchhoff_norm - sqrt_2_over_3_ * NonlinearHardening(hardening_parameter_[index_i] + sqrt_2_over_3_ * relax_increment) -
-                             2.0 * renormalized_shear_modulus * relax_increment;
-        }
+        // the residual is negative at the upper bound as the hardening stress is positive
+        Real relax_increment = return_mapping_solver_.solve(
+            [&](Real increment)
+            {
+                Real residual = deviatoric_Kirchhoff_norm - 2.0 * renormalized_shear_modulus * increment -
+                                sqrt_2_over_3_ * NonlinearHardening(hardening_parameter + sqrt_2_over_3_ * increment);
+                Real derivative = -2.0 * renormalized_shear_modulus *
+                                  (1.0 + NonlinearHardeningDerivative(hardening_parameter + sqrt_2_over_3_ * increment) /
+                                             3.0 / renormalized_shear_modulus);
+                return std::make_pair(residual, derivative);
+            },
+            0.0, 0.5 * deviatoric_Kirchhoff_norm / renormalized_shear_modulus, 0.0, deviatoric_Kirchhoff_norm);
         hardening_parameter_[index_i] += sqrt_2_over_3_ * relax_increment;
         deviatoric_Kirchhoff -= 2.0 * renormalized_shear_modulus * relax_increment * deviatoric_Kirchhoff / deviatoric_Kirchhoff_norm;
         Matd relaxed_be = deviatoric_Kirchhoff / G0_ + normalized_be_isentropic * Matd::Identity();
@@ -98,29 +100,24 @@ Matd ViscousPlasticSolid::ElasticLeftCauchy(const Matd &F, size_t index_i, Real
     if (trial_function > 0.0)
     {
         Real renormalized_shear_modulus = normalized_be_isentropic * G0_;
-        Real deviatoric_Kirchhoff_norm_Mid = 0.0;
-        Real deviatoric_Kirchhoff_norm_Max = deviatoric_Kirchhoff_norm;
-        Real deviatoric_Kirchhoff_norm_Min = sqrt_2_over_3_ * yield_stress_;
-        Real predicted_func = 0.0;
-        Real Precision = 1.0e-6;
-        Real Relative_Error;
-        do
-        {
-            deviatoric_Kirchhoff_norm_Mid = (deviatoric_Kirchhoff_norm_Max + deviatoric_Kirchhoff_norm_Min) / 2.0;
-            predicted_func = pow(viscous_modulus_, 1.0 / Herschel_Bulkley_power_) * (deviatoric_Kirchhoff_norm_Mid - deviatoric_Kirchhoff_norm) +
-                             2.0 * renormalized_shear_modulus * dt * pow((deviatoric_Kirchhoff_norm_Mid - sqrt_2_over_3_ * yield_stress_), 1.0 / Herschel_Bulkley_power_);
-            if (predicted_func < 0.0)
-            {
-                deviatoric_Kirchhoff_norm_Min = deviatoric_Kirchhoff_norm_Mid;
-            }
-            else
+        Real yield_Kirchhoff_norm = sqrt_2_over_3_ * yield_stress_;
+        Real viscous_factor = pow(viscous_modulus_, 1.0 / Herschel_Bulkley_power_);
+        Real inverse_power = 1.0 / Herschel_Bulkley_power_;
+        Real deviatoric_Kirchhoff_norm_relaxed = return_mapping_solver_.solve(
+            [&](Real relaxed_norm)
             {
-                deviatoric_Kirchhoff_norm_Max = deviatoric_Kirchhoff_norm_Mid;
-            }
-            Relative_Error = predicted_func / deviatoric_Kirchhoff_norm;
-        } while (fabs(Relative_Error) >= Precision);
+                Real over_stress = SMAX(relaxed_norm - yield_Kirchhoff_norm, Real(0));
+                Real flow = pow(over_stress, inverse_power);
+                Real residual = viscous_factor * (relaxed_norm - deviatoric_Kirchhoff_norm) +
+                                2.0 * renormalized_shear_modulus * dt * flow;
+                Real derivative = viscous_factor +
+                                  2.0 * renormalized_shear_modulus * dt * inverse_power * flow / (over_stress + TinyReal);
+                return std::make_pair(residual, derivative);
+            },
+            yield_Kirchhoff_norm, deviatoric_Kirchhoff_norm, 0.5 * (yield_Kirchhoff_norm + deviatoric_Kirchhoff_norm),
+            viscous_factor * deviatoric_Kirchhoff_norm);
 
-        deviatoric_Kirchhoff = deviatoric_Kirchhoff_norm_Mid * deviatoric_Kirchhoff / deviatoric_Kirchhoff_norm;
+        deviatoric_Kirchhoff = deviatoric_Kirchhoff_norm_relaxed * deviatoric_Kirchhoff / deviatoric_Kirchhoff_norm;
         Matd relaxed_be = deviatoric_Kirchhoff / G0_ + normalized_be_isentropic * Matd::Identity();
         normalized_be = relaxed_be * pow(relaxed_be.determinant(), -OneOverDimensions);
     }
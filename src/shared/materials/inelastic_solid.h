@@ -29,6 +29,7 @@
 #pragma once
 
 #include "elastic_solid.h"
+#include "scalar_root_finding.h"
 
 namespace SPH
 {
@@ -40,6 +41,7 @@ class PlasticSolid : public NeoHookeanSolid
 {
   protected:
     Real yield_stress_;
+    SafeguardedNewtonSolver return_mapping_solver_; /**< for the scalar equation of nonlinear return mapping */
 
   public:
     /** Constructor */
@@ -51,6 +53,7 @@ class PlasticSolid : public NeoHookeanSolid
     virtual ~PlasticSolid(){};
 
     Real YieldStress() { return yield_stress_; };
+    SafeguardedNewtonSolver &ReturnMappingSolver() { return return_mapping_solver_; };
     /** compute the elastic part of normalized left Cauchy-Green deformation gradient tensor. */
     virtual Matd ElasticLeftCauchy(const Matd &deformation, size_t index_i, Real dt = 0.0) = 0;
 
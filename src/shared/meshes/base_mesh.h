@@ -105,6 +105,8 @@ class Mesh
                mesh_index[1] * mesh_size[2] +
                mesh_index[2];
     };
+    /** number of bits of a Morton order, i.e. 10 bits of each index spread with a stride of 3, also in 2D */
+    static constexpr int MortonOrderBits = 30;
     /** converts mesh index into a Morton order.
      * Interleave a 10 bit number in 32 bits, fill one bit and leave the other 2 as zeros
      * https://stackoverflow.com/questions/18529057/
@@ -74,6 +74,68 @@ class BaseCellLinkedList : public BaseMeshField
     virtual void tagBoundingCells(StdVec<CellLists> &cell_data_lists, const BoundingBox &bounding_bounds, int axis) = 0;
 };
 
+/**
+ * @class PeriodicImage
+ * @brief Periodicity of a cell linked list along axis directions without copying particles.
+ * The neighbor search also visits the periodic images of a particle near the periodic bounds,
+ * and the displacement between two particles is taken from their nearest images.
+ * The cutoff radius should be less than half of the periodic extent,
+ * and the body should be within the periodic bounds along the periodic axis.
+ */
+class PeriodicImage
+{
+  public:
+    PeriodicImage() : lower_bound_(Vecd::Zero()), period_(Vecd::Zero()), periodic_axes_(Arrayi::Zero()){};
+
+    void setPeriodicAxis(const BoundingBox &bounding_bounds, int axis)
+    {
+        lower_bound_[axis] = bounding_bounds.first_[axis];
+        period_[axis] = bounding_bounds.second_[axis] - bounding_bounds.first_[axis];
+        periodic_axes_[axis] = 1;
+    };
+    Arrayi PeriodicAxes() const { return periodic_axes_; };
+    Vecd ImageShift(const Arrayi &image) const { return period_.cwiseProduct(image.cast<Real>().matrix()); };
+
+    inline Vecd displacement(const Vecd &source, const Vecd &target) const
+    {
+        Vecd displacement = source - target;
+        for (int axis = 0; axis != Dimensions; ++axis)
+        {
+            if (periodic_axes_[axis] != 0)
+                displacement[axis] -= period_[axis] * std::floor(displacement[axis] / period_[axis] + 0.5);
+        }
+        return displacement;
+    };
+
+    inline Vecd wrap(const Vecd &position) const
+    {
+        Vecd wrapped = position;
+        for (int axis = 0; axis != Dimensions; ++axis)
+        {
+            if (periodic_axes_[axis] != 0)
+                wrapped[axis] -= period_[axis] * std::floor((position[axis] - lower_bound_[axis]) / period_[axis]);
+        }
+        return wrapped;
+    };
+
+    /** whether an image position may have neighbors within the periodic bounds. */
+    inline bool isNearBounds(const Vecd &image_position, Real cutoff) const
+    {
+        for (int axis = 0; axis != Dimensions; ++axis)
+        {
+            if (periodic_axes_[axis] != 0 &&
+                (image_position[axis] < lower_bound_[axis] - cutoff ||
+                 image_position[axis] > lower_bound_[axis] + period_[axis] + cutoff))
+                return false;
+        }
+        return true;
+    };
+
+  protected:
+    Vecd lower_bound_, period_;
+    Arrayi periodic_axes_;
+};
+
 class NeighborSearch : public Mesh
 {
   public:
@@ -86,6 +148,7 @@ class NeighborSearch : public Mesh
                        const FunctionOnEach &function) const;
 
   protected:
+    PeriodicImage periodic_image_;
     Real grid_spacing_squared_;
     Vecd *pos_;
     UnsignedInt *particle_index_;
@@ -113,6 +176,7 @@ class CellLinkedList : public BaseCellLinkedList, public Mesh
     ListDataVector *cell_data_lists_;
     /**< number of split cell lists */
     size_t number_of_split_cell_lists_;
+    PeriodicImage periodic_image_;
 
     void allocateMeshDataMatrix(); /**< allocate memories for addresses of data packages. */
     void deleteMeshDataMatrix();   /**< delete memories for addresses of data packages. */
@@ -146,6 +210,8 @@ class CellLinkedList : public BaseCellLinkedList, public Mesh
 
     template <class ExecutionPolicy>
     NeighborSearch createNeighborSearch(const ExecutionPolicy &ex_policy, DiscreteVariable<Vecd> *pos);
+    void setPeriodicAxis(const BoundingBox &bounding_bounds, int axis) { periodic_image_.setPeriodicAxis(bounding_bounds, axis); };
+    PeriodicImage &getPeriodicImage() { return periodic_image_; };
     UnsignedInt getCellOffsetListSize() { return cell_offset_list_size_; };
     DiscreteVariable<UnsignedInt> *getParticleIndex() { return dv_particle_index_; };
     DiscreteVariable<UnsignedInt> *getCellOffset() { return dv_cell_offset_; };
@@ -20,7 +20,8 @@ namespace SPH
 template <class ExecutionPolicy>
 NeighborSearch::NeighborSearch(
     const ExecutionPolicy &ex_policy, CellLinkedList &cell_linked_list, DiscreteVariable<Vecd> *pos)
-    : Mesh(cell_linked_list), grid_spacing_squared_(grid_spacing_ * grid_spacing_),
+    : Mesh(cell_linked_list), periodic_image_(cell_linked_list.getPeriodicImage()),
+      grid_spacing_squared_(grid_spacing_ * grid_spacing_),
       pos_(pos->DelegatedDataField(ex_policy)),
       particle_index_(cell_linked_list.getParticleIndex()->DelegatedDataField(ex_policy)),
       cell_offset_(cell_linked_list.getCellOffset()->DelegatedDataField(ex_policy)) {}
@@ -29,23 +30,34 @@ template <typename FunctionOnEach>
 void NeighborSearch::forEachSearch(UnsignedInt index_i, const Vecd *source_pos,
                                    const FunctionOnEach &function) const
 {
-    const Arrayi target_cell_index = CellIndexFromPosition(source_pos[index_i]);
+    // without periodicity, only the image with zero shift is visited
+    const Arrayi periodic_axes = periodic_image_.PeriodicAxes();
     mesh_for_each(
-        Arrayi::Zero().max(target_cell_index - Arrayi::Ones()),
-        all_cells_.min(target_cell_index + 2 * Arrayi::Ones()),
-        [&](const Arrayi &cell_index)
+        -periodic_axes, periodic_axes + Arrayi::Ones(),
+        [&](const Arrayi &image)
         {
-            const UnsignedInt linear_index = LinearCellIndexFromCellIndex(cell_index);
-            // Since offset_cell_size_ has linear_cell_size_+1 elements, no boundary checks are needed.
-            // offset_cell_size_[0] == 0 && offset_cell_size_[linear_cell_size_] == total_real_particles_
-            for (UnsignedInt n = cell_offset_[linear_index]; n < cell_offset_[linear_index + 1]; ++n)
-            {
-                const UnsignedInt index_j = particle_index_[n];
-                if ((source_pos[index_i] - pos_[index_j]).squaredNorm() < grid_spacing_squared_)
+            const Vecd image_pos = source_pos[index_i] + periodic_image_.ImageShift(image);
+            if (!periodic_image_.isNearBounds(image_pos, grid_spacing_))
+                return;
+
+            const Arrayi target_cell_index = CellIndexFromPosition(image_pos);
+            mesh_for_each(
+                Arrayi::Zero().max(target_cell_index - Arrayi::Ones()),
+                all_cells_.min(target_cell_index + 2 * Arrayi::Ones()),
+                [&](const Arrayi &cell_index)
                 {
-                    function(index_j);
-                }
-            }
+                    const UnsignedInt linear_index = LinearCellIndexFromCellIndex(cell_index);
+                    // Since offset_cell_size_ has linear_cell_size_+1 elements, no boundary checks are needed.
+                    // offset_cell_size_[0] == 0 && offset_cell_size_[linear_cell_size_] == total_real_particles_
+                    for (UnsignedInt n = cell_offset_[linear_index]; n < cell_offset_[linear_index + 1]; ++n)
+                    {
+                        const UnsignedInt index_j = particle_index_[n];
+                        if ((image_pos - pos_[index_j]).squaredNorm() < grid_spacing_squared_)
+                        {
+                            function(index_j);
+                        }
+                    }
+                });
         });
 }
 //=================================================================================================//
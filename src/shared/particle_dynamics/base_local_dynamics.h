@@ -139,6 +139,18 @@ struct ConstructorArgs
         : body_relation_(body_relation), others_(other_args...){};
 };
 
+/**
+ * @brief Add the body relations on which the data delegates of a local dynamics are built.
+ */
+template <class LocalDynamicsType>
+void addDelegatedRelations(LocalDynamicsType *local_dynamics, StdVec<SPHRelation *> &body_relations)
+{
+    if (DataDelegateInner *inner = dynamic_cast<DataDelegateInner *>(local_dynamics))
+        body_relations.push_back(&inner->getBodyRelation());
+    if (DataDelegateContact *contact = dynamic_cast<DataDelegateContact *>(local_dynamics))
+        body_relations.push_back(&contact->getBodyRelation());
+};
+
 /**
  * @class ComplexInteraction
  * @brief A class that integrates multiple local dynamics.
@@ -154,7 +166,9 @@ class ComplexInteraction<LocalDynamicsName<>, CommonParameters...>
   public:
     ComplexInteraction(){};
 
+    void setupDynamics(Real dt = 0.0){};
     void interaction(size_t index_i, Real dt = 0.0){};
+    void getBodyRelations(StdVec<SPHRelation *> &body_relations){};
 };
 
 template <typename... CommonParameters, template <typename... InteractionTypes> class LocalDynamicsName,
@@ -172,11 +186,24 @@ class ComplexInteraction<LocalDynamicsName<FirstInteraction, OtherInteractions..
         : LocalDynamicsName<FirstInteraction, CommonParameters...>(first_parameter_set),
           other_interactions_(std::forward<OtherParameterSets>(other_parameter_sets)...){};
 
+    void setupDynamics(Real dt = 0.0)
+    {
+        LocalDynamicsName<FirstInteraction, CommonParameters...>::setupDynamics(dt);
+        other_interactions_.setupDynamics(dt);
+    };
+
     void interaction(size_t index_i, Real dt = 0.0)
     {
         LocalDynamicsName<FirstInteraction, CommonParameters...>::interaction(index_i, dt);
         other_interactions_.interaction(index_i, dt);
     };
+
+    /** the body relations of all the integrated local dynamics. */
+    void getBodyRelations(StdVec<SPHRelation *> &body_relations)
+    {
+        addDelegatedRelations(static_cast<LocalDynamicsName<FirstInteraction, CommonParameters...> *>(this), body_relations);
+        other_interactions_.getBodyRelations(body_relations);
+    };
 };
 } // namespace SPH
 #endif // BASE_LOCAL_DYNAMICS_H
@@ -30,6 +30,7 @@
 #define ALL_CONFIGURATION_DYNAMICS_H
 
 #include "particle_sorting.hpp"
+#include "periodic_condition_ck.hpp"
 #include "update_body_relation.hpp"
 #include "update_cell_linked_list.hpp"
 
@@ -1,6 +1,7 @@
 #include "particle_sorting.h"
 
 #include "base_body.h"
+#include "base_body_part.h"
 #include "base_particle_dynamics.h"
 #include "base_particles.h"
 #include "cell_linked_list.h"
@@ -26,11 +27,13 @@ ParticleSequence::ParticleSequence(RealBody &real_body)
     : LocalDynamics(real_body),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
       sequence_(particles_->registerDiscreteVariable<UnsignedInt>("Sequence", particles_->ParticlesBound())),
+      body_part_id_(particles_->registerStateVariable<int>("BodyPartID")),
       cell_linked_list_(real_body.getCellLinkedList()) {}
 //=================================================================================================//
 void ParticleSequence::update(size_t index_i, Real dt)
 {
-    sequence_[index_i] = cell_linked_list_.computingSequence(pos_[index_i], index_i);
+    sequence_[index_i] = SortingSequence(body_part_id_[index_i],
+                                         cell_linked_list_.computingSequence(pos_[index_i], index_i));
 }
 //=================================================================================================//
 ParticleDataSort<ParallelPolicy>::ParticleDataSort(RealBody &real_body)
@@ -41,6 +44,7 @@ ParticleDataSort<ParallelPolicy>::ParticleDataSort(RealBody &real_body)
       quick_sort_particle_body_()
 {
     particles_->addVariableToSort<UnsignedInt>("OriginalID");
+    particles_->addVariableToSort<int>("BodyPartID");
 }
 //=================================================================================================//
 void ParticleDataSort<ParallelPolicy>::exec(Real dt)
@@ -250,6 +250,7 @@ class ParticleSequence : public LocalDynamics
   protected:
     Vecd *pos_;
     UnsignedInt *sequence_;
+    int *body_part_id_;
     BaseCellLinkedList &cell_linked_list_;
 
   public:
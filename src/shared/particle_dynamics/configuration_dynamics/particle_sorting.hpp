@@ -18,6 +18,7 @@ void ParticleSorting<ExecutionPolicy>::exec(Real dt)
     particle_sequence_.exec();
     particle_data_sort_.exec();
     update_sorted_id_.exec();
+    particle_data_sort_.getSPHBody().updateBodyPartsAfterSorting();
 }
 //=================================================================================================//
 } // namespace SPH
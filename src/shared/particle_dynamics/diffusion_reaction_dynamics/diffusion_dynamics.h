@@ -197,11 +197,11 @@ template <class ContactKernelGradientType, class DiffusionType>
 class DiffusionRelaxation<Neumann<ContactKernelGradientType>, DiffusionType>
     : public DiffusionRelaxation<Contact<ContactKernelGradientType>, DiffusionType>
 {
+  protected:
     Vecd *n_;
     StdVec<StdVec<Real *>> contact_diffusive_flux_;
     StdVec<Vecd *> contact_n_;
 
-  protected:
     void getDiffusionChangeRateNeumann(size_t particle_i, size_t particle_j,
                                        Real surface_area_ij_Neumann,
                                        const StdVec<Real *> &diffusive_flux_k);
@@ -220,12 +220,12 @@ template <class ContactKernelGradientType, class DiffusionType>
 class DiffusionRelaxation<Robin<ContactKernelGradientType>, DiffusionType>
     : public DiffusionRelaxation<Contact<ContactKernelGradientType>, DiffusionType>
 {
+  protected:
     Vecd *n_;
     StdVec<StdVec<Real *>> contact_convection_;
     StdVec<StdVec<Real *>> contact_species_infinity_;
     StdVec<Vecd *> contact_n_;
 
-  protected:
     void getTransferRateRobin(
         size_t particle_i, size_t particle_j, Real surface_area_ij_Robin,
         StdVec<Real *> &transfer_k,
@@ -240,6 +240,136 @@ class DiffusionRelaxation<Robin<ContactKernelGradientType>, DiffusionType>
     void interaction(size_t index_i, Real dt = 0.0);
 };
 
+/**
+ * @class SparseDiffusionOperator
+ * @brief The inter-particle diffusion coefficients of a particle configuration
+ * assembled in compressed sparse row (CSR) format.
+ * @details The coefficients of all species share the sparsity pattern
+ * and are stored blocked by neighbor, so that all species of a particle
+ * are updated in a single sweep over its row.
+ */
+class SparseDiffusionOperator
+{
+  public:
+    SparseDiffusionOperator() : number_of_species_(0), is_assembled_(false){};
+    bool isAssembled() { return is_assembled_; };
+
+    /** The coefficient function writes the coefficients of all species for the n-th neighbor. */
+    template <typename CoefficientFunction>
+    void assemble(ParticleConfiguration &configuration, size_t number_of_rows, size_t number_of_species,
+                  const CoefficientFunction &coefficient_function)
+    {
+        number_of_species_ = number_of_species;
+        row_offset_.resize(number_of_rows + 1);
+        row_offset_[0] = 0;
+        for (size_t i = 0; i != number_of_rows; ++i)
+        {
+            row_offset_[i + 1] = row_offset_[i] + configuration[i].current_size_;
+        }
+        column_index_.resize(row_offset_[number_of_rows]);
+        coefficients_.resize(row_offset_[number_of_rows] * number_of_species_);
+
+        particle_for(execution::ParallelPolicy(), IndexRange(0, number_of_rows),
+                     [&](size_t index_i)
+                     {
+                         Neighborhood &neighborhood = configuration[index_i];
+                         for (size_t n = 0; n != neighborhood.current_size_; ++n)
+                         {
+                             size_t entry = row_offset_[index_i] + n;
+                             column_index_[entry] = neighborhood.j_[n];
+                             coefficient_function(index_i, neighborhood, n, &coefficients_[entry * number_of_species_]);
+                         }
+                     });
+        is_assembled_ = true;
+    };
+
+    template <typename FunctionOnEntry>
+    inline void forEachEntry(size_t index_i, const FunctionOnEntry &function_on_entry)
+    {
+        for (size_t entry = row_offset_[index_i]; entry != row_offset_[index_i + 1]; ++entry)
+        {
+            function_on_entry(column_index_[entry], &coefficients_[entry * number_of_species_]);
+        }
+    };
+
+  protected:
+    size_t number_of_species_;
+    bool is_assembled_;
+    StdLargeVec<size_t> row_offset_;
+    StdLargeVec<size_t> column_index_;
+    StdLargeVec<Real> coefficients_;
+};
+
+template <class KernelGradientType>
+class Assembled; /**< Interaction with the diffusion operator assembled once for a fixed configuration */
+
+/**
+ * @class DiffusionRelaxation<Inner<Assembled<KernelGradientType>>, DiffusionType>
+ * @brief The inner diffusion relaxation with the coefficients of all species assembled
+ * at the first step so that the relaxation becomes a sparse matrix-vector product.
+ * @details Only valid when the inner configuration, the particle order and
+ * the diffusion coefficients do not change after the first step.
+ */
+template <class KernelGradientType, class DiffusionType>
+class DiffusionRelaxation<Inner<Assembled<KernelGradientType>>, DiffusionType>
+    : public DiffusionRelaxation<Inner<KernelGradientType>, DiffusionType>
+{
+  protected:
+    SparseDiffusionOperator inner_operator_;
+
+  public:
+    template <typename... Args>
+    explicit DiffusionRelaxation(Args &&... args);
+    virtual ~DiffusionRelaxation(){};
+    virtual void setupDynamics(Real dt = 0.0) override;
+    inline void interaction(size_t index_i, Real dt = 0.0);
+};
+
+template <class ContactKernelGradientType, class DiffusionType>
+class DiffusionRelaxation<Dirichlet<Assembled<ContactKernelGradientType>>, DiffusionType>
+    : public DiffusionRelaxation<Dirichlet<ContactKernelGradientType>, DiffusionType>
+{
+  protected:
+    StdVec<SparseDiffusionOperator> contact_operators_;
+
+  public:
+    template <typename... Args>
+    explicit DiffusionRelaxation(Args &&... args);
+    virtual ~DiffusionRelaxation(){};
+    virtual void setupDynamics(Real dt = 0.0) override;
+    inline void interaction(size_t index_i, Real dt = 0.0);
+};
+
+template <class ContactKernelGradientType, class DiffusionType>
+class DiffusionRelaxation<Neumann<Assembled<ContactKernelGradientType>>, DiffusionType>
+    : public DiffusionRelaxation<Neumann<ContactKernelGradientType>, DiffusionType>
+{
+  protected:
+    StdVec<SparseDiffusionOperator> contact_operators_;
+
+  public:
+    template <typename... Args>
+    explicit DiffusionRelaxation(Args &&... args);
+    virtual ~DiffusionRelaxation(){};
+    virtual void setupDynamics(Real dt = 0.0) override;
+    void interaction(size_t index_i, Real dt = 0.0);
+};
+
+template <class ContactKernelGradientType, class DiffusionType>
+class DiffusionRelaxation<Robin<Assembled<ContactKernelGradientType>>, DiffusionType>
+    : public DiffusionRelaxation<Robin<ContactKernelGradientType>, DiffusionType>
+{
+  protected:
+    StdVec<SparseDiffusionOperator> contact_operators_;
+
+  public:
+    template <typename... Args>
+    explicit DiffusionRelaxation(Args &&... args);
+    virtual ~DiffusionRelaxation(){};
+    virtual void setupDynamics(Real dt = 0.0) override;
+    void interaction(size_t index_i, Real dt = 0.0);
+};
+
 /**
  * @class RungeKuttaStep
  * @brief A general step for runge-kutta integration scheme.
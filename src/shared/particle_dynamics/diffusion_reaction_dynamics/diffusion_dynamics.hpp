@@ -344,6 +344,221 @@ void DiffusionRelaxation<Robin<ContactKernelGradientType>, DiffusionType>::
     this->accumulateDiffusionRate(index_i);
 }
 //=================================================================================================//
+template <class KernelGradientType, class DiffusionType>
+template <typename... Args>
+DiffusionRelaxation<Inner<Assembled<KernelGradientType>>, DiffusionType>::
+    DiffusionRelaxation(Args &&...args)
+    : DiffusionRelaxation<Inner<KernelGradientType>, DiffusionType>(std::forward<Args>(args)...) {}
+//=================================================================================================//
+template <class KernelGradientType, class DiffusionType>
+void DiffusionRelaxation<Inner<Assembled<KernelGradientType>>, DiffusionType>::setupDynamics(Real dt)
+{
+    if (inner_operator_.isAssembled())
+        return;
+
+    inner_operator_.assemble(
+        this->inner_configuration_, this->particles_->TotalRealParticles(), this->diffusions_.size(),
+        [&](size_t index_i, Neighborhood &inner_neighborhood, size_t n, Real *coefficients)
+        {
+            size_t index_j = inner_neighborhood.j_[n];
+            Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * this->Vol_[index_j];
+            Vecd &e_ij = inner_neighborhood.e_ij_[n];
+
+            const Vecd &grad_ijV_j = this->kernel_gradient_(index_i, index_j, dW_ijV_j, e_ij);
+            Real surface_area_ij = 2.0 * grad_ijV_j.dot(e_ij) / inner_neighborhood.r_ij_[n];
+            for (size_t m = 0; m < this->diffusions_.size(); ++m)
+            {
+                coefficients[m] =
+                    this->diffusions_[m]->getInterParticleDiffusionCoeff(index_i, index_j, e_ij) * surface_area_ij;
+            }
+        });
+}
+//=================================================================================================//
+template <class KernelGradientType, class DiffusionType>
+void DiffusionRelaxation<Inner<Assembled<KernelGradientType>>, DiffusionType>::interaction(size_t index_i, Real dt)
+{
+    size_t number_of_species = this->diffusions_.size();
+    Real **gradient_species = this->gradient_species_.data();
+    Real **diffusion_dt = this->diffusion_dt_.data();
+    inner_operator_.forEachEntry(
+        index_i, [&](size_t index_j, const Real *coefficients)
+        {
+            for (size_t m = 0; m != number_of_species; ++m)
+            {
+                Real phi_ij = gradient_species[m][index_i] - gradient_species[m][index_j];
+                diffusion_dt[m][index_i] += coefficients[m] * phi_ij;
+            }
+        });
+}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+template <typename... Args>
+DiffusionRelaxation<Dirichlet<Assembled<ContactKernelGradientType>>, DiffusionType>::
+    DiffusionRelaxation(Args &&...args)
+    : DiffusionRelaxation<Dirichlet<ContactKernelGradientType>, DiffusionType>(std::forward<Args>(args)...),
+      contact_operators_(this->contact_configuration_.size()) {}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+void DiffusionRelaxation<Dirichlet<Assembled<ContactKernelGradientType>>, DiffusionType>::setupDynamics(Real dt)
+{
+    for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
+    {
+        if (contact_operators_[k].isAssembled())
+            continue;
+
+        Real *wall_Vol_k = this->contact_Vol_[k];
+        contact_operators_[k].assemble(
+            *this->contact_configuration_[k], this->particles_->TotalRealParticles(), this->diffusions_.size(),
+            [&](size_t index_i, Neighborhood &contact_neighborhood, size_t n, Real *coefficients)
+            {
+                size_t index_j = contact_neighborhood.j_[n];
+                Real dW_ijV_j = contact_neighborhood.dW_ij_[n] * wall_Vol_k[index_j];
+                Vecd &e_ij = contact_neighborhood.e_ij_[n];
+
+                const Vecd &grad_ijV_j = this->contact_kernel_gradients_[k](index_i, index_j, dW_ijV_j, e_ij);
+                Real area_ij = 2.0 * grad_ijV_j.dot(e_ij) / contact_neighborhood.r_ij_[n];
+                for (size_t m = 0; m < this->diffusions_.size(); ++m)
+                {
+                    coefficients[m] =
+                        this->diffusions_[m]->getInterParticleDiffusionCoeff(index_i, index_i, e_ij) * area_ij;
+                }
+            });
+    }
+}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+void DiffusionRelaxation<Dirichlet<Assembled<ContactKernelGradientType>>, DiffusionType>::
+    interaction(size_t index_i, Real dt)
+{
+    size_t number_of_species = this->diffusions_.size();
+    Real **gradient_species = this->gradient_species_.data();
+    Real **diffusion_dt = this->diffusion_dt_.data();
+    for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
+    {
+        Real **gradient_species_k = this->contact_gradient_species_[k].data();
+        contact_operators_[k].forEachEntry(
+            index_i, [&](size_t index_j, const Real *coefficients)
+            {
+                for (size_t m = 0; m != number_of_species; ++m)
+                {
+                    Real phi_ij = 2.0 * (gradient_species[m][index_i] - gradient_species_k[m][index_j]);
+                    diffusion_dt[m][index_i] += coefficients[m] * phi_ij;
+                }
+            });
+    }
+}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+template <typename... Args>
+DiffusionRelaxation<Neumann<Assembled<ContactKernelGradientType>>, DiffusionType>::
+    DiffusionRelaxation(Args &&...args)
+    : DiffusionRelaxation<Neumann<ContactKernelGradientType>, DiffusionType>(std::forward<Args>(args)...),
+      contact_operators_(this->contact_configuration_.size()) {}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+void DiffusionRelaxation<Neumann<Assembled<ContactKernelGradientType>>, DiffusionType>::setupDynamics(Real dt)
+{
+    for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
+    {
+        if (contact_operators_[k].isAssembled())
+            continue;
+
+        Vecd *n_k = this->contact_n_[k];
+        Real *Vol_k = this->contact_Vol_[k];
+        // the surface area does not depend on species, one coefficient is shared by all
+        contact_operators_[k].assemble(
+            *this->contact_configuration_[k], this->particles_->TotalRealParticles(), 1,
+            [&](size_t index_i, Neighborhood &contact_neighborhood, size_t n, Real *coefficients)
+            {
+                size_t index_j = contact_neighborhood.j_[n];
+                Real dW_ijV_j = contact_neighborhood.dW_ij_[n] * Vol_k[index_j];
+                Vecd &e_ij = contact_neighborhood.e_ij_[n];
+
+                const Vecd &grad_ijV_j = this->contact_kernel_gradients_[k](index_i, index_j, dW_ijV_j, e_ij);
+                Vecd n_ij = this->n_[index_i] - n_k[index_j];
+                coefficients[0] = grad_ijV_j.dot(n_ij);
+            });
+    }
+}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+void DiffusionRelaxation<Neumann<Assembled<ContactKernelGradientType>>, DiffusionType>::
+    interaction(size_t index_i, Real dt)
+{
+    size_t number_of_species = this->diffusions_.size();
+    Real **diffusion_dt = this->diffusion_dt_.data();
+    for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
+    {
+        Real **diffusive_flux_k = this->contact_diffusive_flux_[k].data();
+        contact_operators_[k].forEachEntry(
+            index_i, [&](size_t index_j, const Real *coefficients)
+            {
+                for (size_t m = 0; m != number_of_species; ++m)
+                {
+                    diffusion_dt[m][index_i] += coefficients[0] * diffusive_flux_k[m][index_j];
+                }
+            });
+    }
+}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+template <typename... Args>
+DiffusionRelaxation<Robin<Assembled<ContactKernelGradientType>>, DiffusionType>::
+    DiffusionRelaxation(Args &&...args)
+    : DiffusionRelaxation<Robin<ContactKernelGradientType>, DiffusionType>(std::forward<Args>(args)...),
+      contact_operators_(this->contact_configuration_.size()) {}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+void DiffusionRelaxation<Robin<Assembled<ContactKernelGradientType>>, DiffusionType>::setupDynamics(Real dt)
+{
+    for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
+    {
+        if (contact_operators_[k].isAssembled())
+            continue;
+
+        Vecd *n_k = this->contact_n_[k];
+        Real *Vol_k = this->contact_Vol_[k];
+        // the surface area does not depend on species, one coefficient is shared by all
+        contact_operators_[k].assemble(
+            *this->contact_configuration_[k], this->particles_->TotalRealParticles(), 1,
+            [&](size_t index_i, Neighborhood &contact_neighborhood, size_t n, Real *coefficients)
+            {
+                size_t index_j = contact_neighborhood.j_[n];
+                Real dW_ijV_j = contact_neighborhood.dW_ij_[n] * Vol_k[index_j];
+                Vecd &e_ij = contact_neighborhood.e_ij_[n];
+
+                const Vecd &grad_ijV_j = this->contact_kernel_gradients_[k](index_i, index_j, dW_ijV_j, e_ij);
+                Vecd n_ij = this->n_[index_i] - n_k[index_j];
+                coefficients[0] = grad_ijV_j.dot(n_ij);
+            });
+    }
+}
+//=================================================================================================//
+template <class ContactKernelGradientType, class DiffusionType>
+void DiffusionRelaxation<Robin<Assembled<ContactKernelGradientType>>, DiffusionType>::
+    interaction(size_t index_i, Real dt)
+{
+    this->resetContactTransfer(index_i);
+    size_t number_of_species = this->diffusions_.size();
+    Real **diffusion_species = this->diffusion_species_.data();
+    for (size_t k = 0; k < this->contact_configuration_.size(); ++k)
+    {
+        Real **transfer_k = this->contact_transfer_[k].data();
+        Real **convection_k = this->contact_convection_[k].data();
+        Real **species_infinity_k = this->contact_species_infinity_[k].data();
+        contact_operators_[k].forEachEntry(
+            index_i, [&](size_t index_j, const Real *coefficients)
+            {
+                for (size_t m = 0; m != number_of_species; ++m)
+                {
+                    Real phi_ij = *species_infinity_k[m] - diffusion_species[m][index_i];
+                    transfer_k[m][index_i] += convection_k[m][index_j] * phi_ij * coefficients[0];
+                }
+            });
+    }
+    this->accumulateDiffusionRate(index_i);
+}
+//=================================================================================================//
 template <class DiffusionRelaxationType>
 template <typename... Args>
 RungeKuttaStep<DiffusionRelaxationType>::RungeKuttaStep(Args &&...args)
@@ -31,6 +31,7 @@
  *			InteractionSplit is InteractionDynamics but using spliting algorithm;
  *			InteractionWithUpdate is with particle interaction with its neighbors and then update their states;
  *			Dynamics1Level is the most complex dynamics, has successive three steps: initialization, interaction and update.
+ *			EdgeSweepWithUpdate is InteractionWithUpdate on a static neighborhood, evaluating each pair only once.
  *			In order to avoid misusing of the above algorithms, type traits are used to make sure that the matching between
  *			the algorithm and local dynamics. For example, the LocalDynamics which matches InteractionDynamics must have
  *			the function interaction() but should not have the function update() or initialize().
@@ -54,6 +55,7 @@
 #include "base_particle_dynamics.h"
 #include "cell_linked_list.hpp"
 #include "particle_iterators.h"
+#include "static_neighborhood.h"
 
 #include <type_traits>
 
@@ -89,6 +91,16 @@ struct has_update<T, std::void_t<decltype(&T::update)>> : std::true_type
 {
 };
 
+template <class T, class = void>
+struct has_body_relations : std::false_type
+{
+};
+
+template <class T>
+struct has_body_relations<T, std::void_t<decltype(&T::getBodyRelations)>> : std::true_type
+{
+};
+
 using namespace execution;
 
 /**
@@ -149,6 +161,73 @@ class ReduceDynamics : public LocalDynamicsType,
     };
 };
 
+/**
+ * @class InteractionWorkload
+ * @brief The neighbor offset summing up the neighbor counts of the configurations used by an interaction,
+ * used for splitting the interaction loop into chunks of equal work.
+ * The offset is only rebuilt when one of the configurations has been updated.
+ */
+class InteractionWorkload
+{
+  public:
+    InteractionWorkload(BaseParticles &particles, StdVec<SPHRelation *> body_relations)
+        : particles_(particles), body_relations_(body_relations),
+          configuration_updates_(body_relations.size(), 0)
+    {
+        for (SPHRelation *relation : body_relations_)
+        {
+            if (BaseInnerRelation *inner = dynamic_cast<BaseInnerRelation *>(relation))
+                configurations_.push_back(&inner->inner_configuration_);
+            if (BaseContactRelation *contact = dynamic_cast<BaseContactRelation *>(relation))
+            {
+                for (ParticleConfiguration &configuration : contact->contact_configuration_)
+                    configurations_.push_back(&configuration);
+            }
+        }
+    };
+    virtual ~InteractionWorkload(){};
+
+    UnsignedInt *NeighborOffset()
+    {
+        bool is_configuration_updated = neighbor_offset_.size() != particles_.TotalRealParticles() + 1;
+        for (size_t k = 0; k != body_relations_.size(); ++k)
+        {
+            size_t total_updates = body_relations_[k]->TotalConfigurationUpdates();
+            is_configuration_updated = is_configuration_updated || total_updates != configuration_updates_[k];
+            configuration_updates_[k] = total_updates;
+        }
+
+        if (is_configuration_updated)
+            updateNeighborOffset();
+        return neighbor_offset_.data();
+    };
+
+  protected:
+    BaseParticles &particles_;
+    StdVec<SPHRelation *> body_relations_;
+    StdVec<size_t> configuration_updates_;
+    StdVec<ParticleConfiguration *> configurations_;
+    StdVec<UnsignedInt> neighbor_count_;
+    StdVec<UnsignedInt> neighbor_offset_;
+
+    void updateNeighborOffset()
+    {
+        size_t total_real_particles = particles_.TotalRealParticles();
+        neighbor_count_.resize(total_real_particles + 1);
+        neighbor_offset_.resize(total_real_particles + 1);
+        particle_for(execution::ParallelPolicy(), IndexRange(0, total_real_particles),
+                     [&](size_t index_i)
+                     {
+                         UnsignedInt neighbor_count = 0;
+                         for (ParticleConfiguration *configuration : configurations_)
+                             neighbor_count += (*configuration)[index_i].current_size_;
+                         neighbor_count_[index_i] = neighbor_count;
+                     });
+        exclusive_scan(execution::ParallelPolicy(), neighbor_count_.data(), neighbor_offset_.data(),
+                       UnsignedInt(total_real_particles + 1), std::plus<UnsignedInt>());
+    };
+};
+
 /**
  * @class BaseInteractionDynamics
  * @brief This is the base class for particle interaction with other particles
@@ -169,6 +248,18 @@ class BaseInteractionDynamics : public LocalDynamicsType, public BaseDynamics<vo
     StdVec<BaseDynamics<void> *> post_processes_;
     /** run the main interaction step between particles. */
     virtual void runMainStep(Real dt) = 0;
+    /** split the interaction loop into chunks of equal neighbor counts instead of equal particle numbers. */
+    void enableWorkWeighting()
+    {
+        StdVec<SPHRelation *> body_relations;
+        if constexpr (has_body_relations<LocalDynamicsType>::value)
+            this->getBodyRelations(body_relations);
+        else
+            addDelegatedRelations(static_cast<LocalDynamicsType *>(this), body_relations);
+
+        workload_ = workload_ptr_keeper_.createPtr<InteractionWorkload>(
+            this->identifier_.getSPHBody().getBaseParticles(), body_relations);
+    };
 
     /** run the interactions between particles. */
     virtual void runInteraction(Real dt)
@@ -188,6 +279,10 @@ class BaseInteractionDynamics : public LocalDynamicsType, public BaseDynamics<vo
         this->setupDynamics(dt);
         runInteraction(dt);
     };
+
+  protected:
+    UniquePtrKeeper<InteractionWorkload> workload_ptr_keeper_;
+    InteractionWorkload *workload_ = nullptr;
 };
 
 /**
@@ -242,6 +337,14 @@ class InteractionDynamics : public BaseInteractionDynamics<LocalDynamicsType, Ex
     /** run the main interaction step between particles. */
     virtual void runMainStep(Real dt) override
     {
+        if (this->workload_ != nullptr)
+        {
+            particle_for(ExecutionPolicy(),
+                         this->identifier_.LoopRange(), this->workload_->NeighborOffset(),
+                         [&](size_t i) { this->interaction(i, dt); });
+            return;
+        }
+
         particle_for(ExecutionPolicy(),
                      this->identifier_.LoopRange(),
                      [&](size_t i) { this->interaction(i, dt); });
@@ -337,5 +440,71 @@ class Dynamics1Level : public InteractionDynamics<LocalDynamicsType, ExecutionPo
                      [&](size_t i) { this->update(i, dt); });
     };
 };
+
+/**
+ * @class EdgeSweepWithUpdate
+ * @brief This class carries out the inner interaction of a body whose particles do not move
+ * as a sweep over the unique pairs (edges) of a static neighborhood, and then updates the particle states.
+ * Each pair flux is evaluated once and gathered antisymmetrically,
+ * i.e. particle i obtains the flux and particle j the negative one.
+ * The local dynamics provides the FluxType, and the functions initialChangeRate, pairFlux,
+ * setChangeRate and update. The static neighborhood is built at the first execution if not yet.
+ */
+template <class LocalDynamicsType, class ExecutionPolicy = ParallelPolicy>
+class EdgeSweepWithUpdate : public LocalDynamicsType, public BaseDynamics<void>
+{
+    using FluxType = typename LocalDynamicsType::FluxType;
+
+  protected:
+    StaticInnerNeighborhood &static_neighborhood_;
+    StdLargeVec<FluxType> edge_flux_;
+
+  public:
+    template <typename... Args>
+    EdgeSweepWithUpdate(StaticInnerNeighborhood &static_neighborhood, Args &&... args)
+        : LocalDynamicsType(std::forward<Args>(args)...), BaseDynamics<void>(),
+          static_neighborhood_(static_neighborhood){};
+    virtual ~EdgeSweepWithUpdate(){};
+
+    virtual void exec(Real dt = 0.0) override
+    {
+        if (!static_neighborhood_.isBuilt())
+            static_neighborhood_.build();
+
+        this->setUpdated(this->getSPHBody());
+        this->setupDynamics(dt);
+
+        size_t *edge_i = static_neighborhood_.edge_i_.data();
+        size_t *edge_j = static_neighborhood_.edge_j_.data();
+        Vecd *e_ij = static_neighborhood_.e_ij_.data();
+        Real *dW_ijV_iV_j = static_neighborhood_.dW_ijV_iV_j_.data();
+        size_t *edge_offset = static_neighborhood_.edge_offset_.data();
+        size_t *particle_edge = static_neighborhood_.particle_edge_.data();
+
+        edge_flux_.resize(static_neighborhood_.NumberOfEdges());
+        FluxType *edge_flux = edge_flux_.data();
+        particle_for(ExecutionPolicy(),
+                     IndexRange(0, static_neighborhood_.NumberOfEdges()),
+                     [&](size_t edge)
+                     { edge_flux[edge] = this->pairFlux(edge_i[edge], edge_j[edge], e_ij[edge], dW_ijV_iV_j[edge]); });
+
+        particle_for(ExecutionPolicy(),
+                     IndexRange(0, static_neighborhood_.NumberOfParticles()),
+                     [&](size_t i)
+                     {
+                         FluxType change_rate = this->initialChangeRate(i);
+                         for (size_t k = edge_offset[i]; k != edge_offset[i + 1]; ++k)
+                         {
+                             size_t edge = particle_edge[k];
+                             if (edge_i[edge] == i)
+                                 change_rate += edge_flux[edge];
+                             else
+                                 change_rate -= edge_flux[edge];
+                         }
+                         this->setChangeRate(i, change_rate);
+                         this->update(i, dt);
+                     });
+    };
+};
 } // namespace SPH
 #endif // DYNAMICS_ALGORITHMS_H
@@ -34,4 +34,5 @@
 
 #include "near_wall_boundary.h"
 #include "fluid_boundary.h"
+#include "wave_relaxation_zone.h"
 #include "non_reflective_boundary.h"
@@ -35,7 +35,6 @@ EmitterInflowCondition::
     EmitterInflowCondition(BodyAlignedBoxByParticle &aligned_box_part)
     : BaseLocalDynamics<BodyPartByParticle>(aligned_box_part),
       fluid_(DynamicCast<Fluid>(this, particles_->getBaseMaterial())),
-      sorted_id_(particles_->ParticleSortedIds()),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
       vel_(particles_->getVariableDataByName<Vecd>("Velocity")),
       force_(particles_->getVariableDataByName<Vecd>("Force")),
@@ -47,45 +46,44 @@ EmitterInflowCondition::
       updated_transform_(aligned_box_.getTransform()),
       old_transform_(updated_transform_) {}
 //=================================================================================================//
-void EmitterInflowCondition ::update(size_t original_index_i, Real dt)
+void EmitterInflowCondition ::update(size_t index_i, Real dt)
 {
-    size_t sorted_index_i = sorted_id_[original_index_i];
-    Vecd frame_position = old_transform_.shiftBaseStationToFrame(pos_[sorted_index_i]);
-    Vecd frame_velocity = old_transform_.xformBaseVecToFrame(vel_[sorted_index_i]);
-    pos_[sorted_index_i] = updated_transform_.shiftFrameStationToBase(frame_position);
-    vel_[sorted_index_i] = updated_transform_.xformFrameVecToBase(getTargetVelocity(frame_position, frame_velocity));
-    rho_[sorted_index_i] = rho0_;
-    p_[sorted_index_i] = fluid_.getPressure(rho0_);
+    Vecd frame_position = old_transform_.shiftBaseStationToFrame(pos_[index_i]);
+    Vecd frame_velocity = old_transform_.xformBaseVecToFrame(vel_[index_i]);
+    pos_[index_i] = updated_transform_.shiftFrameStationToBase(frame_position);
+    vel_[index_i] = updated_transform_.xformFrameVecToBase(getTargetVelocity(frame_position, frame_velocity));
+    rho_[index_i] = rho0_;
+    p_[index_i] = fluid_.getPressure(rho0_);
 }
 //=================================================================================================//
 EmitterInflowInjection::
     EmitterInflowInjection(BodyAlignedBoxByParticle &aligned_box_part, ParticleBuffer<Base> &buffer)
     : BaseLocalDynamics<BodyPartByParticle>(aligned_box_part),
       fluid_(DynamicCast<Fluid>(this, particles_->getBaseMaterial())),
-      original_id_(particles_->ParticleOriginalIds()),
-      sorted_id_(particles_->ParticleSortedIds()),
       pos_(particles_->getVariableDataByName<Vecd>("Position")),
       rho_(particles_->getVariableDataByName<Real>("Density")),
       p_(particles_->getVariableDataByName<Real>("Pressure")),
+      body_part_id_(particles_->getVariableDataByName<int>("BodyPartID")),
       buffer_(buffer), aligned_box_(aligned_box_part.getAlignedBoxShape())
 {
     buffer_.checkParticlesReserved();
 }
 //=================================================================================================//
-void EmitterInflowInjection::update(size_t original_index_i, Real dt)
+void EmitterInflowInjection::update(size_t index_i, Real dt)
 {
-    size_t sorted_index_i = sorted_id_[original_index_i];
-    if (aligned_box_.checkUpperBound(pos_[sorted_index_i]))
+    if (aligned_box_.checkUpperBound(pos_[index_i]))
     {
         mutex_switch_to_real_.lock();
         buffer_.checkEnoughBuffer(*particles_);
-        particles_->createRealParticleFrom(sorted_index_i);
+        size_t new_index = particles_->createRealParticleFrom(index_i);
+        /** The injected particle leaves the emitter, and is no longer sorted with it. */
+        body_part_id_[new_index] = 0;
         mutex_switch_to_real_.unlock();
 
         /** Periodic bounding. */
-        pos_[sorted_index_i] = aligned_box_.getUpperPeriodic(pos_[sorted_index_i]);
-        rho_[sorted_index_i] = fluid_.ReferenceDensity();
-        p_[sorted_index_i] = fluid_.getPressure(rho_[sorted_index_i]);
+        pos_[index_i] = aligned_box_.getUpperPeriodic(pos_[index_i]);
+        rho_[index_i] = fluid_.ReferenceDensity();
+        p_[index_i] = fluid_.getPressure(rho_[index_i]);
     }
 }
 //=================================================================================================//
@@ -194,11 +194,10 @@ class EmitterInflowCondition : public BaseLocalDynamics<BodyPartByParticle>
     virtual ~EmitterInflowCondition(){};
 
     virtual void setupDynamics(Real dt = 0.0) override { updateTransform(); };
-    void update(size_t original_index_i, Real dt = 0.0);
+    void update(size_t index_i, Real dt = 0.0);
 
   protected:
     Fluid &fluid_;
-    UnsignedInt *sorted_id_;
     Vecd *pos_, *vel_, *force_;
     Real *rho_, *p_, *drho_dt_;
     /** inflow pressure condition */
@@ -224,15 +223,14 @@ class EmitterInflowInjection : public BaseLocalDynamics<BodyPartByParticle>
     EmitterInflowInjection(BodyAlignedBoxByParticle &aligned_box_part, ParticleBuffer<Base> &buffer);
     virtual ~EmitterInflowInjection(){};
 
-    void update(size_t original_index_i, Real dt = 0.0);
+    void update(size_t index_i, Real dt = 0.0);
 
   protected:
     std::mutex mutex_switch_to_real_; /**< mutex exclusion for memory conflict */
     Fluid &fluid_;
-    UnsignedInt *original_id_;
-    UnsignedInt *sorted_id_;
     Vecd *pos_;
     Real *rho_, *p_;
+    int *body_part_id_;
     ParticleBuffer<Base> &buffer_;
     AlignedBoxShape &aligned_box_;
 };
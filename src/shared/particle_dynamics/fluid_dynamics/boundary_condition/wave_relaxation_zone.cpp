@@ -0,0 +1,220 @@
+#include "wave_relaxation_zone.h"
+
+#include <random>
+
+namespace SPH
+{
+//=================================================================================================//
+TargetWave::TargetWave(Real water_depth, Real gravity, Real ramp_time)
+    : water_depth_(water_depth), gravity_(gravity), ramp_time_(ramp_time) {}
+//=================================================================================================//
+Real TargetWave::rampFactor(Real time)
+{
+    return time < ramp_time_ ? 0.5 * (1.0 - cos(Pi * time / ramp_time_)) : 1.0;
+}
+//=================================================================================================//
+Real TargetWave::waveNumber(Real angular_frequency)
+{
+    Real omega_square = angular_frequency * angular_frequency;
+    Real wave_number = omega_square / gravity_ / sqrt(tanh(omega_square * water_depth_ / gravity_));
+    for (size_t i = 0; i != 100; ++i)
+    {
+        Real tanh_kd = tanh(wave_number * water_depth_);
+        Real residual = gravity_ * wave_number * tanh_kd - omega_square;
+        Real derivative = gravity_ * tanh_kd + gravity_ * wave_number * water_depth_ * (1.0 - tanh_kd * tanh_kd);
+        Real increment = residual / derivative;
+        wave_number -= increment;
+        if (ABS(increment) < Eps * wave_number)
+            break;
+    }
+    return wave_number;
+}
+//=================================================================================================//
+Real TargetWave::SurfaceElevation(Real x, Real time)
+{
+    return rampFactor(time) * elevation(x, time);
+}
+//=================================================================================================//
+Vecd TargetWave::Velocity(const Vecd &position, Real time)
+{
+    Real eta = SurfaceElevation(position[0], time);
+    Real z = position[Dimensions - 1] - water_depth_;
+    Real stretched_z = SMIN((z - eta) * water_depth_ / (water_depth_ + eta), Real(0));
+    Vec2d velocity = rampFactor(time) * stretchedVelocity(position[0], stretched_z, time);
+
+    Vecd target_velocity = Vecd::Zero();
+    target_velocity[0] = velocity[0];
+    target_velocity[Dimensions - 1] = velocity[1];
+    return target_velocity;
+}
+//=================================================================================================//
+Real TargetWave::KinematicPressure(const Vecd &position, Real time)
+{
+    Real eta = SurfaceElevation(position[0], time);
+    Real z = position[Dimensions - 1] - water_depth_;
+    if (z > eta)
+        return 0.0;
+
+    Real stretched_z = (z - eta) * water_depth_ / (water_depth_ + eta);
+    Real dynamic_pressure = stretchedDynamicPressure(position[0], stretched_z, time) -
+                            stretchedDynamicPressure(position[0], 0.0, time);
+    return gravity_ * (eta - z) + rampFactor(time) * dynamic_pressure;
+}
+//=================================================================================================//
+LinearWave::LinearWave(Real water_depth, Real gravity, Real wave_height, Real wave_period,
+                       Real phase, Real ramp_time)
+    : LinearWave(water_depth, gravity, wave_period, ramp_time, size_t(1))
+{
+    addComponent(0.5 * wave_height, 2.0 * Pi / wave_period, phase);
+}
+//=================================================================================================//
+void LinearWave::addComponent(Real amplitude, Real angular_frequency, Real phase)
+{
+    components_.push_back(WaveComponent{amplitude, angular_frequency, waveNumber(angular_frequency), phase});
+}
+//=================================================================================================//
+Real LinearWave::elevation(Real x, Real time)
+{
+    Real eta = 0.0;
+    for (const WaveComponent &wave : components_)
+    {
+        eta += wave.amplitude_ * cos(wave.wave_number_ * x - wave.angular_frequency_ * time + wave.phase_);
+    }
+    return eta;
+}
+//=================================================================================================//
+Vec2d LinearWave::stretchedVelocity(Real x, Real z, Real time)
+{
+    Vec2d velocity = Vec2d::Zero();
+    for (const WaveComponent &wave : components_)
+    {
+        Real theta = wave.wave_number_ * x - wave.angular_frequency_ * time + wave.phase_;
+        Real kh = wave.wave_number_ * (z + water_depth_);
+        Real factor = wave.amplitude_ * wave.angular_frequency_ / sinh(wave.wave_number_ * water_depth_);
+        velocity += factor * Vec2d(cosh(kh) * cos(theta), sinh(kh) * sin(theta));
+    }
+    return velocity;
+}
+//=================================================================================================//
+Real LinearWave::stretchedDynamicPressure(Real x, Real z, Real time)
+{
+    Real pressure = 0.0;
+    for (const WaveComponent &wave : components_)
+    {
+        Real theta = wave.wave_number_ * x - wave.angular_frequency_ * time + wave.phase_;
+        pressure += gravity_ * wave.amplitude_ * cos(theta) *
+                    cosh(wave.wave_number_ * (z + water_depth_)) / cosh(wave.wave_number_ * water_depth_);
+    }
+    return pressure;
+}
+//=================================================================================================//
+JONSWAPWave::JONSWAPWave(Real water_depth, Real gravity, Real significant_wave_height, Real peak_period,
+                         Real ramp_time, Real peak_enhancement, size_t number_of_components,
+                         unsigned int random_seed)
+    : LinearWave(water_depth, gravity, peak_period, ramp_time, number_of_components)
+{
+    Real peak_frequency = 2.0 * Pi / peak_period;
+    Real lower_frequency = 0.5 * peak_frequency;
+    Real frequency_interval = 2.5 * peak_frequency / Real(number_of_components);
+    std::mt19937 random_engine(random_seed);
+    std::uniform_real_distribution<Real> random_phase(0.0, 2.0 * Pi);
+
+    StdVec<Real> amplitudes;
+    Real zeroth_moment = 0.0;
+    for (size_t i = 0; i != number_of_components; ++i)
+    {
+        Real frequency = lower_frequency + (Real(i) + 0.5) * frequency_interval;
+        Real sigma = frequency < peak_frequency ? 0.07 : 0.09;
+        Real peak_ratio = (frequency - peak_frequency) / (sigma * peak_frequency);
+        Real spectrum = pow(frequency, -5) * exp(-1.25 * pow(peak_frequency / frequency, 4)) *
+                        pow(peak_enhancement, exp(-0.5 * peak_ratio * peak_ratio));
+        amplitudes.push_back(sqrt(2.0 * spectrum * frequency_interval));
+        zeroth_moment += 0.5 * amplitudes.back() * amplitudes.back();
+    }
+
+    // the spectrum is scaled to the significant wave height 4 * sqrt(m_0)
+    Real scaling = significant_wave_height / (4.0 * sqrt(zeroth_moment));
+    for (size_t i = 0; i != number_of_components; ++i)
+    {
+        Real frequency = lower_frequency + (Real(i) + 0.5) * frequency_interval;
+        addComponent(scaling * amplitudes[i], frequency, random_phase(random_engine));
+    }
+}
+//=================================================================================================//
+StokesSecondOrderWave::StokesSecondOrderWave(Real water_depth, Real gravity, Real wave_height,
+                                             Real wave_period, Real ramp_time)
+    : TargetWave(water_depth, gravity, ramp_time), amplitude_(0.5 * wave_height),
+      angular_frequency_(2.0 * Pi / wave_period), wave_number_(waveNumber(angular_frequency_)) {}
+//=================================================================================================//
+Real StokesSecondOrderWave::elevation(Real x, Real time)
+{
+    Real theta = wave_number_ * x - angular_frequency_ * time;
+    Real kd = wave_number_ * water_depth_;
+    return amplitude_ * cos(theta) +
+           0.25 * wave_number_ * amplitude_ * amplitude_ * cosh(kd) * (2.0 + cosh(2.0 * kd)) /
+               pow(sinh(kd), 3) * cos(2.0 * theta);
+}
+//=================================================================================================//
+Vec2d StokesSecondOrderWave::stretchedVelocity(Real x, Real z, Real time)
+{
+    Real theta = wave_number_ * x - angular_frequency_ * time;
+    Real kd = wave_number_ * water_depth_;
+    Real kh = wave_number_ * (z + water_depth_);
+    Real first_order = amplitude_ * angular_frequency_ / sinh(kd);
+    Real second_order = 0.75 * amplitude_ * amplitude_ * angular_frequency_ * wave_number_ / pow(sinh(kd), 4);
+    return first_order * Vec2d(cosh(kh) * cos(theta), sinh(kh) * sin(theta)) +
+           second_order * Vec2d(cosh(2.0 * kh) * cos(2.0 * theta), sinh(2.0 * kh) * sin(2.0 * theta));
+}
+//=================================================================================================//
+Real StokesSecondOrderWave::stretchedDynamicPressure(Real x, Real z, Real time)
+{
+    Real theta = wave_number_ * x - angular_frequency_ * time;
+    Real kd = wave_number_ * water_depth_;
+    Real kh = wave_number_ * (z + water_depth_);
+    Real second_order = gravity_ * wave_number_ * amplitude_ * amplitude_ / sinh(2.0 * kd);
+    return gravity_ * amplitude_ * cosh(kh) / cosh(kd) * cos(theta) +
+           0.75 * second_order * (cosh(2.0 * kh) / (sinh(kd) * sinh(kd)) - 1.0 / 3.0) * cos(2.0 * theta) -
+           0.25 * second_order * (cosh(2.0 * kh) - 1.0);
+}
+//=================================================================================================//
+namespace fluid_dynamics
+{
+//=================================================================================================//
+WaveRelaxationZone::WaveRelaxationZone(BodyRegionByCell &body_part, TargetWave &target_wave,
+                                       bool is_outer_edge_upper, Real relaxation_factor)
+    : BaseFlowBoundaryCondition(body_part),
+      fluid_(DynamicCast<Fluid>(this, particles_->getBaseMaterial())), rho0_(fluid_.ReferenceDensity()),
+      target_wave_(target_wave), relaxation_factor_(relaxation_factor), relaxation_rate_(0.0),
+      physical_time_(sph_system_.getSystemVariableDataByName<Real>("PhysicalTime"))
+{
+    BoundingBox zone_bounds = body_part.getBodyPartShape().getBounds();
+    zone_length_ = zone_bounds.second_[0] - zone_bounds.first_[0];
+    inner_edge_ = is_outer_edge_upper ? zone_bounds.first_[0] : zone_bounds.second_[0];
+    outer_direction_ = is_outer_edge_upper ? 1.0 : -1.0;
+}
+//=================================================================================================//
+void WaveRelaxationZone::setupDynamics(Real dt)
+{
+    relaxation_rate_ = relaxation_factor_ / target_wave_.CharacteristicPeriod();
+}
+//=================================================================================================//
+Real WaveRelaxationZone::SpatialWeight(Real x)
+{
+    Real xi = SMIN(SMAX(outer_direction_ * (x - inner_edge_) / zone_length_, Real(0)), Real(1));
+    return (exp(pow(xi, 3.5)) - 1.0) / (exp(1.0) - 1.0);
+}
+//=================================================================================================//
+void WaveRelaxationZone::update(size_t index_i, Real dt)
+{
+    Real relaxation = 1.0 - exp(-relaxation_rate_ * SpatialWeight(pos_[index_i][0]) * dt);
+    Vecd target_velocity = target_wave_.Velocity(pos_[index_i], *physical_time_);
+    Real target_density = fluid_.DensityFromPressure(
+        rho0_ * target_wave_.KinematicPressure(pos_[index_i], *physical_time_));
+
+    vel_[index_i] += relaxation * (target_velocity - vel_[index_i]);
+    rho_[index_i] += relaxation * (target_density - rho_[index_i]);
+    p_[index_i] = fluid_.getPressure(rho_[index_i]);
+}
+//=================================================================================================//
+} // namespace fluid_dynamics
+} // namespace SPH
@@ -0,0 +1,230 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	wave_relaxation_zone.h
+ * @brief 	Relaxation zones for generating and absorbing waves in numerical wave tanks.
+ * @details The velocity, density and pressure of the fluid particles in a zone
+ *          are relaxed toward a target wave field with a smooth spatial weight,
+ *          which vanishes at the inner edge and is the strongest at the outer edge of the zone.
+ *          The waves propagate along x direction, the last axis points upward
+ *          and the flat bed is at zero height.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef WAVE_RELAXATION_ZONE_H
+#define WAVE_RELAXATION_ZONE_H
+
+#include "fluid_boundary.h"
+
+namespace SPH
+{
+/**
+ * @class TargetWave
+ * @brief Analytical wave field in a flume of constant water depth.
+ * The kinematics and the dynamic pressure are evaluated after stretching
+ * the water column to the instantaneous free surface (Wheeler stretching),
+ * so that the pressure vanishes at the free surface.
+ * The wave is ramped up smoothly from still water within the given ramp time.
+ */
+class TargetWave
+{
+  public:
+    TargetWave(Real water_depth, Real gravity, Real ramp_time);
+    virtual ~TargetWave(){};
+
+    Real WaterDepth() { return water_depth_; };
+    /** characteristic period, e.g. the peak period of an irregular wave. */
+    virtual Real CharacteristicPeriod() = 0;
+    /** free surface elevation above the still water level. */
+    Real SurfaceElevation(Real x, Real time);
+    Vecd Velocity(const Vecd &position, Real time);
+    /** pressure over density, zero at and above the free surface. */
+    Real KinematicPressure(const Vecd &position, Real time);
+
+  protected:
+    Real water_depth_, gravity_, ramp_time_;
+
+    Real rampFactor(Real time);
+    /** wave number from the linear dispersion relation. */
+    Real waveNumber(Real angular_frequency);
+    virtual Real elevation(Real x, Real time) = 0;
+    /** horizontal and vertical velocities at the height z in [-water_depth, 0] of the still water column. */
+    virtual Vec2d stretchedVelocity(Real x, Real z, Real time) = 0;
+    /** dynamic pressure over density at the height z in [-water_depth, 0] of the still water column. */
+    virtual Real stretchedDynamicPressure(Real x, Real z, Real time) = 0;
+};
+
+/**
+ * @class StillWater
+ * @brief Target of an absorbing zone.
+ */
+class StillWater : public TargetWave
+{
+  public:
+    StillWater(Real water_depth, Real gravity, Real characteristic_period)
+        : TargetWave(water_depth, gravity, 0.0), characteristic_period_(characteristic_period){};
+    virtual ~StillWater(){};
+    virtual Real CharacteristicPeriod() override { return characteristic_period_; };
+
+  protected:
+    Real characteristic_period_;
+    virtual Real elevation(Real x, Real time) override { return 0.0; };
+    virtual Vec2d stretchedVelocity(Real x, Real z, Real time) override { return Vec2d::Zero(); };
+    virtual Real stretchedDynamicPressure(Real x, Real z, Real time) override { return 0.0; };
+};
+
+/**
+ * @class LinearWave
+ * @brief Regular linear (Airy) wave or a superposition of linear wave components.
+ */
+class LinearWave : public TargetWave
+{
+  public:
+    LinearWave(Real water_depth, Real gravity, Real wave_height, Real wave_period,
+               Real phase = 0.0, Real ramp_time = 0.0);
+    virtual ~LinearWave(){};
+    virtual Real CharacteristicPeriod() override { return characteristic_period_; };
+    Real WaveLength() { return 2.0 * Pi / components_[0].wave_number_; };
+
+  protected:
+    struct WaveComponent
+    {
+        Real amplitude_, angular_frequency_, wave_number_, phase_;
+    };
+    Real characteristic_period_;
+    StdVec<WaveComponent> components_;
+
+    /** for derived classes which add the components themselves. */
+    LinearWave(Real water_depth, Real gravity, Real characteristic_period, Real ramp_time,
+               size_t number_of_components)
+        : TargetWave(water_depth, gravity, ramp_time), characteristic_period_(characteristic_period)
+    {
+        components_.reserve(number_of_components);
+    };
+    void addComponent(Real amplitude, Real angular_frequency, Real phase);
+    virtual Real elevation(Real x, Real time) override;
+    virtual Vec2d stretchedVelocity(Real x, Real z, Real time) override;
+    virtual Real stretchedDynamicPressure(Real x, Real z, Real time) override;
+};
+
+/**
+ * @class JONSWAPWave
+ * @brief Irregular wave as a superposition of linear components sampled from the JONSWAP spectrum
+ * in the angular frequency range between 0.5 and 3 times the peak frequency with random phases.
+ */
+class JONSWAPWave : public LinearWave
+{
+  public:
+    JONSWAPWave(Real water_depth, Real gravity, Real significant_wave_height, Real peak_period,
+                Real ramp_time, Real peak_enhancement = 3.3, size_t number_of_components = 64,
+                unsigned int random_seed = 1);
+    virtual ~JONSWAPWave(){};
+};
+
+/**
+ * @class StokesSecondOrderWave
+ * @brief Regular Stokes wave up to the second order.
+ */
+class StokesSecondOrderWave : public TargetWave
+{
+  public:
+    StokesSecondOrderWave(Real water_depth, Real gravity, Real wave_height, Real wave_period, Real ramp_time = 0.0);
+    virtual ~StokesSecondOrderWave(){};
+    virtual Real CharacteristicPeriod() override { return 2.0 * Pi / angular_frequency_; };
+    Real WaveLength() { return 2.0 * Pi / wave_number_; };
+
+  protected:
+    Real amplitude_, angular_frequency_, wave_number_;
+    virtual Real elevation(Real x, Real time) override;
+    virtual Vec2d stretchedVelocity(Real x, Real z, Real time) override;
+    virtual Real stretchedDynamicPressure(Real x, Real z, Real time) override;
+};
+
+namespace fluid_dynamics
+{
+/**
+ * @class WaveRelaxationZone
+ * @brief The fluid state is relaxed toward the target wave with the rate
+ * relaxation_factor * weight / CharacteristicPeriod, where the weight
+ * (exp(xi^3.5) - 1) / (exp(1) - 1) grows from zero at the inner edge (xi = 0)
+ * to one at the outer edge (xi = 1) of the zone.
+ * As the relaxation is a rate, the result is not sensitive to the time step size.
+ * The default factor is large enough for the fluid to follow the target
+ * over the outer half of a zone of one wavelength.
+ * The zone is applied after the density relaxation in each acoustic time step,
+ * as the relaxed density would be overwritten by the density summation
+ * if it were applied once per advection time step.
+ */
+class WaveRelaxationZone : public BaseFlowBoundaryCondition
+{
+  public:
+    WaveRelaxationZone(BodyRegionByCell &body_part, TargetWave &target_wave,
+                       bool is_outer_edge_upper, Real relaxation_factor);
+    virtual ~WaveRelaxationZone(){};
+    virtual void setupDynamics(Real dt = 0.0) override;
+    void update(size_t index_i, Real dt = 0.0);
+
+  protected:
+    Fluid &fluid_;
+    Real rho0_;
+    TargetWave &target_wave_;
+    Real inner_edge_, zone_length_, outer_direction_;
+    Real relaxation_factor_, relaxation_rate_;
+    Real *physical_time_;
+
+    Real SpatialWeight(Real x);
+};
+
+/**
+ * @class WaveGeneratingZone
+ * @brief The zone at the lower end of the flume in x direction,
+ * which generates the target wave and absorbs the waves reflected back to it.
+ */
+class WaveGeneratingZone : public WaveRelaxationZone
+{
+  public:
+    WaveGeneratingZone(BodyRegionByCell &body_part, TargetWave &target_wave, Real relaxation_factor = 100.0)
+        : WaveRelaxationZone(body_part, target_wave, false, relaxation_factor){};
+    virtual ~WaveGeneratingZone(){};
+};
+
+/**
+ * @class WaveAbsorbingZone
+ * @brief The zone at the upper end of the flume in x direction, which relaxes the fluid to still water.
+ * A length of one wavelength of the absorbed waves with the given period is usually sufficient.
+ */
+class WaveAbsorbingZone : public WaveRelaxationZone
+{
+  public:
+    WaveAbsorbingZone(BodyRegionByCell &body_part, Real water_depth, Real gravity,
+                      Real wave_period, Real relaxation_factor = 100.0)
+        : WaveRelaxationZone(body_part, still_water_, true, relaxation_factor),
+          still_water_(water_depth, gravity, wave_period){};
+    virtual ~WaveAbsorbingZone(){};
+
+  protected:
+    StillWater still_water_;
+};
+} // namespace fluid_dynamics
+} // namespace SPH
+#endif // WAVE_RELAXATION_ZONE_H
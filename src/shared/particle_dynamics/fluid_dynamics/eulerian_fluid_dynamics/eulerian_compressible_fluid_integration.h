@@ -57,11 +57,17 @@ template <class RiemannSolverType>
 class EulerianCompressibleIntegration1stHalf : public BaseIntegrationInCompressible
 {
   public:
+    typedef Vecd FluxType;
+
     explicit EulerianCompressibleIntegration1stHalf(BaseInnerRelation &inner_relation, Real limiter_parameter = 5.0);
     virtual ~EulerianCompressibleIntegration1stHalf(){};
     RiemannSolverType riemann_solver_;
     void interaction(size_t index_i, Real dt = 0.0);
     void update(size_t index_i, Real dt = 0.0);
+    /** interfaces for the edge sweep on a static neighborhood */
+    Vecd initialChangeRate(size_t index_i) { return force_prior_[index_i]; };
+    Vecd pairFlux(size_t index_i, size_t index_j, const Vecd &e_ij, Real dW_ijV_iV_j);
+    void setChangeRate(size_t index_i, const Vecd &change_rate) { force_[index_i] = change_rate; };
 };
 using EulerianCompressibleIntegration1stHalfNoRiemann = EulerianCompressibleIntegration1stHalf<NoRiemannSolverInCompressibleEulerianMethod>;
 using EulerianCompressibleIntegration1stHalfHLLCRiemann = EulerianCompressibleIntegration1stHalf<HLLCRiemannSolver>;
@@ -75,11 +81,24 @@ template <class RiemannSolverType>
 class EulerianCompressibleIntegration2ndHalf : public BaseIntegrationInCompressible
 {
   public:
+    typedef Vec2d FluxType; /**< mass and energy change rates */
+
     explicit EulerianCompressibleIntegration2ndHalf(BaseInnerRelation &inner_relation, Real limiter_parameter = 5.0);
     virtual ~EulerianCompressibleIntegration2ndHalf(){};
     RiemannSolverType riemann_solver_;
     void interaction(size_t index_i, Real dt = 0.0);
     void update(size_t index_i, Real dt = 0.0);
+    /** interfaces for the edge sweep on a static neighborhood */
+    Vec2d initialChangeRate(size_t index_i)
+    {
+        return Vec2d(0.0, force_prior_[index_i].dot(vel_[index_i])); // TODO: not conservative formulation
+    };
+    Vec2d pairFlux(size_t index_i, size_t index_j, const Vecd &e_ij, Real dW_ijV_iV_j);
+    void setChangeRate(size_t index_i, const Vec2d &change_rate)
+    {
+        dmass_dt_[index_i] = change_rate[0];
+        dE_dt_[index_i] = change_rate[1];
+    };
 };
 using EulerianCompressibleIntegration2ndHalfNoRiemann = EulerianCompressibleIntegration2ndHalf<NoRiemannSolverInCompressibleEulerianMethod>;
 using EulerianCompressibleIntegration2ndHalfHLLCRiemann = EulerianCompressibleIntegration2ndHalf<HLLCRiemannSolver>;
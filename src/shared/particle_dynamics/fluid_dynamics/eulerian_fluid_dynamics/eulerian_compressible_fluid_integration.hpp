@@ -15,25 +15,30 @@ EulerianCompressibleIntegration1stHalf<RiemannSolverType>::
       riemann_solver_(compressible_fluid_, compressible_fluid_, limiter_parameter) {}
 //=================================================================================================//
 template <class RiemannSolverType>
-void EulerianCompressibleIntegration1stHalf<RiemannSolverType>::interaction(size_t index_i, Real dt)
+Vecd EulerianCompressibleIntegration1stHalf<RiemannSolverType>::
+    pairFlux(size_t index_i, size_t index_j, const Vecd &e_ij, Real dW_ijV_iV_j)
 {
     Real energy_per_volume_i = E_[index_i] / Vol_[index_i];
     CompressibleFluidState state_i(rho_[index_i], vel_[index_i], p_[index_i], energy_per_volume_i);
-    Vecd momentum_change_rate = force_prior_[index_i];
+    Real energy_per_volume_j = E_[index_j] / Vol_[index_j];
+    CompressibleFluidState state_j(rho_[index_j], vel_[index_j], p_[index_j], energy_per_volume_j);
+    CompressibleFluidStarState interface_state = riemann_solver_.getInterfaceState(state_i, state_j, e_ij);
+    Matd convect_flux = interface_state.rho_ * interface_state.vel_ * interface_state.vel_.transpose();
+    return -2.0 * dW_ijV_iV_j * (convect_flux + interface_state.p_ * Matd::Identity()) * e_ij;
+}
+//=================================================================================================//
+template <class RiemannSolverType>
+void EulerianCompressibleIntegration1stHalf<RiemannSolverType>::interaction(size_t index_i, Real dt)
+{
+    Vecd momentum_change_rate = initialChangeRate(index_i);
     Neighborhood &inner_neighborhood = inner_configuration_[index_i];
     for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
     {
         size_t index_j = inner_neighborhood.j_[n];
-        Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * Vol_[index_j];
-        Vecd &e_ij = inner_neighborhood.e_ij_[n];
-
-        Real energy_per_volume_j = E_[index_j] / Vol_[index_j];
-        CompressibleFluidState state_j(rho_[index_j], vel_[index_j], p_[index_j], energy_per_volume_j);
-        CompressibleFluidStarState interface_state = riemann_solver_.getInterfaceState(state_i, state_j, e_ij);
-        Matd convect_flux = interface_state.rho_ * interface_state.vel_ * interface_state.vel_.transpose();
-        momentum_change_rate -= 2.0 * Vol_[index_i] * dW_ijV_j * (convect_flux + interface_state.p_ * Matd::Identity()) * e_ij;
+        Real dW_ijV_iV_j = inner_neighborhood.dW_ij_[n] * Vol_[index_i] * Vol_[index_j];
+        momentum_change_rate += pairFlux(index_i, index_j, inner_neighborhood.e_ij_[n], dW_ijV_iV_j);
     }
-    force_[index_i] = momentum_change_rate;
+    setChangeRate(index_i, momentum_change_rate);
 }
 //=================================================================================================//
 template <class RiemannSolverType>
@@ -50,28 +55,31 @@ EulerianCompressibleIntegration2ndHalf<RiemannSolverType>::
       riemann_solver_(compressible_fluid_, compressible_fluid_, limiter_parameter) {}
 //=================================================================================================//
 template <class RiemannSolverType>
-void EulerianCompressibleIntegration2ndHalf<RiemannSolverType>::interaction(size_t index_i, Real dt)
+Vec2d EulerianCompressibleIntegration2ndHalf<RiemannSolverType>::
+    pairFlux(size_t index_i, size_t index_j, const Vecd &e_ij, Real dW_ijV_iV_j)
 {
     Real energy_per_volume_i = E_[index_i] / Vol_[index_i];
     CompressibleFluidState state_i(rho_[index_i], vel_[index_i], p_[index_i], energy_per_volume_i);
-    Real mass_change_rate = 0.0;
-    Real energy_change_rate = force_prior_[index_i].dot(vel_[index_i]); // TODO: not conservative formulation
+    Real energy_per_volume_j = E_[index_j] / Vol_[index_j];
+    CompressibleFluidState state_j(rho_[index_j], vel_[index_j], p_[index_j], energy_per_volume_j);
+    CompressibleFluidStarState interface_state = riemann_solver_.getInterfaceState(state_i, state_j, e_ij);
+    Real mass_flux = -2.0 * dW_ijV_iV_j * (interface_state.rho_ * interface_state.vel_).dot(e_ij);
+    Real energy_flux = -2.0 * dW_ijV_iV_j * ((interface_state.E_ + interface_state.p_) * interface_state.vel_).dot(e_ij);
+    return Vec2d(mass_flux, energy_flux);
+}
+//=================================================================================================//
+template <class RiemannSolverType>
+void EulerianCompressibleIntegration2ndHalf<RiemannSolverType>::interaction(size_t index_i, Real dt)
+{
+    Vec2d mass_and_energy_change_rate = initialChangeRate(index_i);
     Neighborhood &inner_neighborhood = inner_configuration_[index_i];
     for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
     {
         size_t index_j = inner_neighborhood.j_[n];
-        Vecd &e_ij = inner_neighborhood.e_ij_[n];
-        Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * Vol_[index_j];
-
-        Real energy_per_volume_j = E_[index_j] / Vol_[index_j];
-        CompressibleFluidState state_j(rho_[index_j], vel_[index_j], p_[index_j], energy_per_volume_j);
-        CompressibleFluidStarState interface_state = riemann_solver_.getInterfaceState(state_i, state_j, e_ij);
-
-        mass_change_rate -= 2.0 * Vol_[index_i] * dW_ijV_j * (interface_state.rho_ * interface_state.vel_).dot(e_ij);
-        energy_change_rate -= 2.0 * Vol_[index_i] * dW_ijV_j * ((interface_state.E_ + interface_state.p_) * interface_state.vel_).dot(e_ij);
+        Real dW_ijV_iV_j = inner_neighborhood.dW_ij_[n] * Vol_[index_i] * Vol_[index_j];
+        mass_and_energy_change_rate += pairFlux(index_i, index_j, inner_neighborhood.e_ij_[n], dW_ijV_iV_j);
     }
-    dmass_dt_[index_i] = mass_change_rate;
-    dE_dt_[index_i] = energy_change_rate;
+    setChangeRate(index_i, mass_and_energy_change_rate);
 }
 //=================================================================================================//
 template <class RiemannSolverType>
@@ -56,6 +56,8 @@ class EulerianIntegration1stHalf<Inner<>, RiemannSolverType>
     : public EulerianIntegration<DataDelegateInner>
 {
   public:
+    typedef Vecd FluxType;
+
     explicit EulerianIntegration1stHalf(BaseInnerRelation &inner_relation, Real limiter_parameter = 15.0);
     template <typename BodyRelationType, typename FirstArg>
     explicit EulerianIntegration1stHalf(ConstructorArgs<BodyRelationType, FirstArg> parameters)
@@ -63,6 +65,10 @@ class EulerianIntegration1stHalf<Inner<>, RiemannSolverType>
     virtual ~EulerianIntegration1stHalf(){};
     void interaction(size_t index_i, Real dt = 0.0);
     void update(size_t index_i, Real dt = 0.0);
+    /** interfaces for the edge sweep on a static neighborhood */
+    Vecd initialChangeRate(size_t index_i) { return Vecd::Zero(); };
+    Vecd pairFlux(size_t index_i, size_t index_j, const Vecd &e_ij, Real dW_ijV_iV_j);
+    void setChangeRate(size_t index_i, const Vecd &change_rate) { dmom_dt_[index_i] = change_rate; };
 
   protected:
     RiemannSolverType riemann_solver_;
@@ -97,6 +103,7 @@ class EulerianIntegration2ndHalf<Inner<>, RiemannSolverType>
 {
   public:
     typedef RiemannSolverType RiemannSolver;
+    typedef Real FluxType;
 
     explicit EulerianIntegration2ndHalf(BaseInnerRelation &inner_relation, Real limiter_parameter = 15.0);
     template <typename BodyRelationType, typename FirstArg>
@@ -105,6 +112,10 @@ class EulerianIntegration2ndHalf<Inner<>, RiemannSolverType>
     virtual ~EulerianIntegration2ndHalf(){};
     void interaction(size_t index_i, Real dt = 0.0);
     void update(size_t index_i, Real dt = 0.0);
+    /** interfaces for the edge sweep on a static neighborhood */
+    Real initialChangeRate(size_t index_i) { return 0.0; };
+    Real pairFlux(size_t index_i, size_t index_j, const Vecd &e_ij, Real dW_ijV_iV_j);
+    void setChangeRate(size_t index_i, Real change_rate) { dmass_dt_[index_i] = change_rate; };
 
   protected:
     RiemannSolverType riemann_solver_;
@@ -24,23 +24,28 @@ EulerianIntegration1stHalf<Inner<>, RiemannSolverType>::
       riemann_solver_(this->fluid_, this->fluid_, limiter_parameter) {}
 //=================================================================================================//
 template <class RiemannSolverType>
-void EulerianIntegration1stHalf<Inner<>, RiemannSolverType>::interaction(size_t index_i, Real dt)
+Vecd EulerianIntegration1stHalf<Inner<>, RiemannSolverType>::
+    pairFlux(size_t index_i, size_t index_j, const Vecd &e_ij, Real dW_ijV_iV_j)
 {
     FluidStateIn state_i(rho_[index_i], vel_[index_i], p_[index_i]);
-    Vecd momentum_change_rate = Vecd::Zero();
+    FluidStateIn state_j(rho_[index_j], vel_[index_j], p_[index_j]);
+    FluidStateOut interface_state = riemann_solver_.InterfaceState(state_i, state_j, e_ij);
+    Matd convect_flux = interface_state.rho_ * interface_state.vel_ * interface_state.vel_.transpose();
+    return -2.0 * dW_ijV_iV_j * (convect_flux + interface_state.p_ * Matd::Identity()) * e_ij;
+}
+//=================================================================================================//
+template <class RiemannSolverType>
+void EulerianIntegration1stHalf<Inner<>, RiemannSolverType>::interaction(size_t index_i, Real dt)
+{
+    Vecd momentum_change_rate = initialChangeRate(index_i);
     Neighborhood &inner_neighborhood = inner_configuration_[index_i];
     for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
     {
         size_t index_j = inner_neighborhood.j_[n];
-        Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * Vol_[index_j];
-        Vecd &e_ij = inner_neighborhood.e_ij_[n];
-
-        FluidStateIn state_j(rho_[index_j], vel_[index_j], p_[index_j]);
-        FluidStateOut interface_state = riemann_solver_.InterfaceState(state_i, state_j, e_ij);
-        Matd convect_flux = interface_state.rho_ * interface_state.vel_ * interface_state.vel_.transpose();
-        momentum_change_rate -= 2.0 * Vol_[index_i] * (convect_flux + interface_state.p_ * Matd::Identity()) * e_ij * dW_ijV_j;
+        Real dW_ijV_iV_j = inner_neighborhood.dW_ij_[n] * Vol_[index_i] * Vol_[index_j];
+        momentum_change_rate += pairFlux(index_i, index_j, inner_neighborhood.e_ij_[n], dW_ijV_iV_j);
     }
-    dmom_dt_[index_i] = momentum_change_rate;
+    setChangeRate(index_i, momentum_change_rate);
 }
 //=================================================================================================//
 template <class RiemannSolverType>
@@ -92,22 +97,27 @@ EulerianIntegration2ndHalf<Inner<>, RiemannSolverType>::
       riemann_solver_(this->fluid_, this->fluid_, limiter_parameter) {}
 //=================================================================================================//
 template <class RiemannSolverType>
-void EulerianIntegration2ndHalf<Inner<>, RiemannSolverType>::interaction(size_t index_i, Real dt)
+Real EulerianIntegration2ndHalf<Inner<>, RiemannSolverType>::
+    pairFlux(size_t index_i, size_t index_j, const Vecd &e_ij, Real dW_ijV_iV_j)
 {
     FluidStateIn state_i(rho_[index_i], vel_[index_i], p_[index_i]);
-    Real mass_change_rate = 0.0;
+    FluidStateIn state_j(rho_[index_j], vel_[index_j], p_[index_j]);
+    FluidStateOut interface_state = riemann_solver_.InterfaceState(state_i, state_j, e_ij);
+    return -2.0 * dW_ijV_iV_j * (interface_state.rho_ * interface_state.vel_).dot(e_ij);
+}
+//=================================================================================================//
+template <class RiemannSolverType>
+void EulerianIntegration2ndHalf<Inner<>, RiemannSolverType>::interaction(size_t index_i, Real dt)
+{
+    Real mass_change_rate = initialChangeRate(index_i);
     Neighborhood &inner_neighborhood = inner_configuration_[index_i];
     for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
     {
         size_t index_j = inner_neighborhood.j_[n];
-        Vecd &e_ij = inner_neighborhood.e_ij_[n];
-        Real dW_ijV_j = inner_neighborhood.dW_ij_[n] * Vol_[index_j];
-
-        FluidStateIn state_j(rho_[index_j], vel_[index_j], p_[index_j]);
-        FluidStateOut interface_state = riemann_solver_.InterfaceState(state_i, state_j, e_ij);
-        mass_change_rate -= 2.0 * Vol_[index_i] * (interface_state.rho_ * interface_state.vel_).dot(e_ij) * dW_ijV_j;
+        Real dW_ijV_iV_j = inner_neighborhood.dW_ij_[n] * Vol_[index_i] * Vol_[index_j];
+        mass_change_rate += pairFlux(index_i, index_j, inner_neighborhood.e_ij_[n], dW_ijV_iV_j);
     }
-    dmass_dt_[index_i] = mass_change_rate;
+    setChangeRate(index_i, mass_change_rate);
 }
 //=================================================================================================//
 template <class RiemannSolverType>
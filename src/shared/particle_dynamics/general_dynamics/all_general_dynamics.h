@@ -39,4 +39,5 @@
 #include "general_interpolation.h"
 #include "general_reduce.h"
 #include "kernel_correction.hpp"
-#include "particle_smoothing.hpp"
\ No newline at end of file
+#include "particle_smoothing.hpp"
+#include "particle_split_merge.h"
@@ -15,12 +15,11 @@ NormalDirectionFromBodyShape::NormalDirectionFromBodyShape(SPHBody &sph_body)
 //=============================================================================================//
 void NormalDirectionFromBodyShape::update(size_t index_i, Real dt)
 {
-    Vecd normal_direction = initial_shape_.findNormalDirection(pos_[index_i]);
-    n_[index_i] = normal_direction;
-    n0_[index_i] = normal_direction;
-    Real signed_distance = initial_shape_.findSignedDistance(pos_[index_i]);
-    phi_[index_i] = signed_distance;
-    phi0_[index_i] = signed_distance;
+    std::pair<Real, Vecd> signed_distance_and_normal = initial_shape_.findSignedDistanceAndNormal(pos_[index_i]);
+    n_[index_i] = signed_distance_and_normal.second;
+    n0_[index_i] = signed_distance_and_normal.second;
+    phi_[index_i] = signed_distance_and_normal.first;
+    phi0_[index_i] = signed_distance_and_normal.first;
 }
 //=============================================================================================//
 NormalDirectionFromSubShapeAndOp::
@@ -37,10 +36,11 @@ NormalDirectionFromSubShapeAndOp::
 //=============================================================================================//
 void NormalDirectionFromSubShapeAndOp::update(size_t index_i, Real dt)
 {
-    Vecd normal_direction = switch_sign_ * shape_->findNormalDirection(pos_[index_i]);
+    std::pair<Real, Vecd> signed_distance_and_normal = shape_->findSignedDistanceAndNormal(pos_[index_i]);
+    Vecd normal_direction = switch_sign_ * signed_distance_and_normal.second;
     n_[index_i] = normal_direction;
     n0_[index_i] = normal_direction;
-    Real signed_distance = switch_sign_ * shape_->findSignedDistance(pos_[index_i]);
+    Real signed_distance = switch_sign_ * signed_distance_and_normal.first;
     phi_[index_i] = signed_distance;
     phi0_[index_i] = signed_distance;
 }
@@ -0,0 +1,181 @@
+#include "particle_split_merge.h"
+
+#include "adaptation.h"
+
+namespace SPH
+{
+//=================================================================================================//
+SplittingPattern::SplittingPattern(const StdVec<Vecd> &offsets) : offsets_(offsets)
+{
+    Vecd offset_sum = Vecd::Zero();
+    for (const Vecd &offset : offsets_)
+    {
+        offset_sum += offset;
+    }
+    if (offsets_.size() < 2 || offset_sum.norm() > Eps)
+    {
+        std::cout << "\n Error: the splitting pattern should have at least two offsets with zero mean!" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=================================================================================================//
+SplittingPattern latticeSplittingPattern()
+{
+    StdVec<Vecd> offsets;
+    for (int n = 0; n != (1 << Dimensions); ++n)
+    {
+        Vecd offset = Vecd::Zero();
+        for (int k = 0; k != Dimensions; ++k)
+        {
+            offset[k] = (n >> k) & 1 ? 0.25 : -0.25;
+        }
+        offsets.push_back(offset);
+    }
+    return SplittingPattern(offsets);
+}
+//=================================================================================================//
+SplittingPattern pairSplittingPattern(const Vecd &axis_direction)
+{
+    Vecd offset = 0.25 * axis_direction.normalized();
+    return SplittingPattern({offset, -offset});
+}
+//=================================================================================================//
+TargetSmoothingLengthRatioByIndicator::
+    TargetSmoothingLengthRatioByIndicator(SPHBody &sph_body, const std::string &indicator_name)
+    : LocalDynamics(sph_body),
+      indicator_(particles_->getVariableDataByName<int>(indicator_name)),
+      target_h_ratio_(particles_->registerStateVariable<Real>("TargetSmoothingLengthRatio", Real(1))),
+      h_ratio_max_(sph_body.sph_adaptation_->ReferenceSmoothingLength() /
+                   sph_body.sph_adaptation_->MinimumSmoothingLength()) {}
+//=================================================================================================//
+void TargetSmoothingLengthRatioByIndicator::update(size_t index_i, Real dt)
+{
+    target_h_ratio_[index_i] = indicator_[index_i] != 0 ? h_ratio_max_ : 1.0;
+}
+//=================================================================================================//
+BaseParticleSplitMerge::BaseParticleSplitMerge(SPHBody &sph_body)
+    : LocalDynamics(sph_body),
+      spacing_ref_(sph_body.sph_adaptation_->ReferenceSpacing()),
+      h_ratio_max_(sph_body.sph_adaptation_->ReferenceSmoothingLength() /
+                   sph_body.sph_adaptation_->MinimumSmoothingLength()),
+      tolerance_(0.01),
+      h_ratio_(DynamicCast<ParticleWithLocalRefinement>(this, sph_body.sph_adaptation_)->h_ratio_),
+      target_h_ratio_(particles_->registerStateVariable<Real>(
+          "TargetSmoothingLengthRatio", [&](size_t i) -> Real { return h_ratio_[i]; })),
+      mass_(particles_->getVariableDataByName<Real>("Mass")),
+      Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")),
+      rho_(particles_->registerStateVariable<Real>("Density")),
+      pos_(particles_->getVariableDataByName<Vecd>("Position")),
+      vel_(particles_->registerStateVariable<Vecd>("Velocity"))
+{
+    particles_->addVariableToSort<Real>("TargetSmoothingLengthRatio");
+}
+//=================================================================================================//
+ParticleSplitting::ParticleSplitting(SPHBody &sph_body, ParticleBuffer<Base> &buffer,
+                                     const SplittingPattern &splitting_pattern)
+    : BaseParticleSplitMerge(sph_body), buffer_(buffer), offsets_(splitting_pattern.offsets_),
+      h_ratio_increase_(pow(Real(offsets_.size()), 1.0 / Real(Dimensions)))
+{
+    buffer_.checkParticlesReserved();
+}
+//=================================================================================================//
+void ParticleSplitting::update(size_t index_i, Real dt)
+{
+    Real split_h_ratio = h_ratio_[index_i] * h_ratio_increase_;
+    if (split_h_ratio > target_h_ratio_[index_i] * (1.0 + tolerance_) ||
+        split_h_ratio > h_ratio_max_ * (1.0 + tolerance_))
+    {
+        return;
+    }
+
+    Real spacing = spacing_ref_ / h_ratio_[index_i];
+    Vecd position = pos_[index_i];
+    Real number_of_split = Real(offsets_.size());
+    mass_[index_i] /= number_of_split;
+    Vol_[index_i] /= number_of_split;
+    h_ratio_[index_i] = SMIN(split_h_ratio, h_ratio_max_); // within the finest cell linked list level
+    pos_[index_i] = position + offsets_[0] * spacing;
+    for (size_t k = 1; k != offsets_.size(); ++k)
+    {
+        mutex_split_.lock();
+        buffer_.checkEnoughBuffer(*particles_);
+        size_t new_index = particles_->createRealParticleFrom(index_i);
+        mutex_split_.unlock();
+        pos_[new_index] = position + offsets_[k] * spacing;
+    }
+}
+//=================================================================================================//
+ParticleMerging::ParticleMerging(BaseInnerRelation &inner_relation)
+    : BaseParticleSplitMerge(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
+      merge_partner_(particles_->registerDiscreteVariable<UnsignedInt>("MergePartner", particles_->ParticlesBound())),
+      is_merged_(particles_->registerDiscreteVariable<int>("IsMerged", particles_->ParticlesBound())),
+      h_ratio_decrease_(pow(2.0, 1.0 / Real(Dimensions))) {}
+//=================================================================================================//
+bool ParticleMerging::isMergeable(size_t index_i)
+{
+    Real merged_h_ratio = h_ratio_[index_i] / h_ratio_decrease_;
+    return merged_h_ratio > SMAX(target_h_ratio_[index_i], Real(1)) * (1.0 - tolerance_);
+}
+//=================================================================================================//
+void ParticleMerging::interaction(size_t index_i, Real dt)
+{
+    is_merged_[index_i] = 0;
+    merge_partner_[index_i] = index_i; // no partner
+    if (!isMergeable(index_i))
+    {
+        return;
+    }
+
+    Real closest_distance = MaxReal;
+    const Neighborhood &inner_neighborhood = inner_configuration_[index_i];
+    for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+    {
+        size_t index_j = inner_neighborhood.j_[n];
+        Real r_ij = inner_neighborhood.r_ij_[n];
+        if (r_ij < closest_distance && isMergeable(index_j) &&
+            ABS(h_ratio_[index_j] - h_ratio_[index_i]) < tolerance_ * h_ratio_[index_i])
+        {
+            closest_distance = r_ij;
+            merge_partner_[index_i] = index_j;
+        }
+    }
+}
+//=================================================================================================//
+void ParticleMerging::update(size_t index_i, Real dt)
+{
+    // the pair is merged into the particle with the lower index
+    size_t index_j = merge_partner_[index_i];
+    if (index_j <= index_i || merge_partner_[index_j] != index_i)
+    {
+        return;
+    }
+
+    Real total_mass = mass_[index_i] + mass_[index_j];
+    pos_[index_i] = (mass_[index_i] * pos_[index_i] + mass_[index_j] * pos_[index_j]) / total_mass;
+    vel_[index_i] = (mass_[index_i] * vel_[index_i] + mass_[index_j] * vel_[index_j]) / total_mass;
+    mass_[index_i] = total_mass;
+    Vol_[index_i] += Vol_[index_j];
+    rho_[index_i] = total_mass / Vol_[index_i];
+    h_ratio_[index_i] = SMAX(h_ratio_[index_i] / h_ratio_decrease_, Real(1)); // within the coarsest level
+    is_merged_[index_j] = 1;
+}
+//=================================================================================================//
+void ParticleMerging::deleteMergedParticles()
+{
+    IndexVector merged_particles;
+    for (size_t i = 0; i != particles_->TotalRealParticles(); ++i)
+    {
+        if (is_merged_[i] == 1)
+        {
+            merged_particles.push_back(i);
+        }
+    }
+    // from the back, so that the particle switched in is never a merged one
+    for (size_t k = merged_particles.size(); k != 0; --k)
+    {
+        particles_->switchToBufferParticle(merged_particles[k - 1]);
+    }
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,170 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	particle_split_merge.h
+ * @brief 	Runtime particle splitting and merging for adaptive resolution.
+ * @details The target resolution of each particle is given by the variable
+ *          "TargetSmoothingLengthRatio", which is set by a refinement indicator.
+ *          A particle coarser than its target is split by a splitting pattern into
+ *          new particles taken from the particle buffer, and pairs of neighboring
+ *          particles finer than their target are merged with mass and momentum conserved.
+ *          The smoothing length ratio of the new particles is kept within the levels
+ *          of the multi-level cell linked list. As particles are created and deleted,
+ *          the cell linked list and the configurations of the body need to be updated afterwards.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef PARTICLE_SPLIT_MERGE_H
+#define PARTICLE_SPLIT_MERGE_H
+
+#include "base_general_dynamics.h"
+#include "particle_reserve.h"
+
+#include <mutex>
+
+namespace SPH
+{
+/**
+ * @struct SplittingPattern
+ * @brief The offsets of the split particles from the original particle position,
+ * in the unit of the original particle spacing. The offsets should have zero mean.
+ */
+struct SplittingPattern
+{
+    StdVec<Vecd> offsets_;
+    explicit SplittingPattern(const StdVec<Vecd> &offsets);
+};
+/** Split into 2^d particles on a lattice with half of the original particle spacing. */
+SplittingPattern latticeSplittingPattern();
+/** Split into two particles along the given axis direction. */
+SplittingPattern pairSplittingPattern(const Vecd &axis_direction);
+
+/**
+ * @class TargetSmoothingLengthRatioByIndicator
+ * @brief The target resolution is the finest for indicated particles,
+ * such as the free-surface particles, and the coarsest otherwise.
+ */
+class TargetSmoothingLengthRatioByIndicator : public LocalDynamics
+{
+  public:
+    explicit TargetSmoothingLengthRatioByIndicator(SPHBody &sph_body, const std::string &indicator_name = "Indicator");
+    virtual ~TargetSmoothingLengthRatioByIndicator(){};
+    void update(size_t index_i, Real dt = 0.0);
+
+  protected:
+    int *indicator_;
+    Real *target_h_ratio_;
+    Real h_ratio_max_;
+};
+
+/**
+ * @class BaseParticleSplitMerge
+ * @brief Common data for particle splitting and merging.
+ */
+class BaseParticleSplitMerge : public LocalDynamics
+{
+  public:
+    explicit BaseParticleSplitMerge(SPHBody &sph_body);
+    virtual ~BaseParticleSplitMerge(){};
+
+  protected:
+    Real spacing_ref_, h_ratio_max_;
+    Real tolerance_; /**< relative tolerance to compare smoothing length ratios */
+    Real *h_ratio_, *target_h_ratio_;
+    Real *mass_, *Vol_, *rho_;
+    Vecd *pos_, *vel_;
+};
+
+/**
+ * @class ParticleSplitting
+ * @brief Split a particle, whose target resolution is finer than the splitting pattern gives,
+ * into particles with equal mass and volume and the velocity of the original particle.
+ */
+class ParticleSplitting : public BaseParticleSplitMerge
+{
+  public:
+    ParticleSplitting(SPHBody &sph_body, ParticleBuffer<Base> &buffer, const SplittingPattern &splitting_pattern);
+    virtual ~ParticleSplitting(){};
+    void update(size_t index_i, Real dt = 0.0);
+
+  protected:
+    std::mutex mutex_split_;
+    ParticleBuffer<Base> &buffer_;
+    StdVec<Vecd> offsets_;
+    Real h_ratio_increase_; /**< increase of the smoothing length ratio by splitting */
+};
+
+/**
+ * @class ParticleMerging
+ * @brief Merge pairs of mutually closest neighboring particles of similar resolution,
+ * whose target resolution is coarser than the merged particle has.
+ * The merged particle is located at the center of mass and has the summed mass, volume and momentum.
+ * The interaction step finds the pairs, the update step merges them and
+ * the merged particles are switched to buffer particles by deleteMergedParticles.
+ */
+class ParticleMerging : public BaseParticleSplitMerge, public DataDelegateInner
+{
+  public:
+    explicit ParticleMerging(BaseInnerRelation &inner_relation);
+    virtual ~ParticleMerging(){};
+    void interaction(size_t index_i, Real dt = 0.0);
+    void update(size_t index_i, Real dt = 0.0);
+    void deleteMergedParticles();
+
+  protected:
+    UnsignedInt *merge_partner_;
+    int *is_merged_;
+    Real h_ratio_decrease_; /**< decrease of the smoothing length ratio by merging a pair */
+
+    bool isMergeable(size_t index_i);
+};
+
+/**
+ * @class ParticleSplitAndMerge
+ * @brief Merge and then split the particles of a body by their target resolution.
+ * The cell linked list and the configurations of the body should be updated after execution.
+ */
+template <class ExecutionPolicy = ParallelPolicy>
+class ParticleSplitAndMerge : public BaseDynamics<void>
+{
+  public:
+    ParticleSplitAndMerge(BaseInnerRelation &inner_relation, ParticleBuffer<Base> &buffer,
+                          const SplittingPattern &splitting_pattern = latticeSplittingPattern())
+        : BaseDynamics<void>(), particle_merging_(inner_relation),
+          particle_splitting_(inner_relation.getSPHBody(), buffer, splitting_pattern){};
+    virtual ~ParticleSplitAndMerge(){};
+
+    virtual void exec(Real dt = 0.0) override
+    {
+        // merge first, as the pairs are found with the current configuration
+        particle_merging_.exec(dt);
+        particle_merging_.deleteMergedParticles();
+        particle_splitting_.exec(dt);
+    };
+
+  protected:
+    InteractionWithUpdate<ParticleMerging, ExecutionPolicy> particle_merging_;
+    SimpleDynamics<ParticleSplitting, ExecutionPolicy> particle_splitting_;
+};
+} // namespace SPH
+#endif // PARTICLE_SPLIT_MERGE_H
@@ -76,6 +76,56 @@ inline void particle_for(const ParallelPolicy &par, const IndexRange &particles_
         ap);
 };
 
+/**
+ * Work-weighted range-wise iterators (for sequential and parallel computing).
+ * The work of a particle is its number of neighbors plus one. The neighbor offset
+ * is the exclusive prefix sum of the neighbor counts with one more entry at the range end,
+ * as the particle offset of a neighbor list. The parallel iterator splits the total work
+ * into chunks of equal cost instead of chunks of equal number of particles.
+ * Other policies and ranges fall back to the non-weighted iterators.
+ */
+template <class ExecutionPolicy, typename DynamicsRange, class LocalDynamicsFunction>
+inline void particle_for(const ExecutionPolicy &execution_policy, const DynamicsRange &dynamics_range,
+                         const UnsignedInt *neighbor_offset, const LocalDynamicsFunction &local_dynamics_function)
+{
+    particle_for(execution_policy, dynamics_range, local_dynamics_function);
+};
+
+template <class LocalDynamicsFunction>
+inline void particle_for(const ParallelPolicy &par, const IndexRange &particles_range,
+                         const UnsignedInt *neighbor_offset, const LocalDynamicsFunction &local_dynamics_function)
+{
+    auto work_offset = [&](size_t i)
+    { return size_t(neighbor_offset[i]) + i; };
+    /** the first particle whose work starts at or after the given work offset. */
+    auto first_particle = [&](size_t work)
+    {
+        size_t lower = particles_range.begin();
+        size_t upper = particles_range.end();
+        while (lower < upper)
+        {
+            size_t middle = lower + (upper - lower) / 2;
+            if (work_offset(middle) < work)
+                lower = middle + 1;
+            else
+                upper = middle;
+        }
+        return lower;
+    };
+
+    parallel_for(
+        IndexRange(work_offset(particles_range.begin()), work_offset(particles_range.end())),
+        [&](const IndexRange &r)
+        {
+            size_t end = first_particle(r.end());
+            for (size_t i = first_particle(r.begin()); i < end; ++i)
+            {
+                local_dynamics_function(i);
+            }
+        },
+        ap);
+};
+
 /**
  * Bodypart By Particle-wise iterators (for sequential and parallel computing).
  */
@@ -106,5 +106,88 @@ void ConstrainSolidBodyMassCenter::update(size_t index_i, Real dt)
     vel_[index_i] -= velocity_correction_;
 }
 //=================================================================================================//
+SimBodySubCycling::
+    SimBodySubCycling(SimTK::MultibodySystem &MBsystem, SimTK::MobilizedBody &mobod,
+                      SimTK::RungeKuttaMersonIntegrator &integ, SimTK::Force::DiscreteForces &force_on_bodies,
+                      Real reference_spacing, Real characteristic_length,
+                      Real maximum_coupling_interval, Real added_mass_ratio)
+    : MBsystem_(MBsystem), mobod_(mobod), integ_(integ), force_on_bodies_(force_on_bodies),
+      reference_spacing_(reference_spacing), characteristic_length_(characteristic_length),
+      maximum_coupling_interval_(maximum_coupling_interval), added_mass_ratio_(added_mass_ratio),
+      force_impulse_(SimTKVec3(0), SimTKVec3(0))
+{
+    updateCouplingInterval();
+}
+//=================================================================================================//
+void SimBodySubCycling::accumulateForce(const SimTK::SpatialVec &force, Real dt)
+{
+    force_impulse_[0] += force[0] * dt;
+    force_impulse_[1] += force[1] * dt;
+    prediction_time_ += dt;
+}
+//=================================================================================================//
+bool SimBodySubCycling::advanceSimBody()
+{
+    if (prediction_time_ <= 0.0 || prediction_time_ < coupling_interval_)
+        return false;
+
+    Real inv_interval = 1.0 / prediction_time_;
+    SimTK::State &state_for_update = integ_.updAdvancedState();
+    force_on_bodies_.setOneBodyForce(state_for_update, mobod_,
+                                     SimTK::SpatialVec(force_impulse_[0] * inv_interval,
+                                                       force_impulse_[1] * inv_interval));
+    integ_.stepBy(prediction_time_);
+
+    force_impulse_ = SimTK::SpatialVec(SimTKVec3(0), SimTKVec3(0));
+    prediction_time_ = 0.0;
+    number_of_coupling_steps_++;
+    updateCouplingInterval();
+    return true;
+}
+//=================================================================================================//
+void SimBodySubCycling::updateCouplingInterval()
+{
+    const SimTK::State &state = integ_.getState();
+    MBsystem_.realize(state, SimTK::Stage::Acceleration);
+    const SimTK::SpatialVec &velocity = mobod_.getBodyVelocity(state);
+    const SimTK::SpatialVec &acceleration = mobod_.getBodyAcceleration(state);
+    // bound of the acceleration of the stations within the characteristic length from the body origin
+    Real reference_acceleration = acceleration[1].norm() +
+                                  (acceleration[0].norm() + velocity[0].normSqr()) * characteristic_length_;
+    Real inertia_interval = sqrt(2.0 * displacement_fraction_ * reference_spacing_ /
+                                 (reference_acceleration + TinyReal));
+    // heuristic reduction for the added mass, not a stability limit of the coupling
+    coupling_interval_ = SMIN(maximum_coupling_interval_, inertia_interval / (1.0 + added_mass_ratio_));
+}
+//=================================================================================================//
+SimTKVec3 SimBodySubCycling::predictBodyOriginLocation(const SimTK::State &state)
+{
+    Real tau = prediction_time_;
+    return mobod_.getBodyOriginLocation(state) + mobod_.getBodyOriginVelocity(state) * tau +
+           mobod_.getBodyAcceleration(state)[1] * (0.5 * tau * tau);
+}
+//=================================================================================================//
+void SimBodySubCycling::predictStationKinematics(const SimTK::State &state, const SimTKVec3 &station,
+                                                 SimTKVec3 &pos, SimTKVec3 &vel, SimTKVec3 &acc)
+{
+    mobod_.findStationLocationVelocityAndAccelerationInGround(state, station, pos, vel, acc);
+    Real tau = prediction_time_;
+    pos += vel * tau + acc * (0.5 * tau * tau);
+    vel += acc * tau;
+}
+//=================================================================================================//
+SimTKVec3 SimBodySubCycling::predictRotatedVector(const SimTK::State &state, const SimTKVec3 &vector_in_ground)
+{
+    Real tau = prediction_time_;
+    SimTKVec3 omega = mobod_.getBodyVelocity(state)[0];
+    SimTKVec3 alpha = mobod_.getBodyAcceleration(state)[0];
+    SimTKVec3 omega_cross_vector = SimTK::cross(omega, vector_in_ground);
+    SimTKVec3 predicted = vector_in_ground + omega_cross_vector * tau +
+                          (SimTK::cross(alpha, vector_in_ground) + SimTK::cross(omega, omega_cross_vector)) *
+                              (0.5 * tau * tau);
+    // rescaled since the expansion does not preserve the length
+    return predicted * (vector_in_ground.norm() / (predicted.norm() + TinyReal));
+}
+//=================================================================================================//
 } // namespace solid_dynamics
 } // namespace SPH
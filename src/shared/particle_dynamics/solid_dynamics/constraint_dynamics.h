@@ -148,9 +148,64 @@ class ConstrainSolidBodyMassCenter : public MotionConstraint<SPHBody>
     void update(size_t index_i, Real dt = 0.0);
 };
 
+/**
+ * @class SimBodySubCycling
+ * @brief Sub-cycled coupling between the SPH time steps and a Simbody mobilized body.
+ * The total force from the particles is time averaged over a coupling interval
+ * and Simbody is advanced once per interval with the averaged force.
+ * Between the coupling points, the body kinematics is predicted by
+ * a second-order Taylor expansion from the state of the latest coupling point.
+ * The interval is chosen so that the predicted displacement of the body
+ * due to its acceleration is a small fraction of the particle spacing,
+ * and is divided by one plus the added-mass ratio (fluid added mass over body mass).
+ * This division is a heuristic, which shortens the interval for light bodies in heavy fluid,
+ * but it is not a stability limit of the partitioned coupling, which is not analyzed here.
+ * The added-mass ratio is given by the user, e.g. estimated from the geometry,
+ * and is not estimated from the particle forces during the simulation.
+ * A zero maximum interval recovers the coupling at every time step.
+ */
+class SimBodySubCycling
+{
+  public:
+    SimBodySubCycling(SimTK::MultibodySystem &MBsystem, SimTK::MobilizedBody &mobod,
+                      SimTK::RungeKuttaMersonIntegrator &integ, SimTK::Force::DiscreteForces &force_on_bodies,
+                      Real reference_spacing, Real characteristic_length,
+                      Real maximum_coupling_interval, Real added_mass_ratio = 1.0);
+    virtual ~SimBodySubCycling(){};
+
+    /** to be called at every time step with the total force from the particles and the step size. */
+    void accumulateForce(const SimTK::SpatialVec &force, Real dt);
+    /** advance Simbody with the averaged force if the coupling interval is reached. */
+    bool advanceSimBody();
+    /** time since the latest coupling point. */
+    Real PredictionTime() { return prediction_time_; };
+    Real CouplingInterval() { return coupling_interval_; };
+    size_t NumberOfCouplingSteps() { return number_of_coupling_steps_; };
+    SimTKVec3 predictBodyOriginLocation(const SimTK::State &state);
+    void predictStationKinematics(const SimTK::State &state, const SimTKVec3 &station,
+                                  SimTKVec3 &pos, SimTKVec3 &vel, SimTKVec3 &acc);
+    SimTKVec3 predictRotatedVector(const SimTK::State &state, const SimTKVec3 &vector_in_ground);
+
+  protected:
+    SimTK::MultibodySystem &MBsystem_;
+    SimTK::MobilizedBody &mobod_;
+    SimTK::RungeKuttaMersonIntegrator &integ_;
+    SimTK::Force::DiscreteForces &force_on_bodies_;
+    Real reference_spacing_, characteristic_length_;
+    Real maximum_coupling_interval_, added_mass_ratio_;
+    Real displacement_fraction_ = 0.1;
+    SimTK::SpatialVec force_impulse_;
+    Real prediction_time_ = 0.0;
+    Real coupling_interval_ = 0.0;
+    size_t number_of_coupling_steps_ = 0;
+
+    void updateCouplingInterval();
+};
+
 /**
  * @class ConstraintBySimBody
  * @brief Constrain by the motion computed from Simbody.
+ * With sub-cycling, the motion between the coupling points is predicted.
  */
 template <class DynamicsIdentifier>
 class ConstraintBySimBody : public MotionConstraint<DynamicsIdentifier>
@@ -158,6 +213,9 @@ class ConstraintBySimBody : public MotionConstraint<DynamicsIdentifier>
   public:
     ConstraintBySimBody(DynamicsIdentifier &identifier, SimTK::MultibodySystem &MBsystem,
                         SimTK::MobilizedBody &mobod, SimTK::RungeKuttaMersonIntegrator &integ);
+    ConstraintBySimBody(DynamicsIdentifier &identifier, SimTK::MultibodySystem &MBsystem,
+                        SimTK::MobilizedBody &mobod, SimTK::RungeKuttaMersonIntegrator &integ,
+                        SimBodySubCycling &sub_cycling);
     virtual ~ConstraintBySimBody(){};
 
     virtual void setupDynamics(Real dt = 0.0) override
@@ -171,6 +229,7 @@ class ConstraintBySimBody : public MotionConstraint<DynamicsIdentifier>
     SimTK::MultibodySystem &MBsystem_;
     SimTK::MobilizedBody &mobod_;
     SimTK::RungeKuttaMersonIntegrator &integ_;
+    SimBodySubCycling *sub_cycling_;
     Vecd *n_, *n0_, *acc_;
     const SimTK::State *simbody_state_;
     SimTKVec3 initial_mobod_origin_location_;
@@ -192,11 +251,15 @@ class TotalForceForSimBody
     SimTK::MultibodySystem &MBsystem_;
     SimTK::MobilizedBody &mobod_;
     SimTK::RungeKuttaMersonIntegrator &integ_;
+    SimBodySubCycling *sub_cycling_;
     SimTKVec3 current_mobod_origin_location_;
 
   public:
     TotalForceForSimBody(DynamicsIdentifier &identifier, SimTK::MultibodySystem &MBsystem,
                          SimTK::MobilizedBody &mobod, SimTK::RungeKuttaMersonIntegrator &integ);
+    TotalForceForSimBody(DynamicsIdentifier &identifier, SimTK::MultibodySystem &MBsystem,
+                         SimTK::MobilizedBody &mobod, SimTK::RungeKuttaMersonIntegrator &integ,
+                         SimBodySubCycling &sub_cycling);
 
     virtual ~TotalForceForSimBody(){};
 
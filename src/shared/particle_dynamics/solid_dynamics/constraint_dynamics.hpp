@@ -40,7 +40,7 @@ ConstraintBySimBody<DynamicsIdentifier>::
     ConstraintBySimBody(DynamicsIdentifier &identifier, SimTK::MultibodySystem &MBsystem,
                         SimTK::MobilizedBody &mobod, SimTK::RungeKuttaMersonIntegrator &integ)
     : MotionConstraint<DynamicsIdentifier>(identifier),
-      MBsystem_(MBsystem), mobod_(mobod), integ_(integ),
+      MBsystem_(MBsystem), mobod_(mobod), integ_(integ), sub_cycling_(nullptr),
       n_(this->particles_->template getVariableDataByName<Vecd>("NormalDirection")),
       n0_(this->particles_->template registerStateVariableFrom<Vecd>("InitialNormalDirection", "NormalDirection")),
       acc_(this->particles_->template registerStateVariable<Vecd>("Acceleration"))
@@ -51,11 +51,32 @@ ConstraintBySimBody<DynamicsIdentifier>::
 }
 //=================================================================================================//
 template <class DynamicsIdentifier>
+ConstraintBySimBody<DynamicsIdentifier>::
+    ConstraintBySimBody(DynamicsIdentifier &identifier, SimTK::MultibodySystem &MBsystem,
+                        SimTK::MobilizedBody &mobod, SimTK::RungeKuttaMersonIntegrator &integ,
+                        SimBodySubCycling &sub_cycling)
+    : ConstraintBySimBody(identifier, MBsystem, mobod, integ)
+{
+    sub_cycling_ = &sub_cycling;
+}
+//=================================================================================================//
+template <class DynamicsIdentifier>
 void ConstraintBySimBody<DynamicsIdentifier>::update(size_t index_i, Real dt)
 {
     /** Change to SimTK::Vector. */
     SimTKVec3 rr, pos, vel, acc;
     rr = EigenToSimTK(upgradeToVec3d(this->pos0_[index_i])) - initial_mobod_origin_location_;
+    if (sub_cycling_ != nullptr)
+    {
+        sub_cycling_->predictStationKinematics(*simbody_state_, rr, pos, vel, acc);
+        this->pos_[index_i] = degradeToVecd(SimTKToEigen(pos));
+        this->vel_[index_i] = degradeToVecd(SimTKToEigen(vel));
+        acc_[index_i] = degradeToVecd(SimTKToEigen(acc));
+        SimTKVec3 n = sub_cycling_->predictRotatedVector(
+            *simbody_state_, mobod_.getBodyRotation(*simbody_state_) * EigenToSimTK(upgradeToVec3d(n0_[index_i])));
+        n_[index_i] = degradeToVecd(SimTKToEigen(n));
+        return;
+    }
     mobod_.findStationLocationVelocityAndAccelerationInGround(*simbody_state_, rr, pos, vel, acc);
     /** this is how we calculate the particle position in after transform of MBbody.
      * const SimTK::Rotation&  R_GB = mobod_.getBodyRotation(simbody_state);
@@ -80,17 +101,29 @@ TotalForceForSimBody<DynamicsIdentifier>::
       force_(this->particles_->template registerStateVariable<Vecd>("Force")),
       force_prior_(this->particles_->template getVariableDataByName<Vecd>("ForcePrior")),
       pos_(this->particles_->template getVariableDataByName<Vecd>("Position")),
-      MBsystem_(MBsystem), mobod_(mobod), integ_(integ)
+      MBsystem_(MBsystem), mobod_(mobod), integ_(integ), sub_cycling_(nullptr)
 {
     this->quantity_name_ = "TotalForceForSimBody";
 }
 //=================================================================================================//
 template <class DynamicsIdentifier>
+TotalForceForSimBody<DynamicsIdentifier>::
+    TotalForceForSimBody(DynamicsIdentifier &identifier, SimTK::MultibodySystem &MBsystem,
+                         SimTK::MobilizedBody &mobod, SimTK::RungeKuttaMersonIntegrator &integ,
+                         SimBodySubCycling &sub_cycling)
+    : TotalForceForSimBody(identifier, MBsystem, mobod, integ)
+{
+    sub_cycling_ = &sub_cycling;
+}
+//=================================================================================================//
+template <class DynamicsIdentifier>
 void TotalForceForSimBody<DynamicsIdentifier>::setupDynamics(Real dt)
 {
     const SimTK::State *simbody_state = &integ_.getState();
     MBsystem_.realize(*simbody_state, SimTK::Stage::Acceleration);
-    current_mobod_origin_location_ = mobod_.getBodyOriginLocation(*simbody_state);
+    current_mobod_origin_location_ = sub_cycling_ != nullptr
+                                         ? sub_cycling_->predictBodyOriginLocation(*simbody_state)
+                                         : mobod_.getBodyOriginLocation(*simbody_state);
 }
 //=================================================================================================//
 template <class DynamicsIdentifier>
@@ -162,30 +162,61 @@ void ShellStressRelaxationFirstHalf::initialization(size_t index_i, Real dt)
     Matd resultant_stress = Matd::Zero();
     Matd resultant_moment = Matd::Zero();
     Vecd resultant_shear_stress = Vecd::Zero();
+    integrateStressThroughThickness(index_i, transformation_matrix_0_to_current,
+                                    resultant_stress, resultant_moment, resultant_shear_stress);
 
+    /** stress and moment in global coordinates for pair interaction */
+    global_stress_[index_i] = J * current_transformation_matrix.transpose() *
+                              resultant_stress * current_transformation_matrix * inverse_transpose_global_F;
+    global_moment_[index_i] = J * current_transformation_matrix.transpose() *
+                              resultant_moment * current_transformation_matrix * inverse_transpose_global_F;
+    global_shear_stress_[index_i] = J * current_transformation_matrix.transpose() * resultant_shear_stress;
+}
+//=================================================================================================//
+Matd ShellStressRelaxationFirstHalf::getNumericalDampingScaling(size_t index_i)
+{
+    /** correct out-plane numerical damping. */
+    Matd numerical_damping_scaling = numerical_damping_scaling_matrix_;
+    numerical_damping_scaling(Dimensions - 1, Dimensions - 1) = SMIN(thickness_[index_i], smoothing_length_);
+    return numerical_damping_scaling;
+}
+//=================================================================================================//
+void ShellStressRelaxationFirstHalf::imposeModelingAssumptions(Matd &local_cauchy_stress)
+{
+    local_cauchy_stress.col(Dimensions - 1) *= shear_correction_factor_;
+    local_cauchy_stress.row(Dimensions - 1) *= shear_correction_factor_;
+    local_cauchy_stress(Dimensions - 1, Dimensions - 1) = 0.0;
+}
+//=================================================================================================//
+Matd ShellStressRelaxationFirstHalf::
+    getLocalCauchyStress(size_t index_i, const Matd &transformation_matrix_0_to_current,
+                         const Matd &deformation, const Matd &deformation_rate)
+{
+    Matd inverse_deformation = deformation.inverse();
+    Matd current_local_almansi_strain = transformation_matrix_0_to_current * 0.5 *
+                                        (Matd::Identity() - inverse_deformation.transpose() * inverse_deformation) *
+                                        transformation_matrix_0_to_current.transpose();
+
+    /** correct Almansi strain tensor according to plane stress problem. */
+    current_local_almansi_strain = getCorrectedAlmansiStrain(current_local_almansi_strain, nu_);
+
+    Matd cauchy_stress = elastic_solid_.StressCauchy(current_local_almansi_strain, index_i) +
+                         transformation_matrix_0_to_current * deformation *
+                             elastic_solid_.NumericalDampingRightCauchy(deformation, deformation_rate, getNumericalDampingScaling(index_i), index_i) *
+                             deformation.transpose() * transformation_matrix_0_to_current.transpose() / deformation.determinant();
+    imposeModelingAssumptions(cauchy_stress);
+    return cauchy_stress;
+}
+//=================================================================================================//
+void ShellStressRelaxationFirstHalf::
+    integrateStressThroughThickness(size_t index_i, const Matd &transformation_matrix_0_to_current,
+                                    Matd &resultant_stress, Matd &resultant_moment, Vecd &resultant_shear_stress)
+{
     for (int i = 0; i != number_of_gaussian_points_; ++i)
     {
         Matd F_gaussian_point = F_[index_i] + gaussian_point_[i] * F_bending_[index_i] * thickness_[index_i] * 0.5;
         Matd dF_gaussian_point_dt = dF_dt_[index_i] + gaussian_point_[i] * dF_bending_dt_[index_i] * thickness_[index_i] * 0.5;
-        Matd inverse_F_gaussian_point = F_gaussian_point.inverse();
-        Matd current_local_almansi_strain = transformation_matrix_0_to_current * 0.5 *
-                                            (Matd::Identity() - inverse_F_gaussian_point.transpose() * inverse_F_gaussian_point) *
-                                            transformation_matrix_0_to_current.transpose();
-
-        /** correct Almansi strain tensor according to plane stress problem. */
-        current_local_almansi_strain = getCorrectedAlmansiStrain(current_local_almansi_strain, nu_);
-
-        /** correct out-plane numerical damping. */
-        numerical_damping_scaling_matrix_(Dimensions - 1, Dimensions - 1) = thickness_[i] < smoothing_length_ ? thickness_[i] : smoothing_length_;
-        Matd cauchy_stress = elastic_solid_.StressCauchy(current_local_almansi_strain, index_i) +
-                             transformation_matrix_0_to_current * F_gaussian_point *
-                                 elastic_solid_.NumericalDampingRightCauchy(F_gaussian_point, dF_gaussian_point_dt, numerical_damping_scaling_matrix_, index_i) *
-                                 F_gaussian_point.transpose() * transformation_matrix_0_to_current.transpose() / F_gaussian_point.determinant();
-
-        /** Impose modeling assumptions. */
-        cauchy_stress.col(Dimensions - 1) *= shear_correction_factor_;
-        cauchy_stress.row(Dimensions - 1) *= shear_correction_factor_;
-        cauchy_stress(Dimensions - 1, Dimensions - 1) = 0.0;
+        Matd cauchy_stress = getLocalCauchyStress(index_i, transformation_matrix_0_to_current, F_gaussian_point, dF_gaussian_point_dt);
 
         if (i == 0)
         {
@@ -203,13 +234,6 @@ void ShellStressRelaxationFirstHalf::initialization(size_t index_i, Real dt)
         resultant_stress.col(Dimensions - 1) = Vecd::Zero();
         resultant_moment.col(Dimensions - 1) = Vecd::Zero();
     }
-
-    /** stress and moment in global coordinates for pair interaction */
-    global_stress_[index_i] = J * current_transformation_matrix.transpose() *
-                              resultant_stress * current_transformation_matrix * inverse_transpose_global_F;
-    global_moment_[index_i] = J * current_transformation_matrix.transpose() *
-                              resultant_moment * current_transformation_matrix * inverse_transpose_global_F;
-    global_shear_stress_[index_i] = J * current_transformation_matrix.transpose() * resultant_shear_stress;
 }
 //=================================================================================================//
 void ShellStressRelaxationFirstHalf::update(size_t index_i, Real dt)
@@ -255,6 +255,15 @@ class ShellStressRelaxationFirstHalf : public BaseShellRelaxation
     int number_of_gaussian_points_;
     StdVec<Real> gaussian_point_;
     StdVec<Real> gaussian_weight_;
+
+    Matd getNumericalDampingScaling(size_t index_i);
+    /** Shear correction and zero normal stress in current local coordinates. */
+    void imposeModelingAssumptions(Matd &local_cauchy_stress);
+    /** Local Cauchy stress at a through-thickness position. */
+    Matd getLocalCauchyStress(size_t index_i, const Matd &transformation_matrix_0_to_current,
+                              const Matd &deformation, const Matd &deformation_rate);
+    void integrateStressThroughThickness(size_t index_i, const Matd &transformation_matrix_0_to_current,
+                                         Matd &resultant_stress, Matd &resultant_moment, Vecd &resultant_shear_stress);
 };
 
 /**
@@ -115,5 +115,19 @@ class ParticleGenerator<ParticlesType, Reload> : public ParticleGenerator<Partic
     virtual void setAllParticleBounds() override;
     virtual void initializeParticleVariables() override;
 };
+
+class Restart;
+template <typename ParticlesType> // generate particles from the positions and volumes saved in a restart file
+class ParticleGenerator<ParticlesType, Restart> : public ParticleGenerator<ParticlesType>
+{
+    std::string file_path_;
+
+  public:
+    ParticleGenerator(SPHBody &sph_body, ParticlesType &particles, const std::string &restart_file_path);
+    virtual ~ParticleGenerator(){};
+    virtual void prepareGeometricData() override;
+    virtual void setAllParticleBounds() override;
+    virtual void initializeParticleVariables() override;
+};
 } // namespace SPH
 #endif // BASE_PARTICLE_GENERATOR_H
@@ -43,5 +43,36 @@ void ParticleGenerator<ParticlesType, Reload>::initializeParticleVariables()
     ParticleGenerator<ParticlesType>::initializeParticleVariablesFromReload();
 }
 //=================================================================================================//
+template <typename ParticlesType>
+ParticleGenerator<ParticlesType, Restart>::
+    ParticleGenerator(SPHBody &sph_body, ParticlesType &particles, const std::string &restart_file_path)
+    : ParticleGenerator<ParticlesType>(sph_body, particles), file_path_(restart_file_path)
+{
+    if (!fs::exists(file_path_))
+    {
+        std::cout << "\n Error: the restart file:" << file_path_ << " is not exists" << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+}
+//=================================================================================================//
+template <typename ParticlesType>
+void ParticleGenerator<ParticlesType, Restart>::prepareGeometricData()
+{
+    this->base_particles_.readReloadXmlFile(file_path_);
+}
+//=================================================================================================//
+template <typename ParticlesType>
+void ParticleGenerator<ParticlesType, Restart>::setAllParticleBounds()
+{
+    this->base_particles_.initializeAllParticlesBoundsFromReloadXml();
+};
+//=================================================================================================//
+template <typename ParticlesType>
+void ParticleGenerator<ParticlesType, Restart>::initializeParticleVariables()
+{
+    ParticleGenerator<ParticlesType>::initializeParticleVariablesFromReload();
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // BASE_PARTICLE_GENERATOR_HPP
@@ -0,0 +1,78 @@
+#include "static_neighborhood.h"
+
+#include "base_body_relation.h"
+#include "base_particles.hpp"
+
+namespace SPH
+{
+//=================================================================================================//
+StaticInnerNeighborhood::StaticInnerNeighborhood(BaseInnerRelation &inner_relation)
+    : inner_configuration_(inner_relation.inner_configuration_),
+      particles_(inner_relation.getSPHBody().getBaseParticles()),
+      Vol_(particles_.getVariableDataByName<Real>("VolumetricMeasure")),
+      number_of_particles_(0), is_built_(false) {}
+//=================================================================================================//
+void StaticInnerNeighborhood::build()
+{
+    number_of_particles_ = particles_.TotalRealParticles();
+    edge_i_.clear();
+    edge_j_.clear();
+    dW_ijV_iV_j_.clear();
+    e_ij_.clear();
+
+    size_t number_of_real_edges = 0;
+    size_t number_of_mirrored_pairs = 0;
+    StdLargeVec<size_t> particle_edge_count(number_of_particles_, 0);
+    for (size_t index_i = 0; index_i != number_of_particles_; ++index_i)
+    {
+        const Neighborhood &inner_neighborhood = inner_configuration_[index_i];
+        for (size_t n = 0; n != inner_neighborhood.current_size_; ++n)
+        {
+            size_t index_j = inner_neighborhood.j_[n];
+            if (index_j < number_of_particles_ && index_j <= index_i)
+            {
+                number_of_mirrored_pairs += index_j < index_i ? 1 : 0;
+                continue; // the pair is kept from the lower index and self pair is skipped
+            }
+            edge_i_.push_back(index_i);
+            edge_j_.push_back(index_j);
+            dW_ijV_iV_j_.push_back(inner_neighborhood.dW_ij_[n] * Vol_[index_i] * Vol_[index_j]);
+            e_ij_.push_back(inner_neighborhood.e_ij_[n]);
+            particle_edge_count[index_i]++;
+            if (index_j < number_of_particles_)
+            {
+                particle_edge_count[index_j]++;
+                number_of_real_edges++;
+            }
+        }
+    }
+
+    if (number_of_mirrored_pairs != number_of_real_edges)
+    {
+        std::cout << "\n Error: the inner configuration is not symmetric! " << std::endl;
+        std::cout << "\n A static neighborhood requires all real pairs present in both directions. " << std::endl;
+        std::cout << __FILE__ << ':' << __LINE__ << std::endl;
+        exit(1);
+    }
+
+    edge_offset_.resize(number_of_particles_ + 1);
+    edge_offset_[0] = 0;
+    for (size_t index_i = 0; index_i != number_of_particles_; ++index_i)
+    {
+        edge_offset_[index_i + 1] = edge_offset_[index_i] + particle_edge_count[index_i];
+    }
+
+    particle_edge_.resize(edge_offset_[number_of_particles_]);
+    StdLargeVec<size_t> fill_position(edge_offset_.begin(), edge_offset_.end() - 1);
+    for (size_t edge = 0; edge != edge_i_.size(); ++edge)
+    {
+        particle_edge_[fill_position[edge_i_[edge]]++] = edge;
+        if (edge_j_[edge] < number_of_particles_)
+        {
+            particle_edge_[fill_position[edge_j_[edge]]++] = edge;
+        }
+    }
+    is_built_ = true;
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,77 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	static_neighborhood.h
+ * @brief 	The neighbor graph of a body whose particles never move,
+ * such as an Eulerian body, assembled once as unique pairs (edges)
+ * with a particle-to-edge CSR index for gathering the pair fluxes.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef STATIC_NEIGHBORHOOD_H
+#define STATIC_NEIGHBORHOOD_H
+
+#include "neighborhood.h"
+
+namespace SPH
+{
+class BaseInnerRelation;
+class BaseParticles;
+
+/**
+ * @class StaticInnerNeighborhood
+ * @brief The inner configuration of a static body stored as unique edges.
+ * Each pair of real particles (i, j) with i < j is kept once together with its
+ * geometric coefficient dW_ij * Vol_i * Vol_j and unit vector e_ij.
+ * Pairs to a neighbor beyond the real particles, e.g. the ghost particles of
+ * Eulerian boundary conditions, are one-sided edges which only contribute to i.
+ * The geometry is taken from the inner configuration as it is when build() is called,
+ * therefore, it should be called after all kernel corrections and ghost creations.
+ */
+class StaticInnerNeighborhood
+{
+  public:
+    explicit StaticInnerNeighborhood(BaseInnerRelation &inner_relation);
+    virtual ~StaticInnerNeighborhood(){};
+
+    StdLargeVec<size_t> edge_i_;        /**< the lower (or the real) particle index of the edge */
+    StdLargeVec<size_t> edge_j_;        /**< the higher (or the ghost) particle index of the edge */
+    StdLargeVec<Real> dW_ijV_iV_j_;     /**< geometric coefficient of the edge */
+    StdLargeVec<Vecd> e_ij_;            /**< unit vector pointing from j to i */
+    StdLargeVec<size_t> edge_offset_;   /**< offsets of the edges of particle i in particle_edge_ */
+    StdLargeVec<size_t> particle_edge_; /**< edge indices ordered by particle */
+
+    void build();
+    bool isBuilt() { return is_built_; };
+    size_t NumberOfEdges() { return edge_i_.size(); };
+    size_t NumberOfParticles() { return number_of_particles_; };
+
+  protected:
+    ParticleConfiguration &inner_configuration_;
+    BaseParticles &particles_;
+    Real *Vol_;
+    size_t number_of_particles_;
+    bool is_built_;
+};
+} // namespace SPH
+#endif // STATIC_NEIGHBORHOOD_H
@@ -109,9 +109,9 @@ class BaseParticles
     //----------------------------------------------------------------------
     // Generalized particle manipulation
     //----------------------------------------------------------------------
-    UnsignedInt TotalRealParticles() { return *v_total_real_particles_->ValueAddress(); };
-    void incrementTotalRealParticles(UnsignedInt increment = 1) { *v_total_real_particles_->ValueAddress() += increment; };
-    void decrementTotalRealParticles(UnsignedInt decrement = 1) { *v_total_real_particles_->ValueAddress() -= decrement; };
+    UnsignedInt TotalRealParticles() { return v_total_real_particles_->getValue(); };
+    void incrementTotalRealParticles(UnsignedInt increment = 1) { v_total_real_particles_->incrementValue(increment); };
+    void decrementTotalRealParticles(UnsignedInt decrement = 1) { v_total_real_particles_->setValue(TotalRealParticles() - decrement); };
     UnsignedInt RealParticlesBound() { return real_particles_bound_; };
     UnsignedInt ParticlesBound() { return particles_bound_; };
     void initializeAllParticlesBounds(size_t total_real_particles);
@@ -119,7 +119,10 @@ DataType *BaseParticles::registerStateVariable(const std::string &name, Args &&.
     DataType *data_field =
         registerDiscreteVariable<DataType>(name, particles_bound_, std::forward<Args>(args)...);
 
-    std::get<type_index>(all_state_data_).push_back(data_field);
+    // a state variable shared by several owners, e.g. body parts, is copied only once
+    auto &state_data = std::get<type_index>(all_state_data_);
+    if (std::find(state_data.begin(), state_data.end(), data_field) == state_data.end())
+        state_data.push_back(data_field);
 
     return data_field;
 }
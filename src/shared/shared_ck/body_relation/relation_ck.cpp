@@ -12,7 +12,8 @@ Relation<Inner<>>::Relation(RealBody &real_body)
     : Relation<Base>(real_body), real_body_(&real_body),
       cell_linked_list_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList())),
       dv_neighbor_index_(addRelationVariable<UnsignedInt>("NeighborIndex", offset_list_size_)),
-      dv_particle_offset_(addRelationVariable<UnsignedInt>("ParticleOffset", offset_list_size_)) {}
+      dv_particle_offset_(addRelationVariable<UnsignedInt>("ParticleOffset", offset_list_size_)),
+      dv_compressed_neighbor_index_(nullptr) {}
 //=================================================================================================//
 void Relation<Inner<>>::registerComputingKernel(execution::Implementation<Base> *implementation)
 {
@@ -27,6 +28,16 @@ void Relation<Inner<>>::resetComputingKernelUpdated()
     }
 }
 //=================================================================================================//
+void Relation<Inner<>>::compressNeighborIndex()
+{
+    if (dv_compressed_neighbor_index_ == nullptr)
+    {
+        dv_compressed_neighbor_index_ =
+            addRelationVariable<int16_t>("CompressedNeighborIndex", offset_list_size_);
+        resetComputingKernelUpdated();
+    }
+}
+//=================================================================================================//
 Relation<Contact<>>::Relation(SPHBody &sph_body, RealBodyVector contact_sph_bodies)
     : Relation<Base>(sph_body), contact_bodies_(contact_sph_bodies)
 {
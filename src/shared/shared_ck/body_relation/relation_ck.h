@@ -69,14 +69,19 @@ class Relation<Inner<>> : public Relation<Base>
     CellLinkedList &getCellLinkedList() { return cell_linked_list_; };
     DiscreteVariable<UnsignedInt> *getNeighborIndex() { return dv_neighbor_index_; };
     DiscreteVariable<UnsignedInt> *getParticleOffset() { return dv_particle_offset_; };
+    /** nullptr if the neighbor index is not compressed */
+    DiscreteVariable<int16_t> *getCompressedNeighborIndex() { return dv_compressed_neighbor_index_; };
     void registerComputingKernel(execution::Implementation<Base> *implementation);
     void resetComputingKernelUpdated();
+    /** store the neighbor index as 16-bit deltas to the particle index, best used with sorted particles. */
+    void compressNeighborIndex();
 
   protected:
     RealBody *real_body_;
     CellLinkedList &cell_linked_list_;
     DiscreteVariable<UnsignedInt> *dv_neighbor_index_;
     DiscreteVariable<UnsignedInt> *dv_particle_offset_;
+    DiscreteVariable<int16_t> *dv_compressed_neighbor_index_;
     StdVec<execution::Implementation<Base> *> all_inner_computing_kernels_;
 };
 
@@ -0,0 +1,70 @@
+#include "level_set_ck.h"
+
+namespace SPH
+{
+//=================================================================================================//
+LevelSetCK::LevelSetCK(BaseLevelSet &level_set)
+    : mesh_levels_(findMeshLevels(level_set)), total_levels_(mesh_levels_.size()),
+      cell_offsets_(accumulateCellOffsets()), package_offsets_(accumulatePackageOffsets()),
+      dv_mesh_lower_bound_("MeshLowerBound", total_levels_),
+      dv_grid_spacing_("GridSpacing", total_levels_),
+      dv_global_h_ratio_("GlobalHRatio", total_levels_),
+      dv_all_cells_("AllCells", total_levels_),
+      dv_cell_offset_("CellOffset", total_levels_),
+      dv_cell_category_("CellCategory", cell_offsets_.back()),
+      dv_cell_package_index_("CellPackageIndex", cell_offsets_.back()),
+      dv_package_neighbor_("PackageNeighbor", package_offsets_.back() * neighborhood_size),
+      dv_phi_("Levelset", package_offsets_.back() * package_data_size),
+      dv_phi_gradient_("LevelsetGradient", package_offsets_.back() * package_data_size),
+      dv_kernel_weight_("KernelWeight", package_offsets_.back() * package_data_size),
+      dv_kernel_gradient_("KernelGradient", package_offsets_.back() * package_data_size)
+{
+    for (UnsignedInt level = 0; level != total_levels_; ++level)
+    {
+        LevelSet &mesh_level = *mesh_levels_[level];
+        dv_mesh_lower_bound_.DataField()[level] = mesh_level.MeshLowerBound();
+        dv_grid_spacing_.DataField()[level] = mesh_level.GridSpacing();
+        dv_global_h_ratio_.DataField()[level] = mesh_level.global_h_ratio_;
+        dv_all_cells_.DataField()[level] = mesh_level.AllCells();
+        dv_cell_offset_.DataField()[level] = cell_offsets_[level];
+
+        UnsignedInt cell_offset = cell_offsets_[level];
+        mesh_level.flattenIndexMesh(package_offsets_[level],
+                                    dv_cell_category_.DataField() + cell_offset,
+                                    dv_cell_package_index_.DataField() + cell_offset);
+        UnsignedInt data_offset = package_offsets_[level] * package_data_size;
+        mesh_level.flattenDataPackages(package_offsets_[level],
+                                       dv_package_neighbor_.DataField() + package_offsets_[level] * neighborhood_size,
+                                       dv_phi_.DataField() + data_offset,
+                                       dv_phi_gradient_.DataField() + data_offset,
+                                       dv_kernel_weight_.DataField() + data_offset,
+                                       dv_kernel_gradient_.DataField() + data_offset);
+    }
+}
+//=================================================================================================//
+StdVec<LevelSet *> LevelSetCK::findMeshLevels(BaseLevelSet &level_set)
+{
+    LevelSet *single_level = dynamic_cast<LevelSet *>(&level_set);
+    if (single_level != nullptr)
+        return StdVec<LevelSet *>{single_level};
+
+    return DynamicCast<MultilevelLevelSet>(this, level_set).getMeshLevels();
+}
+//=================================================================================================//
+StdVec<UnsignedInt> LevelSetCK::accumulateCellOffsets()
+{
+    StdVec<UnsignedInt> offsets(1, 0);
+    for (LevelSet *mesh_level : mesh_levels_)
+        offsets.push_back(offsets.back() + mesh_level->NumberOfCells());
+    return offsets;
+}
+//=================================================================================================//
+StdVec<UnsignedInt> LevelSetCK::accumulatePackageOffsets()
+{
+    StdVec<UnsignedInt> offsets(1, 0);
+    for (LevelSet *mesh_level : mesh_levels_)
+        offsets.push_back(offsets.back() + mesh_level->NumberOfDataPackages());
+    return offsets;
+}
+//=================================================================================================//
+} // namespace SPH
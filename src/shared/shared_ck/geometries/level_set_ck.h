@@ -0,0 +1,170 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	level_set_ck.h
+ * @brief 	Flattened level set for probing in computing kernels.
+ * @details The index meshes and the data packages of all levels of a level set are copied
+ *          into contiguous discrete variables, so that a lightweight probe kernel
+ *          without virtual calls can be used in computing kernels on host and device.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef LEVEL_SET_CK_H
+#define LEVEL_SET_CK_H
+
+#include "level_set.h"
+
+namespace SPH
+{
+/**
+ * @class LevelSetCK
+ * @brief Flattened copy of a single- or multilevel level set.
+ * Note that the flattened copy does not follow later modifications of the level set,
+ * e.g. cleaning or topology correction, which should be carried out before.
+ */
+class LevelSetCK
+{
+  public:
+    explicit LevelSetCK(BaseLevelSet &level_set);
+    ~LevelSetCK(){};
+
+    class ProbeKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        ProbeKernel(const ExecutionPolicy &ex_policy, LevelSetCK &encloser);
+
+        Real probeSignedDistance(const Vecd &position) const
+        {
+            return probeMesh(phi_, probeLevel(position), position);
+        };
+
+        Vecd probeLevelSetGradient(const Vecd &position) const
+        {
+            return probeMesh(phi_gradient_, probeLevel(position), position);
+        };
+
+        /** Different from the host version, no jittering is applied at vanishing gradient. */
+        Vecd probeNormalDirection(const Vecd &position) const
+        {
+            Vecd gradient = probeLevelSetGradient(position);
+            return gradient / (gradient.norm() + TinyReal);
+        };
+
+        Real probeKernelIntegral(const Vecd &position, Real h_ratio = 1.0) const
+        {
+            return probeBetweenLevels(kernel_weight_, position, h_ratio);
+        };
+
+        Vecd probeKernelGradientIntegral(const Vecd &position, Real h_ratio = 1.0) const
+        {
+            return probeBetweenLevels(kernel_gradient_, position, h_ratio);
+        };
+
+        bool probeIsWithinMeshBound(const Vecd &position) const
+        {
+            for (UnsignedInt level = 0; level != total_levels_; ++level)
+            {
+                Arrayi cell_index = CellIndexFromPosition(level, position);
+                if ((cell_index < 2).any() || (cell_index > all_cells_[level] - 2).any())
+                    return false;
+            }
+            return true;
+        };
+
+      protected:
+        UnsignedInt total_levels_;
+        Vecd *mesh_lower_bound_;
+        Real *grid_spacing_, *global_h_ratio_;
+        Arrayi *all_cells_;
+        UnsignedInt *cell_offset_;
+        int *cell_category_;
+        UnsignedInt *cell_package_index_, *package_neighbor_;
+        Real *phi_, *kernel_weight_;
+        Vecd *phi_gradient_, *kernel_gradient_;
+
+        Arrayi CellIndexFromPosition(UnsignedInt level, const Vecd &position) const
+        {
+            return floor((position - mesh_lower_bound_[level]).array() / grid_spacing_[level])
+                .template cast<int>()
+                .max(Arrayi::Zero())
+                .min(all_cells_[level] - Arrayi::Ones());
+        };
+
+        UnsignedInt LinearCellIndex(UnsignedInt level, const Arrayi &cell_index) const
+        {
+            UnsignedInt linear_index = 0;
+            for (int d = 0; d != Dimensions; ++d)
+                linear_index = linear_index * all_cells_[level][d] + cell_index[d];
+            return cell_offset_[level] + linear_index;
+        };
+
+        /** the finest level with a core package at the position. */
+        UnsignedInt probeLevel(const Vecd &position) const
+        {
+            for (UnsignedInt level = total_levels_; level != 0; --level)
+            {
+                UnsignedInt linear_index = LinearCellIndex(level - 1, CellIndexFromPosition(level - 1, position));
+                if (cell_category_[linear_index] == 2)
+                    return level - 1;
+            }
+            return 0;
+        };
+
+        template <typename DataType>
+        DataType probeMesh(const DataType *data, UnsignedInt level, const Vecd &position) const;
+        template <typename DataType>
+        DataType weightedCornerValue(const DataType *data, UnsignedInt package_index, const Arrayi &data_index,
+                                     const Vecd &alpha, int corner) const;
+        template <typename DataType>
+        DataType probeBetweenLevels(const DataType *data, const Vecd &position, Real h_ratio) const;
+    };
+
+    static constexpr int pkg_size = 4;
+    static constexpr UnsignedInt neighborhood_size = Dimensions == 2 ? 9 : 27;
+    static constexpr UnsignedInt package_data_size = Dimensions == 2 ? 16 : 64;
+
+  protected:
+    StdVec<LevelSet *> mesh_levels_;
+    UnsignedInt total_levels_;
+    StdVec<UnsignedInt> cell_offsets_;
+    StdVec<UnsignedInt> package_offsets_;
+    DiscreteVariable<Vecd> dv_mesh_lower_bound_;
+    DiscreteVariable<Real> dv_grid_spacing_;
+    DiscreteVariable<Real> dv_global_h_ratio_;
+    DiscreteVariable<Arrayi> dv_all_cells_;
+    DiscreteVariable<UnsignedInt> dv_cell_offset_;
+    DiscreteVariable<int> dv_cell_category_;
+    DiscreteVariable<UnsignedInt> dv_cell_package_index_;
+    DiscreteVariable<UnsignedInt> dv_package_neighbor_;
+    DiscreteVariable<Real> dv_phi_;
+    DiscreteVariable<Vecd> dv_phi_gradient_;
+    DiscreteVariable<Real> dv_kernel_weight_;
+    DiscreteVariable<Vecd> dv_kernel_gradient_;
+
+    StdVec<LevelSet *> findMeshLevels(BaseLevelSet &level_set);
+    StdVec<UnsignedInt> accumulateCellOffsets();
+    StdVec<UnsignedInt> accumulatePackageOffsets();
+};
+} // namespace SPH
+#endif // LEVEL_SET_CK_H
@@ -0,0 +1,95 @@
+#ifndef LEVEL_SET_CK_HPP
+#define LEVEL_SET_CK_HPP
+
+#include "level_set_ck.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class ExecutionPolicy>
+LevelSetCK::ProbeKernel::ProbeKernel(const ExecutionPolicy &ex_policy, LevelSetCK &encloser)
+    : total_levels_(encloser.total_levels_),
+      mesh_lower_bound_(encloser.dv_mesh_lower_bound_.DelegatedDataField(ex_policy)),
+      grid_spacing_(encloser.dv_grid_spacing_.DelegatedDataField(ex_policy)),
+      global_h_ratio_(encloser.dv_global_h_ratio_.DelegatedDataField(ex_policy)),
+      all_cells_(encloser.dv_all_cells_.DelegatedDataField(ex_policy)),
+      cell_offset_(encloser.dv_cell_offset_.DelegatedDataField(ex_policy)),
+      cell_category_(encloser.dv_cell_category_.DelegatedDataField(ex_policy)),
+      cell_package_index_(encloser.dv_cell_package_index_.DelegatedDataField(ex_policy)),
+      package_neighbor_(encloser.dv_package_neighbor_.DelegatedDataField(ex_policy)),
+      phi_(encloser.dv_phi_.DelegatedDataField(ex_policy)),
+      kernel_weight_(encloser.dv_kernel_weight_.DelegatedDataField(ex_policy)),
+      phi_gradient_(encloser.dv_phi_gradient_.DelegatedDataField(ex_policy)),
+      kernel_gradient_(encloser.dv_kernel_gradient_.DelegatedDataField(ex_policy)) {}
+//=================================================================================================//
+template <typename DataType>
+DataType LevelSetCK::ProbeKernel::
+    probeMesh(const DataType *data, UnsignedInt level, const Vecd &position) const
+{
+    Arrayi cell_index = CellIndexFromPosition(level, position);
+    UnsignedInt linear_index = LinearCellIndex(level, cell_index);
+    UnsignedInt package_index = cell_package_index_[linear_index];
+    if (cell_category_[linear_index] == 0)
+        return data[package_index * package_data_size];
+
+    Real data_spacing = grid_spacing_[level] / Real(pkg_size);
+    Vecd data_lower_bound = mesh_lower_bound_[level] + cell_index.cast<Real>().matrix() * grid_spacing_[level] +
+                            0.5 * data_spacing * Vecd::Ones();
+    Arrayi data_index = floor((position - data_lower_bound).array() / data_spacing)
+                            .template cast<int>()
+                            .max(Arrayi::Zero())
+                            .min((pkg_size - 1) * Arrayi::Ones());
+    Vecd alpha = (position - data_lower_bound) / data_spacing - data_index.cast<Real>().matrix();
+
+    DataType interpolated = weightedCornerValue(data, package_index, data_index, alpha, 0);
+    for (int corner = 1; corner != (1 << Dimensions); ++corner)
+        interpolated += weightedCornerValue(data, package_index, data_index, alpha, corner);
+    return interpolated;
+}
+//=================================================================================================//
+template <typename DataType>
+DataType LevelSetCK::ProbeKernel::
+    weightedCornerValue(const DataType *data, UnsignedInt package_index, const Arrayi &data_index,
+                        const Vecd &alpha, int corner) const
+{
+    Real weight = 1.0;
+    UnsignedInt neighbor_index = 0;
+    UnsignedInt local_index = 0;
+    for (int d = 0; d != Dimensions; ++d)
+    {
+        int is_upper = (corner >> d) & 1;
+        weight *= is_upper == 1 ? alpha[d] : 1.0 - alpha[d];
+        // a shifted index beyond the package is found in the neighbor package
+        int shifted_index = data_index[d] + is_upper + pkg_size;
+        int neighbor_shift = shifted_index / pkg_size;
+        neighbor_index = neighbor_index * 3 + neighbor_shift;
+        local_index = local_index * pkg_size + shifted_index - neighbor_shift * pkg_size;
+    }
+    UnsignedInt neighbor_package = package_neighbor_[package_index * neighborhood_size + neighbor_index];
+    return weight * data[neighbor_package * package_data_size + local_index];
+}
+//=================================================================================================//
+template <typename DataType>
+DataType LevelSetCK::ProbeKernel::
+    probeBetweenLevels(const DataType *data, const Vecd &position, Real h_ratio) const
+{
+    UnsignedInt coarse_level = 0;
+    for (UnsignedInt level = total_levels_; level != 0; --level)
+    {
+        if (h_ratio > global_h_ratio_[level - 1])
+        {
+            coarse_level = level - 1;
+            break;
+        }
+    }
+    if (coarse_level + 1 == total_levels_)
+        return probeMesh(data, coarse_level, position);
+
+    Real alpha = (global_h_ratio_[coarse_level + 1] - h_ratio) /
+                 (global_h_ratio_[coarse_level + 1] - global_h_ratio_[coarse_level]);
+    return alpha * probeMesh(data, coarse_level, position) +
+           (1.0 - alpha) * probeMesh(data, coarse_level + 1, position);
+}
+//=================================================================================================//
+} // namespace SPH
+#endif // LEVEL_SET_CK_HPP
@@ -49,6 +49,7 @@ class ObservedQuantityRecording<ExecutionPolicy, DataType>
     std::string dynamics_identifier_name_;
     const std::string quantity_name_;
     std::string filefullpath_output_;
+    ColumnarRecording recording_;
 
   public:
     DataType type_indicator_; /*< this is an indicator to identify the variable type. */
@@ -63,19 +64,17 @@ class ObservedQuantityRecording<ExecutionPolicy, DataType>
           quantity_name_(quantity_name)
     {
         DataType *interpolated_quantities = this->dv_interpolated_quantities_->DataField();
-        /** Output for .dat file. */
-        filefullpath_output_ = io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name + ".dat";
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << "run_time"
-                 << "   ";
-
+        /** Output for .dat or .bin file. */
+        recording_.open(io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name,
+                        sph_system_.BinaryRecording());
+        filefullpath_output_ = recording_.FileFullPath();
+        recording_.addTimeColumn(false);
         for (size_t i = 0; i != base_particles_.TotalRealParticles(); ++i)
         {
             std::string quantity_name_i = quantity_name + "[" + std::to_string(i) + "]";
-            plt_engine_.writeAQuantityHeader(out_file, interpolated_quantities[i], quantity_name_i);
+            recording_.addColumn(interpolated_quantities[i], quantity_name_i);
         }
-        out_file << "\n";
-        out_file.close();
+        recording_.closeHeader();
     };
     virtual ~ObservedQuantityRecording(){};
 
@@ -84,16 +83,16 @@ class ObservedQuantityRecording<ExecutionPolicy, DataType>
         this->exec();
         this->dv_interpolated_quantities_->prepareForOutput(ExecutionPolicy{});
         DataType *interpolated_quantities = this->dv_interpolated_quantities_->DataField();
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << sv_physical_time_.getValue() << "   ";
+        recording_.beginRecord(sv_physical_time_.getValue());
         for (size_t i = 0; i != base_particles_.TotalRealParticles(); ++i)
         {
-            plt_engine_.writeAQuantity(out_file, interpolated_quantities[i]);
+            recording_.appendToRecord(interpolated_quantities[i]);
         }
-        out_file << "\n";
-        out_file.close();
+        recording_.closeRecord();
     };
 
+    ColumnarRecording &getRecording() { return recording_; };
+
     DataType *getObservedQuantity()
     {
         return this->interpolated_quantities_;
@@ -109,6 +108,7 @@ class ReducedQuantityRecording<ExecutionPolicy, LocalReduceMethodType> : public
     std::string dynamics_identifier_name_;
     const std::string quantity_name_;
     std::string filefullpath_output_;
+    ColumnarRecording recording_;
 
   public:
     /*< deduce variable type from reduce method. */
@@ -123,25 +123,24 @@ class ReducedQuantityRecording<ExecutionPolicy, LocalReduceMethodType> : public
           dynamics_identifier_name_(reduce_method_.DynamicsIdentifierName()),
           quantity_name_(reduce_method_.QuantityName())
     {
-        /** output for .dat file. */
-        filefullpath_output_ = io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name_ + ".dat";
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << "\"run_time\""
-                 << "   ";
-        plt_engine_.writeAQuantityHeader(out_file, reduce_method_.Reference(), quantity_name_);
-        out_file << "\n";
-        out_file.close();
+        /** output for .dat or .bin file. */
+        recording_.open(io_environment_.output_folder_ + "/" + dynamics_identifier_name_ + "_" + quantity_name_,
+                        sph_system_.BinaryRecording());
+        filefullpath_output_ = recording_.FileFullPath();
+        recording_.addTimeColumn();
+        recording_.addColumn(reduce_method_.Reference(), quantity_name_);
+        recording_.closeHeader();
     };
     virtual ~ReducedQuantityRecording(){};
 
     virtual void writeToFile(size_t iteration_step = 0) override
     {
-        std::ofstream out_file(filefullpath_output_.c_str(), std::ios::app);
-        out_file << sv_physical_time_.getValue() << "   ";
-        plt_engine_.writeAQuantity(out_file, reduce_method_.exec());
-        out_file << "\n";
-        out_file.close();
+        recording_.beginRecord(sv_physical_time_.getValue());
+        recording_.appendToRecord(reduce_method_.exec());
+        recording_.closeRecord();
     };
+
+    ColumnarRecording &getRecording() { return recording_; };
 };
 } // namespace SPH
 #endif // IO_OBSERVATION_CK_H
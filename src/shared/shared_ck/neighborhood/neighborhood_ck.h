@@ -31,6 +31,7 @@
 #ifndef NEIGHBORHOOD_CK_H
 #define NEIGHBORHOOD_CK_H
 
+#include "cell_linked_list.h"
 #include "kernel_wenland_c2_ck.h"
 #include "neighborhood.h"
 
@@ -44,13 +45,15 @@ class Neighbor<>
 {
   public:
     template <class ExecutionPolicy>
-    Neighbor(const ExecutionPolicy &ex_policy, SPHAdaptation *sph_adaptation, DiscreteVariable<Vecd> *dv_pos);
+    Neighbor(const ExecutionPolicy &ex_policy, SPHAdaptation *sph_adaptation, DiscreteVariable<Vecd> *dv_pos,
+             const PeriodicImage &periodic_image);
 
     template <class ExecutionPolicy>
     Neighbor(const ExecutionPolicy &ex_policy, SPHAdaptation *sph_adaptation, SPHAdaptation *contact_adaptation,
-             DiscreteVariable<Vecd> *dv_pos, DiscreteVariable<Vecd> *dv_target_pos);
+             DiscreteVariable<Vecd> *dv_pos, DiscreteVariable<Vecd> *dv_target_pos,
+             const PeriodicImage &periodic_image);
 
-    inline Vecd vec_r_ij(size_t i, size_t j) const { return source_pos_[i] - target_pos_[j]; };
+    inline Vecd vec_r_ij(size_t i, size_t j) const { return periodic_image_.displacement(source_pos_[i], target_pos_[j]); };
     inline Real W_ij(size_t i, size_t j) const { return kernel_.W(vec_r_ij(i, j)); }
     inline Real dW_ij(size_t i, size_t j) const { return kernel_.dW(vec_r_ij(i, j)); }
 
@@ -62,23 +65,101 @@ class Neighbor<>
 
   protected:
     KernelWendlandC2CK kernel_;
+    PeriodicImage periodic_image_;
     Vecd *source_pos_;
     Vecd *target_pos_;
 };
 
+/**
+ * @class CompressedNeighborIndex
+ * @brief Encodes a neighbor index as a 16-bit signed delta relative to the particle index.
+ * After particle sorting, most neighbors are close to the particle in memory so that one word suffices.
+ * A far neighbor is stored as an escape word followed by the words of the full index.
+ */
+class CompressedNeighborIndex
+{
+  public:
+    static constexpr int16_t escape_ = std::numeric_limits<int16_t>::min();
+    static constexpr UnsignedInt escaped_words_ = sizeof(UnsignedInt) / sizeof(int16_t);
+
+    static inline bool isNear(UnsignedInt index_i, UnsignedInt index_j)
+    {
+        return index_j + UnsignedInt(std::numeric_limits<int16_t>::max()) >= index_i &&
+               index_j <= index_i + UnsignedInt(std::numeric_limits<int16_t>::max());
+    };
+
+    /** number of words for encoding the neighbor index */
+    static inline UnsignedInt encodedSize(UnsignedInt index_i, UnsignedInt index_j)
+    {
+        return isNear(index_i, index_j) ? 1 : escaped_words_ + 1;
+    };
+
+    /** returns the number of words written */
+    static inline UnsignedInt encode(UnsignedInt index_i, UnsignedInt index_j, int16_t *words)
+    {
+        if (isNear(index_i, index_j))
+        {
+            words[0] = index_j >= index_i ? int16_t(index_j - index_i) : int16_t(-int16_t(index_i - index_j));
+            return 1;
+        }
+
+        words[0] = escape_;
+        for (UnsignedInt k = 0; k != escaped_words_; ++k)
+        {
+            words[k + 1] = int16_t(uint16_t(index_j >> (16 * k)));
+        }
+        return escaped_words_ + 1;
+    };
+
+    /** returns the number of words read */
+    static inline UnsignedInt decode(UnsignedInt index_i, const int16_t *words, UnsignedInt &index_j)
+    {
+        if (words[0] != escape_)
+        {
+            index_j = index_i + UnsignedInt(words[0]); // wraps around for negative deltas
+            return 1;
+        }
+
+        index_j = 0;
+        for (UnsignedInt k = 0; k != escaped_words_; ++k)
+        {
+            index_j |= UnsignedInt(uint16_t(words[k + 1])) << (16 * k);
+        }
+        return escaped_words_ + 1;
+    };
+};
+
+/**
+ * @class NeighborList
+ * @brief Gives the neighbors of a particle either from the stored neighbor list
+ * or, in list-free mode, by searching the cells of the target cell linked list
+ * directly so that no neighbor list needs to be built or read.
+ * If the compressed neighbor index is given, the stored list is encoded by CompressedNeighborIndex
+ * and the particle offsets count words instead of neighbors.
+ */
 class NeighborList
 {
   public:
     template <class ExecutionPolicy>
     NeighborList(const ExecutionPolicy &ex_policy,
                  DiscreteVariable<UnsignedInt> *dv_neighbor_index,
-                 DiscreteVariable<UnsignedInt> *dv_particle_offset);
+                 DiscreteVariable<UnsignedInt> *dv_particle_offset,
+                 DiscreteVariable<int16_t> *dv_compressed_neighbor_index,
+                 CellLinkedList &target_cell_linked_list, DiscreteVariable<Vecd> *dv_target_pos,
+                 bool is_list_free, bool is_self_excluded);
 
   protected:
     UnsignedInt *neighbor_index_;
     UnsignedInt *particle_offset_;
+    int16_t *compressed_neighbor_index_; /**< nullptr if the neighbor index is not compressed */
+    NeighborSearch neighbor_search_;
+    bool is_list_free_;
+    bool is_self_excluded_; /**< for inner neighbors, the particle itself is not a neighbor */
     inline UnsignedInt FirstNeighbor(UnsignedInt i) { return particle_offset_[i]; };
     inline UnsignedInt LastNeighbor(UnsignedInt i) { return particle_offset_[i + 1]; };
+
+    template <typename FunctionOnEach>
+    inline void forEachNeighbor(UnsignedInt index_i, const Vecd *source_pos, const FunctionOnEach &function) const;
 };
 } // namespace SPH
 #endif // NEIGHBORHOOD_CK_H
\ No newline at end of file
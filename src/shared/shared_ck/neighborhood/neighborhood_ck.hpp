@@ -3,21 +3,25 @@
 
 #include "neighborhood_ck.h"
 
+#include "cell_linked_list.hpp"
+
 namespace SPH
 {
 //=================================================================================================//
 template <class ExecutionPolicy>
 Neighbor<>::Neighbor(const ExecutionPolicy &ex_policy,
-                     SPHAdaptation *sph_adaptation, DiscreteVariable<Vecd> *dv_pos)
-    : kernel_(*sph_adaptation->getKernel()),
+                     SPHAdaptation *sph_adaptation, DiscreteVariable<Vecd> *dv_pos,
+                     const PeriodicImage &periodic_image)
+    : kernel_(*sph_adaptation->getKernel()), periodic_image_(periodic_image),
       source_pos_(dv_pos->DelegatedDataField(ex_policy)),
       target_pos_(dv_pos->DelegatedDataField(ex_policy)){};
 //=================================================================================================//
 template <class ExecutionPolicy>
 Neighbor<>::Neighbor(const ExecutionPolicy &ex_policy,
                      SPHAdaptation *sph_adaptation, SPHAdaptation *contact_adaptation,
-                     DiscreteVariable<Vecd> *dv_pos, DiscreteVariable<Vecd> *dv_contact_pos)
-    : kernel_(*sph_adaptation->getKernel()),
+                     DiscreteVariable<Vecd> *dv_pos, DiscreteVariable<Vecd> *dv_contact_pos,
+                     const PeriodicImage &periodic_image)
+    : kernel_(*sph_adaptation->getKernel()), periodic_image_(periodic_image),
       source_pos_(dv_pos->DelegatedDataField(ex_policy)),
       target_pos_(dv_contact_pos->DelegatedDataField(ex_policy))
 {
@@ -31,9 +35,53 @@ Neighbor<>::Neighbor(const ExecutionPolicy &ex_policy,
 template <class ExecutionPolicy>
 NeighborList::NeighborList(const ExecutionPolicy &ex_policy,
                            DiscreteVariable<UnsignedInt> *dv_neighbor_index,
-                           DiscreteVariable<UnsignedInt> *dv_particle_offset)
+                           DiscreteVariable<UnsignedInt> *dv_particle_offset,
+                           DiscreteVariable<int16_t> *dv_compressed_neighbor_index,
+                           CellLinkedList &target_cell_linked_list, DiscreteVariable<Vecd> *dv_target_pos,
+                           bool is_list_free, bool is_self_excluded)
     : neighbor_index_(dv_neighbor_index->DelegatedDataField(ex_policy)),
-      particle_offset_(dv_particle_offset->DelegatedDataField(ex_policy)) {}
+      particle_offset_(dv_particle_offset->DelegatedDataField(ex_policy)),
+      compressed_neighbor_index_(dv_compressed_neighbor_index != nullptr
+                                     ? dv_compressed_neighbor_index->DelegatedDataField(ex_policy)
+                                     : nullptr),
+      neighbor_search_(target_cell_linked_list.createNeighborSearch(ex_policy, dv_target_pos)),
+      is_list_free_(is_list_free), is_self_excluded_(is_self_excluded) {}
+//=================================================================================================//
+template <typename FunctionOnEach>
+void NeighborList::forEachNeighbor(UnsignedInt index_i, const Vecd *source_pos,
+                                   const FunctionOnEach &function) const
+{
+    if (is_list_free_)
+    {
+        neighbor_search_.forEachSearch(
+            index_i, source_pos,
+            [&](UnsignedInt index_j)
+            {
+                if (!is_self_excluded_ || index_i != index_j)
+                {
+                    function(index_j);
+                }
+            });
+        return;
+    }
+
+    if (compressed_neighbor_index_ != nullptr)
+    {
+        UnsignedInt n = particle_offset_[index_i];
+        while (n != particle_offset_[index_i + 1])
+        {
+            UnsignedInt index_j;
+            n += CompressedNeighborIndex::decode(index_i, compressed_neighbor_index_ + n, index_j);
+            function(index_j);
+        }
+        return;
+    }
+
+    for (UnsignedInt n = particle_offset_[index_i]; n != particle_offset_[index_i + 1]; ++n)
+    {
+        function(neighbor_index_[n]);
+    }
+}
 //=================================================================================================//
 } // namespace SPH
 #endif // NEIGHBORHOOD_CK_HPP
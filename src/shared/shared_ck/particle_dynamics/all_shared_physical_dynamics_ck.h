@@ -39,6 +39,7 @@
 #include "fluid_time_step_ck.hpp"
 #include "interaction_algorithms_ck.hpp"
 #include "particle_sort_ck.hpp"
+#include "relax_stepping_ck.hpp"
 #include "simple_algorithms_ck.h"
 
 #endif // ALL_SHARED_PHYSICAL_DYNAMICS_CK_H
@@ -112,6 +112,7 @@ class ParticleSortCK : public LocalDynamics, public BaseDynamics<void>
         Mesh mesh_;
 
         Vecd *pos_;
+        int *body_part_id_;
         UnsignedInt *sequence_;
         UnsignedInt *index_permutation_;
         UnsignedInt *original_id_;
@@ -127,6 +128,7 @@ class ParticleSortCK : public LocalDynamics, public BaseDynamics<void>
     CellLinkedList &cell_linked_list_;
     Mesh mesh_;
     DiscreteVariable<Vecd> *dv_pos_;
+    DiscreteVariable<int> *dv_body_part_id_;
     DiscreteVariable<UnsignedInt> *dv_sequence_;
     DiscreteVariable<UnsignedInt> *dv_index_permutation_;
     DiscreteVariable<UnsignedInt> *dv_original_id_;
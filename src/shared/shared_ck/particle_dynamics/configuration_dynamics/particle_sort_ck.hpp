@@ -54,6 +54,7 @@ ParticleSortCK<ExecutionPolicy, SortMethodType>::ParticleSortCK(RealBody &real_b
       cell_linked_list_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList())),
       mesh_(cell_linked_list_),
       dv_pos_(particles_->getVariableByName<Vecd>("Position")),
+      dv_body_part_id_(particles_->registerStateVariableOnly<int>("BodyPartID")),
       dv_sequence_(particles_->registerDiscreteVariableOnly<UnsignedInt>(
           "Sequence", particles_->ParticlesBound())),
       dv_index_permutation_(particles_->registerDiscreteVariableOnly<UnsignedInt>(
@@ -65,6 +66,7 @@ ParticleSortCK<ExecutionPolicy, SortMethodType>::ParticleSortCK(RealBody &real_b
       kernel_implementation_(*this)
 {
     particles_->addVariableToSort<UnsignedInt>("OriginalID");
+    particles_->addVariableToSort<int>("BodyPartID");
 }
 //=================================================================================================//
 template <class ExecutionPolicy, class SortMethodType>
@@ -72,6 +74,7 @@ ParticleSortCK<ExecutionPolicy, SortMethodType>::ComputingKernel::
     ComputingKernel(const ExecutionPolicy &ex_policy,
                     ParticleSortCK<ExecutionPolicy, SortMethodType> &encloser)
     : mesh_(encloser.mesh_), pos_(encloser.dv_pos_->DelegatedDataField(ex_policy)),
+      body_part_id_(encloser.dv_body_part_id_->DelegatedDataField(ex_policy)),
       sequence_(encloser.dv_sequence_->DelegatedDataField(ex_policy)),
       index_permutation_(encloser.dv_index_permutation_->DelegatedDataField(ex_policy)),
       original_id_(encloser.dv_original_id_->DelegatedDataField(ex_policy)),
@@ -81,7 +84,8 @@ template <class ExecutionPolicy, class SortMethodType>
 void ParticleSortCK<ExecutionPolicy, SortMethodType>::ComputingKernel::
     prepareSequence(UnsignedInt index_i)
 {
-    sequence_[index_i] = mesh_.transferMeshIndexToMortonOrder(mesh_.CellIndexFromPosition(pos_[index_i]));
+    sequence_[index_i] = SortingSequence(
+        body_part_id_[index_i], mesh_.transferMeshIndexToMortonOrder(mesh_.CellIndexFromPosition(pos_[index_i])));
     index_permutation_[index_i] = index_i;
 }
 //=================================================================================================//
@@ -108,6 +112,10 @@ void ParticleSortCK<ExecutionPolicy, SortMethodType>::exec(Real dt)
     particle_for(ex_policy_, IndexRange(0, total_real_particles),
                  [=](size_t i)
                  { computing_kernel->updateSortedID(i); });
+
+    dv_body_part_id_->prepareForOutput(ex_policy_);
+    dv_sorted_id_->prepareForOutput(ex_policy_);
+    sph_body_.updateBodyPartsAfterSorting();
 }
 //=================================================================================================//
 } // namespace SPH
@@ -0,0 +1,14 @@
+#include "periodic_condition_ck.h"
+
+namespace SPH
+{
+//=================================================================================================//
+PeriodicConditionCK::PeriodicConditionCK(RealBody &real_body, PeriodicAlongAxis &periodic_box)
+    : LocalDynamics(real_body),
+      periodic_image_(DynamicCast<CellLinkedList>(this, real_body.getCellLinkedList()).getPeriodicImage()),
+      dv_pos_(particles_->getVariableByName<Vecd>("Position"))
+{
+    periodic_image_.setPeriodicAxis(periodic_box.getBoundingBox(), periodic_box.getAxis());
+}
+//=================================================================================================//
+} // namespace SPH
@@ -0,0 +1,72 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file    periodic_condition_ck.h
+ * @brief   Periodic condition for the CK particle configuration without ghost particles.
+ * @details The periodicity is given to the cell linked list of the body,
+ *          so that the neighbor search and the pair displacement use the periodic images.
+ *          The dynamics itself only wraps the particle positions into the periodic bounds.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef PERIODIC_CONDITION_CK_H
+#define PERIODIC_CONDITION_CK_H
+
+#include "base_general_dynamics.h"
+#include "cell_linked_list.h"
+#include "domain_bounding.h"
+
+namespace SPH
+{
+/**
+ * @class PeriodicConditionCK
+ * @brief For a body which does not move, such as a wall,
+ * only constructing the dynamics is required to give the periodicity to its cell linked list.
+ */
+class PeriodicConditionCK : public LocalDynamics
+{
+  public:
+    PeriodicConditionCK(RealBody &real_body, PeriodicAlongAxis &periodic_box);
+    virtual ~PeriodicConditionCK(){};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        UpdateKernel(const ExecutionPolicy &ex_policy, PeriodicConditionCK &encloser);
+        void update(size_t index_i, Real dt = 0.0)
+        {
+            pos_[index_i] = periodic_image_.wrap(pos_[index_i]);
+        };
+
+      protected:
+        PeriodicImage periodic_image_;
+        Vecd *pos_;
+    };
+
+  protected:
+    PeriodicImage &periodic_image_;
+    DiscreteVariable<Vecd> *dv_pos_;
+};
+} // namespace SPH
+#endif // PERIODIC_CONDITION_CK_H
@@ -0,0 +1,16 @@
+#ifndef PERIODIC_CONDITION_CK_HPP
+#define PERIODIC_CONDITION_CK_HPP
+
+#include "periodic_condition_ck.h"
+
+namespace SPH
+{
+//=================================================================================================//
+template <class ExecutionPolicy>
+PeriodicConditionCK::UpdateKernel::
+    UpdateKernel(const ExecutionPolicy &ex_policy, PeriodicConditionCK &encloser)
+    : periodic_image_(encloser.periodic_image_),
+      pos_(encloser.dv_pos_->DelegatedDataField(ex_policy)) {}
+//=================================================================================================//
+} // namespace SPH
+#endif // PERIODIC_CONDITION_CK_HPP
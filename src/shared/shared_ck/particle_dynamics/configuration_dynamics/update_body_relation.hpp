@@ -32,6 +32,7 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
     ComputingKernel::incrementNeighborSize(UnsignedInt index_i)
 {
     // Here, neighbor_index_ takes role of temporary storage for neighbor size list.
+    // For the compressed neighbor index, the size is given in words.
     UnsignedInt neighbor_count = 0;
     neighbor_search_.forEachSearch(
         index_i, this->source_pos_,
@@ -39,7 +40,9 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
         {
             if (index_i != index_j)
             {
-                neighbor_count++;
+                neighbor_count += this->compressed_neighbor_index_ != nullptr
+                                      ? CompressedNeighborIndex::encodedSize(index_i, index_j)
+                                      : 1;
             }
         });
     this->neighbor_index_[index_i] = neighbor_count;
@@ -50,6 +53,21 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::
     ComputingKernel::updateNeighborList(UnsignedInt index_i)
 {
     UnsignedInt neighbor_count = 0;
+    if (this->compressed_neighbor_index_ != nullptr)
+    {
+        int16_t *words = this->compressed_neighbor_index_ + this->particle_offset_[index_i];
+        neighbor_search_.forEachSearch(
+            index_i, this->source_pos_,
+            [&](size_t index_j)
+            {
+                if (index_i != index_j)
+                {
+                    neighbor_count += CompressedNeighborIndex::encode(index_i, index_j, words + neighbor_count);
+                }
+            });
+        return;
+    }
+
     neighbor_search_.forEachSearch(
         index_i, this->source_pos_,
         [&](size_t index_j)
@@ -79,7 +97,17 @@ void UpdateRelation<ExecutionPolicy, Inner<Parameters...>>::exec(Real dt)
                        this->particle_offset_list_size_,
                        typename PlusUnsignedInt<ExecutionPolicy>::type());
 
-    if (current_neighbor_index_size > this->dv_neighbor_index_->getDataFieldSize())
+    DiscreteVariable<int16_t> *dv_compressed_neighbor_index = this->inner_relation_.getCompressedNeighborIndex();
+    if (dv_compressed_neighbor_index != nullptr)
+    {
+        if (current_neighbor_index_size > dv_compressed_neighbor_index->getDataFieldSize())
+        {
+            dv_compressed_neighbor_index->reallocateDataField(ex_policy_, current_neighbor_index_size);
+            this->inner_relation_.resetComputingKernelUpdated();
+            kernel_implementation_.overwriteComputingKernel();
+        }
+    }
+    else if (current_neighbor_index_size > this->dv_neighbor_index_->getDataFieldSize())
     {
         this->dv_neighbor_index_->reallocateDataField(ex_policy_, current_neighbor_index_size);
         this->inner_relation_.resetComputingKernelUpdated();
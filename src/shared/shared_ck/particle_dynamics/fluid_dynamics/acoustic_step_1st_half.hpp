@@ -100,15 +100,16 @@ void AcousticStep1stHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType
 {
     Vecd force = Vecd::Zero();
     Real rho_dissipation(0);
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
-    {
-        UnsignedInt index_j = this->neighbor_index_[n];
-        Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
-        Vecd e_ij = this->e_ij(index_i, index_j);
+    this->forEachNeighbor(
+        index_i, this->source_pos_,
+        [&](UnsignedInt index_j)
+        {
+            Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
+            Vecd e_ij = this->e_ij(index_i, index_j);
 
-        force -= (p_[index_i] * correction_(index_j) + p_[index_j] * correction_(index_i)) * dW_ijV_j * e_ij;
-        rho_dissipation += riemann_solver_.DissipativeUJump(p_[index_i] - p_[index_j]) * dW_ijV_j;
-    }
+            force -= (p_[index_i] * correction_(index_j) + p_[index_j] * correction_(index_i)) * dW_ijV_j * e_ij;
+            rho_dissipation += riemann_solver_.DissipativeUJump(p_[index_i] - p_[index_j]) * dW_ijV_j;
+        });
     force_[index_i] += force * Vol_[index_i];
     drho_dt_[index_i] = rho_dissipation * rho_[index_i];
 }
@@ -159,18 +160,19 @@ void AcousticStep1stHalf<Contact<Wall, RiemannSolverType, KernelCorrectionType,
 {
     Vecd force = Vecd::Zero();
     Real rho_dissipation(0);
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
-    {
-        UnsignedInt index_j = this->neighbor_index_[n];
-        Real dW_ijV_j = this->dW_ij(index_i, index_j) * wall_Vol_[index_j];
-        Vecd e_ij = this->e_ij(index_i, index_j);
-        Real r_ij = this->vec_r_ij(index_i, index_j).norm();
+    this->forEachNeighbor(
+        index_i, this->source_pos_,
+        [&](UnsignedInt index_j)
+        {
+            Real dW_ijV_j = this->dW_ij(index_i, index_j) * wall_Vol_[index_j];
+            Vecd e_ij = this->e_ij(index_i, index_j);
+            Real r_ij = this->vec_r_ij(index_i, index_j).norm();
 
-        Real face_wall_external_acceleration = (force_prior_[index_i] / mass_[index_i] - wall_acc_ave_[index_j]).dot(-e_ij);
-        Real p_in_wall = p_[index_i] + rho_[index_i] * r_ij * SMAX(Real(0), face_wall_external_acceleration);
-        force -= (p_[index_i] + p_in_wall) * correction_(index_i) * dW_ijV_j * e_ij;
-        rho_dissipation += riemann_solver_.DissipativeUJump(p_[index_i] - p_in_wall) * dW_ijV_j;
-    }
+            Real face_wall_external_acceleration = (force_prior_[index_i] / mass_[index_i] - wall_acc_ave_[index_j]).dot(-e_ij);
+            Real p_in_wall = p_[index_i] + rho_[index_i] * r_ij * SMAX(Real(0), face_wall_external_acceleration);
+            force -= (p_[index_i] + p_in_wall) * correction_(index_i) * dW_ijV_j * e_ij;
+            rho_dissipation += riemann_solver_.DissipativeUJump(p_[index_i] - p_in_wall) * dW_ijV_j;
+        });
     force_[index_i] += force * Vol_[index_i];
     drho_dt_[index_i] += rho_dissipation * rho_[index_i];
 }
@@ -51,16 +51,17 @@ void AcousticStep2ndHalf<Inner<OneLevel, RiemannSolverType, KernelCorrectionType
 {
     Real density_change_rate(0);
     Vecd p_dissipation = Vecd::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
-    {
-        UnsignedInt index_j = this->neighbor_index_[n];
-        Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
-        Vecd corrected_e_ij = correction_(index_i) * this->e_ij(index_i, index_j);
+    this->forEachNeighbor(
+        index_i, this->source_pos_,
+        [&](UnsignedInt index_j)
+        {
+            Real dW_ijV_j = this->dW_ij(index_i, index_j) * Vol_[index_j];
+            Vecd corrected_e_ij = correction_(index_i) * this->e_ij(index_i, index_j);
 
-        Real u_jump = (vel_[index_i] - vel_[index_j]).dot(corrected_e_ij);
-        density_change_rate += u_jump * dW_ijV_j;
-        p_dissipation += riemann_solver_.DissipativePJump(u_jump) * dW_ijV_j * corrected_e_ij;
-    }
+            Real u_jump = (vel_[index_i] - vel_[index_j]).dot(corrected_e_ij);
+            density_change_rate += u_jump * dW_ijV_j;
+            p_dissipation += riemann_solver_.DissipativePJump(u_jump) * dW_ijV_j * corrected_e_ij;
+        });
     drho_dt_[index_i] += density_change_rate * rho_[index_i];
     force_[index_i] = p_dissipation * Vol_[index_i];
 }
@@ -108,17 +109,18 @@ void AcousticStep2ndHalf<Contact<Wall, RiemannSolverType, KernelCorrectionType,
 {
     Real density_change_rate = 0.0;
     Vecd p_dissipation = Vecd::Zero();
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
-    {
-        UnsignedInt index_j = this->neighbor_index_[n];
-        Real dW_ijV_j = this->dW_ij(index_i, index_j) * wall_Vol_[index_j];
-        Vecd corrected_e_ij = correction_(index_i) * this->e_ij(index_i, index_j);
+    this->forEachNeighbor(
+        index_i, this->source_pos_,
+        [&](UnsignedInt index_j)
+        {
+            Real dW_ijV_j = this->dW_ij(index_i, index_j) * wall_Vol_[index_j];
+            Vecd corrected_e_ij = correction_(index_i) * this->e_ij(index_i, index_j);
 
-        Vecd vel_in_wall = 2.0 * wall_vel_ave_[index_j] - vel_[index_i];
-        density_change_rate += (vel_[index_i] - vel_in_wall).dot(corrected_e_ij) * dW_ijV_j;
-        Real u_jump = 2.0 * (vel_[index_i] - wall_vel_ave_[index_j]).dot(wall_n_[index_j]);
-        p_dissipation += riemann_solver_.DissipativePJump(u_jump) * dW_ijV_j * wall_n_[index_j];
-    }
+            Vecd vel_in_wall = 2.0 * wall_vel_ave_[index_j] - vel_[index_i];
+            density_change_rate += (vel_[index_i] - vel_in_wall).dot(corrected_e_ij) * dW_ijV_j;
+            Real u_jump = 2.0 * (vel_[index_i] - wall_vel_ave_[index_j]).dot(wall_n_[index_j]);
+            p_dissipation += riemann_solver_.DissipativePJump(u_jump) * dW_ijV_j * wall_n_[index_j];
+        });
     drho_dt_[index_i] += density_change_rate * rho_[index_i];
     force_[index_i] += p_dissipation * Vol_[index_i];
 }
@@ -55,8 +55,8 @@ void DensityRegularization<Inner<WithUpdate, RegularizationType, Parameters...>>
     InteractKernel::interact(size_t index_i, Real dt)
 {
     Real sigma = W0_;
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
-        sigma += this->W_ij(index_i, this->neighbor_index_[n]);
+    this->forEachNeighbor(index_i, this->source_pos_, [&](UnsignedInt index_j)
+                          { sigma += this->W_ij(index_i, index_j); });
 
     this->rho_sum_[index_i] = sigma * this->rho0_ * this->inv_sigma0_;
 }
@@ -105,11 +105,12 @@ void DensityRegularization<Contact<Parameters...>>::
     InteractKernel::interact(size_t index_i, Real dt)
 {
     Real sigma(0);
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
-    {
-        UnsignedInt index_j = this->neighbor_index_[n];
-        sigma += this->W_ij(index_i, index_j) * contact_inv_rho0_k_ * contact_mass_k_[index_j];
-    }
+    this->forEachNeighbor(
+        index_i, this->source_pos_,
+        [&](UnsignedInt index_j)
+        {
+            sigma += this->W_ij(index_i, index_j) * contact_inv_rho0_k_ * contact_mass_k_[index_j];
+        });
     this->rho_sum_[index_i] += sigma * this->rho0_ * this->rho0_ *
                                this->inv_sigma0_ / this->mass_[index_i];
 }
@@ -14,12 +14,11 @@ NormalFromBodyShapeCK::NormalFromBodyShapeCK(SPHBody &sph_body)
 //=============================================================================================//
 void NormalFromBodyShapeCK::UpdateKernel::update(size_t index_i, Real dt)
 {
-    Vecd normal_direction = initial_shape_->findNormalDirection(pos_[index_i]);
-    n_[index_i] = normal_direction;
-    n0_[index_i] = normal_direction;
-    Real signed_distance = initial_shape_->findSignedDistance(pos_[index_i]);
-    phi_[index_i] = signed_distance;
-    phi0_[index_i] = signed_distance;
+    std::pair<Real, Vecd> signed_distance_and_normal = initial_shape_->findSignedDistanceAndNormal(pos_[index_i]);
+    n_[index_i] = signed_distance_and_normal.second;
+    n0_[index_i] = signed_distance_and_normal.second;
+    phi_[index_i] = signed_distance_and_normal.first;
+    phi0_[index_i] = signed_distance_and_normal.first;
 }
 //=================================================================================================//
 } // namespace SPH
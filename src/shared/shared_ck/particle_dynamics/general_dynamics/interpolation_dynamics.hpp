@@ -37,14 +37,15 @@ void Interpolation<Contact<DataType>>::InteractKernel::interact(size_t index_i,
     DataType interpolated_quantity(zero_value_);
     Real ttl_weight(0);
 
-    for (UnsignedInt n = this->FirstNeighbor(index_i); n != this->LastNeighbor(index_i); ++n)
-    {
-        UnsignedInt index_j = this->neighbor_index_[n];
-        Real weight_j = this->W_ij(index_i, index_j) * contact_Vol_[index_j];
+    this->forEachNeighbor(
+        index_i, this->source_pos_,
+        [&](UnsignedInt index_j)
+        {
+            Real weight_j = this->W_ij(index_i, index_j) * contact_Vol_[index_j];
 
-        interpolated_quantity += weight_j * contact_data_[index_j];
-        ttl_weight += weight_j;
-    }
+            interpolated_quantity += weight_j * contact_data_[index_j];
+            ttl_weight += weight_j;
+        });
     interpolated_quantities_[index_i] = interpolated_quantity / (ttl_weight + TinyReal);
 }
 //=================================================================================================//
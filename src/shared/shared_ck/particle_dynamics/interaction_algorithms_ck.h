@@ -104,8 +104,13 @@ class InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Paramet
     template <typename... Args>
     InteractionDynamicsCK(Args &&...args);
     virtual ~InteractionDynamicsCK(){};
+    /** split the interaction loop into chunks of equal neighbor counts instead of equal particle numbers. */
+    void enableWorkWeighting() { is_work_weighted_ = true; };
+    /** search neighbors from the cell linked list inside the interaction without reading the neighbor list. */
+    void enableListFreeSearch();
 
   protected:
+    bool is_work_weighted_ = false;
     void runInteraction(Real dt);
 };
 
@@ -123,8 +128,13 @@ class InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Param
     template <typename... Args>
     InteractionDynamicsCK(Args &&...args);
     virtual ~InteractionDynamicsCK(){};
+    /** split the interaction loop into chunks of equal neighbor counts instead of equal particle numbers. */
+    void enableWorkWeighting() { is_work_weighted_ = true; };
+    /** search neighbors from the cell linked list inside the interaction without reading the neighbor list. */
+    void enableListFreeSearch();
 
   protected:
+    bool is_work_weighted_ = false;
     void runInteraction(Real dt);
 };
 
@@ -209,6 +219,8 @@ class InteractionDynamicsCK<ExecutionPolicy, InteractionType<>>
   public:
     InteractionDynamicsCK(){};
     void runInteractionStep(Real dt = 0.0){};
+    void enableWorkWeighting(){};
+    void enableListFreeSearch(){};
 };
 
 template <class ExecutionPolicy, template <typename...> class InteractionType,
@@ -224,6 +236,8 @@ class InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction, O
     explicit InteractionDynamicsCK(
         FirstParameterSet &&first_parameter_set, OtherParameterSets &&...other_parameter_sets);
     virtual void runInteractionStep(Real dt = 0.0) override;
+    void enableWorkWeighting();
+    void enableListFreeSearch();
 };
 } // namespace SPH
 #endif // INTERACTION_ALGORITHMS_CK_H
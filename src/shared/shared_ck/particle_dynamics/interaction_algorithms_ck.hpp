@@ -18,6 +18,16 @@ void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Paramete
     runInteraction(Real dt)
 {
     InteractKernel *interact_kernel = kernel_implementation_.getComputingKernel();
+    if (is_work_weighted_ && !this->is_list_free_)
+    {
+        particle_for(ExecutionPolicy{},
+                     this->identifier_.LoopRange(),
+                     this->dv_particle_offset_->DelegatedDataField(ExecutionPolicy{}),
+                     [=](size_t i)
+                     { interact_kernel->interact(i, dt); });
+        return;
+    }
+
     particle_for(ExecutionPolicy{},
                  this->identifier_.LoopRange(),
                  [=](size_t i)
@@ -25,6 +35,14 @@ void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Paramete
 }
 //=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
+void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Inner<Parameters...>>>::
+    enableListFreeSearch()
+{
+    this->is_list_free_ = true;
+    kernel_implementation_.resetUpdated();
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
 template <typename... Args>
 InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parameters...>>>::
     InteractionDynamicsCK(Args &&...args)
@@ -47,6 +65,16 @@ void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parame
         InteractKernel *interact_kernel =
             contact_kernel_implementation_[k]->getComputingKernel(k);
 
+        if (is_work_weighted_ && !this->is_list_free_)
+        {
+            particle_for(ExecutionPolicy{},
+                         this->identifier_.LoopRange(),
+                         this->dv_contact_particle_offset_[k]->DelegatedDataField(ExecutionPolicy{}),
+                         [=](size_t i)
+                         { interact_kernel->interact(i, dt); });
+            continue;
+        }
+
         particle_for(ExecutionPolicy{},
                      this->identifier_.LoopRange(),
                      [=](size_t i)
@@ -54,6 +82,17 @@ void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parame
     }
 }
 //=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType, typename... Parameters>
+void InteractionDynamicsCK<ExecutionPolicy, Base, InteractionType<Contact<Parameters...>>>::
+    enableListFreeSearch()
+{
+    this->is_list_free_ = true;
+    for (size_t k = 0; k != this->contact_bodies_.size(); ++k)
+    {
+        contact_kernel_implementation_[k]->resetUpdated();
+    }
+}
+//=================================================================================================//
 template <class ExecutionPolicy, template <typename...> class InteractionType,
           template <typename...> class RelationType, typename... Parameters>
 template <typename... Args>
@@ -194,5 +233,23 @@ void InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction, Ot
     other_interactions_.runInteractionStep(dt);
 }
 //=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          class FirstInteraction, class... Others>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction, Others...>>::
+    enableWorkWeighting()
+{
+    InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction>>::enableWorkWeighting();
+    other_interactions_.enableWorkWeighting();
+}
+//=================================================================================================//
+template <class ExecutionPolicy, template <typename...> class InteractionType,
+          class FirstInteraction, class... Others>
+void InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction, Others...>>::
+    enableListFreeSearch()
+{
+    InteractionDynamicsCK<ExecutionPolicy, InteractionType<FirstInteraction>>::enableListFreeSearch();
+    other_interactions_.enableListFreeSearch();
+}
+//=================================================================================================//
 } // namespace SPH
 #endif // INTERACTION_ALGORITHMS_CK_HPP
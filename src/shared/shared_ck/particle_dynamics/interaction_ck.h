@@ -67,6 +67,7 @@ class Interaction<Inner<Parameters...>> : public LocalDynamics
     DiscreteVariable<Vecd> *dv_pos_;
     DiscreteVariable<UnsignedInt> *dv_neighbor_index_;
     DiscreteVariable<UnsignedInt> *dv_particle_offset_;
+    bool is_list_free_ = false; /**< neighbors are searched from the cell linked list on the fly */
 };
 
 template <typename... Parameters>
@@ -98,6 +99,7 @@ class Interaction<Contact<Parameters...>> : public LocalDynamics
     StdVec<DiscreteVariable<Vecd> *> contact_pos_;
     StdVec<DiscreteVariable<UnsignedInt> *> dv_contact_neighbor_index_;
     StdVec<DiscreteVariable<UnsignedInt> *> dv_contact_particle_offset_;
+    bool is_list_free_ = false; /**< neighbors are searched from the cell linked list on the fly */
 };
 
 template <typename... Parameters>
@@ -34,8 +34,12 @@ template <class ExecutionPolicy>
 Interaction<Inner<Parameters...>>::InteractKernel::
     InteractKernel(const ExecutionPolicy &ex_policy,
                    Interaction<Inner<Parameters...>> &encloser)
-    : NeighborList(ex_policy, encloser.dv_neighbor_index_, encloser.dv_particle_offset_),
-      Neighbor<Parameters...>(ex_policy, encloser.sph_adaptation_, encloser.dv_pos_) {}
+    : NeighborList(ex_policy, encloser.dv_neighbor_index_, encloser.dv_particle_offset_,
+                   encloser.inner_relation_.getCompressedNeighborIndex(),
+                   encloser.inner_relation_.getCellLinkedList(), encloser.dv_pos_,
+                   encloser.is_list_free_, true),
+      Neighbor<Parameters...>(ex_policy, encloser.sph_adaptation_, encloser.dv_pos_,
+                              encloser.inner_relation_.getCellLinkedList().getPeriodicImage()) {}
 //=================================================================================================//
 template <typename... Parameters>
 Interaction<Contact<Parameters...>>::
@@ -77,10 +81,13 @@ Interaction<Contact<Parameters...>>::InteractKernel::
                    Interaction<Contact<Parameters...>> &encloser, UnsignedInt contact_index)
     : NeighborList(ex_policy,
                    encloser.dv_contact_neighbor_index_[contact_index],
-                   encloser.dv_contact_particle_offset_[contact_index]),
+                   encloser.dv_contact_particle_offset_[contact_index], nullptr,
+                   *encloser.contact_relation_.getContactCellLinkedList()[contact_index],
+                   encloser.contact_pos_[contact_index], encloser.is_list_free_, false),
       Neighbor<Parameters...>(ex_policy, encloser.sph_adaptation_,
                               encloser.contact_adaptations_[contact_index],
-                              encloser.dv_pos_, encloser.contact_pos_[contact_index]) {}
+                              encloser.dv_pos_, encloser.contact_pos_[contact_index],
+                              encloser.contact_relation_.getContactCellLinkedList()[contact_index]->getPeriodicImage()) {}
 //=================================================================================================//
 template <typename... Parameters>
 Interaction<Contact<Wall, Parameters...>>::
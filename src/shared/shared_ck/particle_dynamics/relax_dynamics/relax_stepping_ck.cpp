@@ -0,0 +1,30 @@
+#include "relax_stepping_ck.hpp"
+
+namespace SPH
+{
+namespace relax_dynamics
+{
+//=================================================================================================//
+RelaxationScalingCK::RelaxationScalingCK(SPHBody &sph_body)
+    : LocalDynamicsReduce<ReduceMax>(sph_body),
+      dv_residue_(particles_->getVariableByName<Vecd>("ZeroOrderResidue")),
+      h_ref_(sph_body.sph_adaptation_->ReferenceSmoothingLength()) {}
+//=================================================================================================//
+Real RelaxationScalingCK::outputResult(Real reduced_value)
+{
+    return 0.0625 * h_ref_ / (reduced_value + TinyReal);
+}
+//=================================================================================================//
+PositionRelaxationCK::PositionRelaxationCK(SPHBody &sph_body)
+    : LocalDynamics(sph_body),
+      dv_pos_(particles_->getVariableByName<Vecd>("Position")),
+      dv_residue_(particles_->getVariableByName<Vecd>("ZeroOrderResidue")) {}
+//=================================================================================================//
+ShapeSurfaceBoundingCK::ShapeSurfaceBoundingCK(SPHBody &sph_body)
+    : LocalDynamics(sph_body),
+      dv_pos_(particles_->getVariableByName<Vecd>("Position")),
+      level_set_ck_(DynamicCast<LevelSetShape>(this, sph_body.getInitialShape()).getLevelSetCK()),
+      constrained_distance_(0.5 * sph_body.sph_adaptation_->MinimumSpacing()) {}
+//=================================================================================================//
+} // namespace relax_dynamics
+} // namespace SPH
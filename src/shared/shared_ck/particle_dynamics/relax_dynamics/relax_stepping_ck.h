@@ -0,0 +1,222 @@
+/* ------------------------------------------------------------------------- *
+ *                                SPHinXsys                                  *
+ * ------------------------------------------------------------------------- *
+ * SPHinXsys (pronunciation: s'finksis) is an acronym from Smoothed Particle *
+ * Hydrodynamics for industrial compleX systems. It provides C++ APIs for    *
+ * physical accurate simulation and aims to model coupled industrial dynamic *
+ * systems including fluid, solid, multi-body dynamics and beyond with SPH   *
+ * (smoothed particle hydrodynamics), a meshless computational method using  *
+ * particle discretization.                                                  *
+ *                                                                           *
+ * SPHinXsys is partially funded by German Research Foundation               *
+ * (Deutsche Forschungsgemeinschaft) DFG HU1527/6-1, HU1527/10-1,            *
+ *  HU1527/12-1 and HU1527/12-4.                                             *
+ *                                                                           *
+ * Portions copyright (c) 2017-2023 Technical University of Munich and       *
+ * the authors' affiliations.                                                *
+ *                                                                           *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may   *
+ * not use this file except in compliance with the License. You may obtain a *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.        *
+ *                                                                           *
+ * ------------------------------------------------------------------------- */
+/**
+ * @file 	relax_stepping_ck.h
+ * @brief 	Particle relaxation with computing kernels.
+ * @details The level set of the body shape is probed by the flattened level set,
+ *          so that the relaxation can be carried out on host and device.
+ *          Only single resolution is considered currently.
+ * @author	Xiangyu Hu
+ */
+
+#ifndef RELAX_STEPPING_CK_H
+#define RELAX_STEPPING_CK_H
+
+#include "base_relax_dynamics.h"
+#include "interaction_ck.hpp"
+#include "level_set_shape.h"
+
+namespace SPH
+{
+namespace relax_dynamics
+{
+template <typename... InteractionTypes>
+class RelaxationResidueCK;
+
+template <template <typename...> class RelationType, typename... Parameters>
+class RelaxationResidueCK<Base, RelationType<Parameters...>>
+    : public Interaction<RelationType<Parameters...>>
+{
+  public:
+    template <class DynamicsIdentifier>
+    explicit RelaxationResidueCK(DynamicsIdentifier &identifier);
+    virtual ~RelaxationResidueCK(){};
+
+    class InteractKernel
+        : public Interaction<RelationType<Parameters...>>::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy, typename... Args>
+        InteractKernel(const ExecutionPolicy &ex_policy,
+                       RelaxationResidueCK<Base, RelationType<Parameters...>> &encloser,
+                       Args &&...args);
+
+      protected:
+        Real *Vol_;
+        Vecd *residue_;
+    };
+
+  protected:
+    DiscreteVariable<Real> *dv_Vol_;
+    DiscreteVariable<Vecd> *dv_residue_;
+};
+
+template <typename... Parameters>
+class RelaxationResidueCK<Inner<Parameters...>>
+    : public RelaxationResidueCK<Base, Inner<Parameters...>>
+{
+  public:
+    explicit RelaxationResidueCK(Relation<Inner<Parameters...>> &inner_relation);
+    virtual ~RelaxationResidueCK(){};
+
+    class InteractKernel
+        : public RelaxationResidueCK<Base, Inner<Parameters...>>::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        InteractKernel(const ExecutionPolicy &ex_policy,
+                       RelaxationResidueCK<Inner<Parameters...>> &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+    };
+};
+
+template <typename... Parameters>
+class RelaxationResidueCK<Inner<LevelSetCorrection, Parameters...>>
+    : public RelaxationResidueCK<Inner<Parameters...>>
+{
+  public:
+    explicit RelaxationResidueCK(Relation<Inner<Parameters...>> &inner_relation);
+    virtual ~RelaxationResidueCK(){};
+
+    class InteractKernel
+        : public RelaxationResidueCK<Inner<Parameters...>>::InteractKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        InteractKernel(const ExecutionPolicy &ex_policy,
+                       RelaxationResidueCK<Inner<LevelSetCorrection, Parameters...>> &encloser);
+        void interact(size_t index_i, Real dt = 0.0);
+
+      protected:
+        LevelSetCK::ProbeKernel level_set_probe_;
+    };
+
+  protected:
+    LevelSetCK &level_set_ck_;
+};
+
+/**
+ * @class RelaxationScalingCK
+ * @brief Obtain the scale for a particle relaxation step
+ */
+class RelaxationScalingCK : public LocalDynamicsReduce<ReduceMax>
+{
+  public:
+    explicit RelaxationScalingCK(SPHBody &sph_body);
+    virtual ~RelaxationScalingCK(){};
+    virtual Real outputResult(Real reduced_value) override;
+
+    class ReduceKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        ReduceKernel(const ExecutionPolicy &ex_policy, RelaxationScalingCK &encloser)
+            : residue_(encloser.dv_residue_->DelegatedDataField(ex_policy)){};
+
+        Real reduce(size_t index_i, Real dt = 0.0) { return residue_[index_i].norm(); };
+
+      protected:
+        Vecd *residue_;
+    };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_residue_;
+    Real h_ref_;
+};
+
+/**
+ * @class PositionRelaxationCK
+ * @brief update the particle position for a relaxation step
+ */
+class PositionRelaxationCK : public LocalDynamics
+{
+  public:
+    explicit PositionRelaxationCK(SPHBody &sph_body);
+    virtual ~PositionRelaxationCK(){};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        UpdateKernel(const ExecutionPolicy &ex_policy, PositionRelaxationCK &encloser)
+            : pos_(encloser.dv_pos_->DelegatedDataField(ex_policy)),
+              residue_(encloser.dv_residue_->DelegatedDataField(ex_policy)){};
+
+        void update(size_t index_i, Real dt_square)
+        {
+            pos_[index_i] += residue_[index_i] * dt_square * 0.5;
+        };
+
+      protected:
+        Vecd *pos_, *residue_;
+    };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_pos_, *dv_residue_;
+};
+
+/**
+ * @class ShapeSurfaceBoundingCK
+ * @brief constrain the particles near the surface of the level set shape of the body by
+ * mapping them to the surface, r = r - (phi + constrained_distance) * normal.
+ * Different from ShapeSurfaceBounding, all particles of the body are checked.
+ */
+class ShapeSurfaceBoundingCK : public LocalDynamics
+{
+  public:
+    explicit ShapeSurfaceBoundingCK(SPHBody &sph_body);
+    virtual ~ShapeSurfaceBoundingCK(){};
+
+    class UpdateKernel
+    {
+      public:
+        template <class ExecutionPolicy>
+        UpdateKernel(const ExecutionPolicy &ex_policy, ShapeSurfaceBoundingCK &encloser)
+            : pos_(encloser.dv_pos_->DelegatedDataField(ex_policy)),
+              level_set_probe_(ex_policy, encloser.level_set_ck_),
+              constrained_distance_(encloser.constrained_distance_){};
+
+        void update(size_t index_i, Real dt = 0.0)
+        {
+            Real phi = level_set_probe_.probeSignedDistance(pos_[index_i]);
+            if (phi > -constrained_distance_)
+            {
+                pos_[index_i] -= (phi + constrained_distance_) *
+                                 level_set_probe_.probeNormalDirection(pos_[index_i]);
+            }
+        };
+
+      protected:
+        Vecd *pos_;
+        LevelSetCK::ProbeKernel level_set_probe_;
+        Real constrained_distance_;
+    };
+
+  protected:
+    DiscreteVariable<Vecd> *dv_pos_;
+    LevelSetCK &level_set_ck_;
+    Real constrained_distance_;
+};
+} // namespace relax_dynamics
+} // namespace SPH
+#endif // RELAX_STEPPING_CK_H
@@ -0,0 +1,81 @@
+#ifndef RELAX_STEPPING_CK_HPP
+#define RELAX_STEPPING_CK_HPP
+
+#include "relax_stepping_ck.h"
+
+#include "level_set_ck.hpp"
+
+namespace SPH
+{
+namespace relax_dynamics
+{
+//=================================================================================================//
+template <template <typename...> class RelationType, typename... Parameters>
+template <class DynamicsIdentifier>
+RelaxationResidueCK<Base, RelationType<Parameters...>>::
+    RelaxationResidueCK(DynamicsIdentifier &identifier)
+    : Interaction<RelationType<Parameters...>>(identifier),
+      dv_Vol_(this->particles_->template getVariableByName<Real>("VolumetricMeasure")),
+      dv_residue_(this->particles_->template registerStateVariableOnly<Vecd>("ZeroOrderResidue")) {}
+//=================================================================================================//
+template <template <typename...> class RelationType, typename... Parameters>
+template <class ExecutionPolicy, typename... Args>
+RelaxationResidueCK<Base, RelationType<Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy,
+                   RelaxationResidueCK<Base, RelationType<Parameters...>> &encloser,
+                   Args &&...args)
+    : Interaction<RelationType<Parameters...>>::
+          InteractKernel(ex_policy, encloser, std::forward<Args>(args)...),
+      Vol_(encloser.dv_Vol_->DelegatedDataField(ex_policy)),
+      residue_(encloser.dv_residue_->DelegatedDataField(ex_policy)) {}
+//=================================================================================================//
+template <typename... Parameters>
+RelaxationResidueCK<Inner<Parameters...>>::
+    RelaxationResidueCK(Relation<Inner<Parameters...>> &inner_relation)
+    : RelaxationResidueCK<Base, Inner<Parameters...>>(inner_relation) {}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy>
+RelaxationResidueCK<Inner<Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy,
+                   RelaxationResidueCK<Inner<Parameters...>> &encloser)
+    : RelaxationResidueCK<Base, Inner<Parameters...>>::InteractKernel(ex_policy, encloser) {}
+//=================================================================================================//
+template <typename... Parameters>
+void RelaxationResidueCK<Inner<Parameters...>>::InteractKernel::interact(size_t index_i, Real dt)
+{
+    Vecd residue = Vecd::Zero();
+    this->forEachNeighbor(
+        index_i, this->source_pos_,
+        [&](UnsignedInt index_j)
+        {
+            residue -= 2.0 * this->dW_ij(index_i, index_j) * this->Vol_[index_j] * this->e_ij(index_i, index_j);
+        });
+    this->residue_[index_i] = residue;
+}
+//=================================================================================================//
+template <typename... Parameters>
+RelaxationResidueCK<Inner<LevelSetCorrection, Parameters...>>::
+    RelaxationResidueCK(Relation<Inner<Parameters...>> &inner_relation)
+    : RelaxationResidueCK<Inner<Parameters...>>(inner_relation),
+      level_set_ck_(DynamicCast<LevelSetShape>(this, this->sph_body_.getInitialShape()).getLevelSetCK()) {}
+//=================================================================================================//
+template <typename... Parameters>
+template <class ExecutionPolicy>
+RelaxationResidueCK<Inner<LevelSetCorrection, Parameters...>>::InteractKernel::
+    InteractKernel(const ExecutionPolicy &ex_policy,
+                   RelaxationResidueCK<Inner<LevelSetCorrection, Parameters...>> &encloser)
+    : RelaxationResidueCK<Inner<Parameters...>>::InteractKernel(ex_policy, encloser),
+      level_set_probe_(ex_policy, encloser.level_set_ck_) {}
+//=================================================================================================//
+template <typename... Parameters>
+void RelaxationResidueCK<Inner<LevelSetCorrection, Parameters...>>::
+    InteractKernel::interact(size_t index_i, Real dt)
+{
+    RelaxationResidueCK<Inner<Parameters...>>::InteractKernel::interact(index_i, dt);
+    this->residue_[index_i] -= 2.0 * level_set_probe_.probeKernelGradientIntegral(this->source_pos_[index_i]);
+}
+//=================================================================================================//
+} // namespace relax_dynamics
+} // namespace SPH
+#endif // RELAX_STEPPING_CK_HPP
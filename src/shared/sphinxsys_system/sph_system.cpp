@@ -12,7 +12,8 @@ SPHSystem::SPHSystem(BoundingBox system_domain_bounds, Real resolution_ref, size
       resolution_ref_(resolution_ref),
       tbb_global_control_(tbb::global_control::max_allowed_parallelism, number_of_threads),
       io_environment_(nullptr), run_particle_relaxation_(false), reload_particles_(false),
-      restart_step_(0), generate_regression_data_(false), state_recording_(true)
+      restart_step_(0), generate_regression_data_(false), state_recording_(true),
+      binary_recording_(false)
 {
     registerSystemVariable<Real>("PhysicalTime", 0.0);
 }
@@ -73,6 +74,7 @@ SPHSystem *SPHSystem::handleCommandlineOptions(int ac, char *av[])
         desc.add_options()("reload", po::value<bool>(), "Particle reload from input file.");
         desc.add_options()("regression", po::value<bool>(), "Regression test.");
         desc.add_options()("state_recording", po::value<bool>(), "State recording in output folder.");
+        desc.add_options()("binary_recording", po::value<bool>(), "Binary columnar recording of observations.");
         desc.add_options()("restart_step", po::value<int>(), "Run form a restart file.");
 
         po::variables_map vm;
@@ -133,6 +135,18 @@ SPHSystem *SPHSystem::handleCommandlineOptions(int ac, char *av[])
                       << state_recording_ << ").\n";
         }
 
+        if (vm.count("binary_recording"))
+        {
+            binary_recording_ = vm["binary_recording"].as<bool>();
+            std::cout << "Binary recording was set to "
+                      << vm["binary_recording"].as<bool>() << ".\n";
+        }
+        else
+        {
+            std::cout << "Binary recording was set to default ("
+                      << binary_recording_ << ").\n";
+        }
+
         if (vm.count("restart_step"))
         {
             restart_step_ = vm["restart_step"].as<int>();
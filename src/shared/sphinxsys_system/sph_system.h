@@ -88,6 +88,8 @@ class SPHSystem
     void setGenerateRegressionData(bool generate_regression_data) { generate_regression_data_ = generate_regression_data; };
     bool StateRecording() { return state_recording_; };
     void setStateRecording(bool state_recording) { state_recording_ = state_recording; };
+    bool BinaryRecording() { return binary_recording_; };
+    void setBinaryRecording(bool binary_recording) { binary_recording_ = binary_recording; };
     void setRestartStep(size_t restart_step) { restart_step_ = restart_step; };
     size_t RestartStep() { return restart_step_; };
     /** Initialize cell linked list for the SPH system. */
@@ -118,6 +120,7 @@ class SPHSystem
     size_t restart_step_;           /**< restart step */
     bool generate_regression_data_; /**< run and generate or enhance the regression test data set. */
     bool state_recording_;          /**< Record state in output folder. */
+    bool binary_recording_;         /**< Record observed and reduced quantities in binary columnar files. */
     SingularVariables all_system_variables_;
 };
 } // namespace SPH
@@ -14,7 +14,7 @@ DeviceSharedSingularVariable<DataType>::
       device_shared_value_(allocateDeviceShared<DataType>(1))
 {
     *device_shared_value_ = *host_variable->ValueAddress();
-    host_variable->setDelegateValueAddress(device_shared_value_);
+    host_variable->setDelegateValueAddress(device_shared_value_, &synchronizeWithDevice);
 }
 //=================================================================================================//
 template <typename DataType>
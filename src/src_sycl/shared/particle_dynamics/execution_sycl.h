@@ -34,7 +34,9 @@
 #include "execution_policy.h"
 
 #include "ownership.h"
+#include <map>
 #include <sycl/sycl.hpp>
+#include <typeindex>
 
 namespace SPH
 {
@@ -52,13 +54,79 @@ class ExecutionInstance
         return instance;
     }
 
+    /** The queue is in-order, so that the kernels are chained without host synchronization. */
     sycl::queue &getQueue()
     {
         if (!sycl_queue_)
-            sycl_queue_ = makeUnique<sycl::queue>(sycl::default_selector_v);
+            sycl_queue_ = makeUnique<sycl::queue>(sycl::default_selector_v, sycl::property::queue::in_order());
         return *sycl_queue_;
     }
 
+    /** Submit a kernel without waiting for its completion. */
+    template <class CommandGroup>
+    sycl::event submit(CommandGroup &&command_group)
+    {
+        number_of_kernel_launches_++;
+        return getQueue().submit(std::forward<CommandGroup>(command_group));
+    }
+
+    /** Explicit sync point, at which all submitted kernels are completed. */
+    void synchronize()
+    {
+        getQueue().wait_and_throw();
+    }
+
+    size_t NumberOfKernelLaunches() const
+    {
+        return number_of_kernel_launches_;
+    }
+
+    /** Explicit shutdown point, at which the persistent reduction results and scratches are freed.
+     *  This is not left to the destructor of the static instance,
+     *  as the SYCL runtime may have been torn down by then. */
+    void releaseDeviceResources()
+    {
+        if (!sycl_queue_)
+            return;
+
+        synchronize();
+        for (auto &type_and_result : reduction_results_)
+            sycl::free(type_and_result.second, *sycl_queue_);
+        reduction_results_.clear();
+        for (auto &type_and_scratch : scratches_)
+            sycl::free(type_and_scratch.second.data_, *sycl_queue_);
+        scratches_.clear();
+    }
+
+    /** Persistent result slot of the device reductions with the given type, freed by releaseDeviceResources(). */
+    template <class T>
+    T *getReductionResult()
+    {
+        void *&result = reduction_results_[std::type_index(typeid(T))];
+        if (result == nullptr)
+            result = sycl::malloc_shared<T>(1, getQueue());
+        return static_cast<T *>(result);
+    }
+
+    /** Persistent device scratch with the given type, grown to at least the given size on demand. */
+    template <class T>
+    T *getScratch(size_t size)
+    {
+        Scratch &scratch = scratches_[std::type_index(typeid(T))];
+        if (scratch.size_ < size)
+        {
+            if (scratch.data_ != nullptr)
+            {
+                // the kernels in flight may still use the scratch
+                synchronize();
+                sycl::free(scratch.data_, getQueue());
+            }
+            scratch.data_ = sycl::malloc_device<T>(size, getQueue());
+            scratch.size_ = size;
+        }
+        return static_cast<T *>(scratch.data_);
+    }
+
     auto getWorkGroupSize() const
     {
         return work_group_size_;
@@ -81,10 +149,18 @@ class ExecutionInstance
     }
 
   private:
-    ExecutionInstance() : work_group_size_(128), sycl_queue_() {}
+    ExecutionInstance() : work_group_size_(128), number_of_kernel_launches_(0), sycl_queue_() {}
 
     size_t work_group_size_;
+    size_t number_of_kernel_launches_;
     UniquePtr<sycl::queue> sycl_queue_;
+    std::map<std::type_index, void *> reduction_results_;
+    struct Scratch
+    {
+        void *data_ = nullptr;
+        size_t size_ = 0;
+    };
+    std::map<std::type_index, Scratch> scratches_;
 
 } static &execution_instance = ExecutionInstance::getInstance();
 
@@ -106,9 +182,29 @@ inline T *allocateDeviceShared(std::size_t size)
 template <class T>
 inline void freeDeviceData(T *device_mem)
 {
+    // the memory may still be used by the kernels in flight
+    execution::execution_instance.synchronize();
     sycl::free(device_mem, execution::execution_instance.getQueue());
 }
 
+inline void synchronizeWithDevice()
+{
+    execution::execution_instance.synchronize();
+}
+
+/** To be called before the end of the program, after the last device computation. */
+inline void releaseDeviceResources()
+{
+    execution::execution_instance.releaseDeviceResources();
+}
+
+/** Persistent result slot of the device reductions with the given type. */
+template <class T>
+inline T *deviceReductionResult()
+{
+    return execution::execution_instance.getReductionResult<T>();
+}
+
 template <class T>
 inline void copyToDevice(const T *host, T *device, std::size_t size)
 {
@@ -34,59 +34,124 @@
 
 namespace SPH
 {
+/**
+ * The device particle iterators submit the kernels to the in-order queue without waiting.
+ * The host is synchronized only when a value is needed, i.e. for reductions, scans and data transfers,
+ * and when a device-shared singular variable is accessed from the host.
+ */
 template <class LocalDynamicsFunction>
 inline void particle_for(const ParallelDevicePolicy &par_device,
                          const IndexRange &particles_range, const LocalDynamicsFunction &local_dynamics_function)
 {
-    auto &sycl_queue = execution_instance.getQueue();
     const size_t particles_size = particles_range.size();
-    sycl_queue.submit([&](sycl::handler &cgh)
-                      { cgh.parallel_for(execution_instance.getUniformNdRange(particles_size), [=](sycl::nd_item<1> index)
-                                         {
+    execution_instance.submit([&](sycl::handler &cgh)
+                              { cgh.parallel_for(execution_instance.getUniformNdRange(particles_size), [=](sycl::nd_item<1> index)
+                                                 {
                                  if(index.get_global_id(0) < particles_size)
-                                     local_dynamics_function(index.get_global_id(0)); }); })
-        .wait_and_throw();
+                                     local_dynamics_function(index.get_global_id(0)); }); });
 }
 
+/**
+ * The device reduction is a sync point, as it waits for its result.
+ * It is not deferred to a future, as ReduceDynamics::exec returns the value,
+ * e.g. a time step size, which the host needs at once as a parameter of the next kernels.
+ * Returning a future would only move the wait to the caller.
+ */
 template <class ReturnType, typename Operation, class LocalDynamicsFunction>
 inline ReturnType particle_reduce(const ParallelDevicePolicy &par_device,
                                   const IndexRange &particles_range, ReturnType temp, Operation &&operation,
                                   const LocalDynamicsFunction &local_dynamics_function)
 {
-    auto &sycl_queue = execution_instance.getQueue();
     const size_t particles_size = particles_range.size();
+    ReturnType *result = deviceReductionResult<ReturnType>();
+    *result = temp; // the previous reduction of this type has been read back already
+    execution_instance.submit([&](sycl::handler &cgh)
+                              {
+                                  auto reduction_operator = sycl::reduction(result, operation);
+                                  cgh.parallel_for(execution_instance.getUniformNdRange(particles_size), reduction_operator,
+                                                   [=](sycl::nd_item<1> item, auto& reduction) {
+                                                       if(item.get_global_id() < particles_size)
+                                                           reduction.combine(local_dynamics_function(item.get_global_id(0)));
+                                                   }); })
+        .wait_and_throw();
+    return *result;
+}
+
+/** Size of the scratch for the tile sums and offsets of all the recursion levels of the device scan. */
+inline size_t exclusive_scan_scratch_size(size_t d_size, size_t work_group_size)
+{
+    const size_t number_of_tiles = (d_size + work_group_size - 1) / work_group_size;
+    return number_of_tiles <= 1 ? 0 : 2 * number_of_tiles + exclusive_scan_scratch_size(number_of_tiles, work_group_size);
+}
+
+/**
+ * Device-wide exclusive scan by reduce-then-scan over tiles of one work-group size.
+ * The tile sums are scanned recursively, so that the scan is not limited to a single work-group.
+ * Each recursion level takes its tile sums and offsets from the front of the given scratch.
+ */
+template <typename T, typename Op>
+void exclusive_scan_by_tiles(T *first, T *d_first, size_t d_size, Op op, T *scratch)
+{
+    const size_t work_group_size = execution_instance.getWorkGroupSize();
+    const size_t number_of_tiles = (d_size + work_group_size - 1) / work_group_size;
+
+    if (number_of_tiles <= 1)
+    {
+        execution_instance.submit([=](sycl::handler &cgh)
+                                  { cgh.parallel_for(
+                                        execution_instance.getUniformNdRange(work_group_size),
+                                        [=](sycl::nd_item<1> item)
+                                        {
+                                            sycl::joint_exclusive_scan(
+                                                item.get_group(), first, first + d_size, d_first, T{0}, op);
+                                        }); });
+    }
+    else
     {
-        sycl::buffer<ReturnType> buffer_result(&temp, 1);
-        sycl_queue.submit([&](sycl::handler &cgh)
-                          {
-                              auto reduction_operator = sycl::reduction(buffer_result, cgh, operation);
-                              cgh.parallel_for(execution_instance.getUniformNdRange(particles_size), reduction_operator,
-                                               [=](sycl::nd_item<1> item, auto& reduction) {
-                                                   if(item.get_global_id() < particles_size)
-                                                       reduction.combine(local_dynamics_function(item.get_global_id(0)));
-                                               }); })
-            .wait_and_throw();
-    } // buffer_result goes out of scope, so the result (of temp) is updated
-    return temp;
+        T *tile_sums = scratch;
+        T *tile_offsets = scratch + number_of_tiles;
+        execution_instance.submit([=](sycl::handler &cgh)
+                                  { cgh.parallel_for(
+                                        execution_instance.getUniformNdRange(d_size),
+                                        [=](sycl::nd_item<1> item)
+                                        {
+                                            size_t index = item.get_global_id(0);
+                                            T value = index < d_size ? first[index] : T{0};
+                                            T tile_sum = sycl::reduce_over_group(item.get_group(), value, op);
+                                            if (item.get_local_id(0) == 0)
+                                                tile_sums[item.get_group_linear_id()] = tile_sum;
+                                        }); });
+
+        exclusive_scan_by_tiles(tile_sums, tile_offsets, number_of_tiles, op, scratch + 2 * number_of_tiles);
+
+        execution_instance.submit([=](sycl::handler &cgh)
+                                  { cgh.parallel_for(
+                                        execution_instance.getUniformNdRange(d_size),
+                                        [=](sycl::nd_item<1> item)
+                                        {
+                                            size_t index = item.get_global_id(0);
+                                            T value = index < d_size ? first[index] : T{0};
+                                            T scanned = sycl::exclusive_scan_over_group(
+                                                item.get_group(), value, tile_offsets[item.get_group_linear_id()], op);
+                                            if (index < d_size)
+                                                d_first[index] = scanned;
+                                        }); });
+    }
 }
 
+/**
+ * Device-wide exclusive scan. The input and output may be the same array.
+ * The operation should be a SYCL function object.
+ * The scratch of the tiles is kept by the execution instance, so that it is not allocated on every call.
+ */
 template <typename T, typename Op>
 T exclusive_scan(const ParallelDevicePolicy &par_policy, T *first, T *d_first, UnsignedInt d_size, Op op)
 {
-    execution_instance.getQueue()
-        .submit([=](sycl::handler &cgh)
-                { cgh.parallel_for(
-                      execution_instance.getUniformNdRange(execution_instance.getWorkGroupSize()),
-                      [=](sycl::nd_item<1> item)
-                      {
-                          if (item.get_group_linear_id() == 0)
-                          {
-                              sycl::joint_exclusive_scan(
-                                  item.get_group(), first, first + d_size, d_first, T{0}, op);
-                          }
-                      }); })
-        .wait_and_throw();
+    T *scratch = execution_instance.getScratch<T>(
+        exclusive_scan_scratch_size(d_size, execution_instance.getWorkGroupSize()));
+    exclusive_scan_by_tiles(first, d_first, d_size, op, scratch);
 
+    // the copy is the sync point of the scan
     UnsignedInt scan_size = d_size - 1;
     T last_value;
     copyFromDevice(&last_value, d_first + scan_size, 1);
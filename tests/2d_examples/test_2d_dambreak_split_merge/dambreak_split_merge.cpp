@@ -0,0 +1,245 @@
+/**
+ * @file dambreak_split_merge.cpp
+ * @brief 2D dambreak example with runtime particle splitting and merging.
+ * @details The particles near the free surface are split to the finest resolution
+ * and merged back to the reference resolution when they are away from the surface.
+ * @author Xiangyu Hu
+ */
+#include "sphinxsys.h" //SPHinXsys Library.
+using namespace SPH;   // Namespace cite here.
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 5.366;                    /**< Water tank length. */
+Real DH = 5.366;                    /**< Water tank height. */
+Real LL = 2.0;                      /**< Water column length. */
+Real LH = 1.0;                      /**< Water column height. */
+Real particle_spacing_ref = 0.05;   /**< Initial reference particle spacing. */
+Real BW = particle_spacing_ref * 4; /**< Thickness of tank wall. */
+//----------------------------------------------------------------------
+//	Material parameters.
+//----------------------------------------------------------------------
+Real rho0_f = 1.0;                       /**< Reference density of fluid. */
+Real gravity_g = 1.0;                    /**< Gravity. */
+Real U_ref = 2.0 * sqrt(gravity_g * LH); /**< Characteristic velocity. */
+Real c_f = 10.0 * U_ref;                 /**< Reference sound speed. */
+//----------------------------------------------------------------------
+//	Geometric shapes used in this case.
+//----------------------------------------------------------------------
+Vec2d water_block_halfsize = Vec2d(0.5 * LL, 0.5 * LH); // local center at origin
+Vec2d water_block_translation = water_block_halfsize;   // translation to global coordinates
+Vec2d outer_wall_halfsize = Vec2d(0.5 * DL + BW, 0.5 * DH + BW);
+Vec2d outer_wall_translation = Vec2d(-BW, -BW) + outer_wall_halfsize;
+Vec2d inner_wall_halfsize = Vec2d(0.5 * DL, 0.5 * DH);
+Vec2d inner_wall_translation = inner_wall_halfsize;
+//----------------------------------------------------------------------
+//	Complex shape for wall boundary, note that no partial overlap is allowed
+//	for the shapes in a complex shape.
+//----------------------------------------------------------------------
+class WallBoundary : public ComplexShape
+{
+  public:
+    explicit WallBoundary(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        add<TransformShape<GeometricShapeBox>>(Transform(outer_wall_translation), outer_wall_halfsize);
+        subtract<TransformShape<GeometricShapeBox>>(Transform(inner_wall_translation), inner_wall_halfsize);
+    }
+};
+//----------------------------------------------------------------------
+//	Main program starts here.
+//----------------------------------------------------------------------
+int main(int ac, char *av[])
+{
+    //----------------------------------------------------------------------
+    //	Build up an SPHSystem and IO environment.
+    //----------------------------------------------------------------------
+    BoundingBox system_domain_bounds(Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing_ref);
+    sph_system.handleCommandlineOptions(ac, av)->setIOEnvironment();
+    //----------------------------------------------------------------------
+    //	Creating bodies with corresponding materials and particles.
+    //----------------------------------------------------------------------
+    TransformShape<GeometricShapeBox> initial_water_block(Transform(water_block_translation), water_block_halfsize, "WaterBody");
+    FluidBody water_block(sph_system, initial_water_block);
+    water_block.defineAdaptation<ParticleWithLocalRefinement>(1.3, 1.0, 1);
+    water_block.defineMaterial<WeaklyCompressibleFluid>(rho0_f, c_f);
+    ParticleBuffer<ReserveSizeFactor> split_particle_buffer(4.0);
+    water_block.generateParticlesWithReserve<BaseParticles, Lattice>(split_particle_buffer);
+
+    SolidBody wall_boundary(sph_system, makeShared<WallBoundary>("WallBoundary"));
+    wall_boundary.defineMaterial<Solid>();
+    wall_boundary.generateParticles<BaseParticles, Lattice>();
+
+    ObserverBody fluid_observer(sph_system, "FluidObserver");
+    StdVec<Vecd> observation_location = {Vecd(DL, 0.2)};
+    fluid_observer.generateParticles<ObserverParticles>(observation_location);
+    //----------------------------------------------------------------------
+    //	Define body relation map.
+    //	The contact map gives the topological connections between the bodies.
+    //	Basically the the range of bodies to build neighbor particle lists.
+    //  Generally, we first define all the inner relations, then the contact relations.
+    //----------------------------------------------------------------------
+    AdaptiveInnerRelation water_block_inner(water_block);
+    AdaptiveContactRelation water_wall_contact(water_block, {&wall_boundary});
+    AdaptiveContactRelation fluid_observer_contact(fluid_observer, {&water_block});
+    //----------------------------------------------------------------------
+    // Combined relations built from basic relations
+    // which is only used for update configuration.
+    //----------------------------------------------------------------------
+    ComplexRelation water_wall_complex(water_block_inner, water_wall_contact);
+    //----------------------------------------------------------------------
+    // Define the numerical methods used in the simulation.
+    // Note that there may be data dependence on the sequence of constructions.
+    //----------------------------------------------------------------------
+    Gravity gravity(Vecd(0.0, -gravity_g));
+    SimpleDynamics<GravityForce<Gravity>> constant_gravity(water_block, gravity);
+    SimpleDynamics<NormalDirectionFromBodyShape> wall_boundary_normal_direction(wall_boundary);
+
+    Dynamics1Level<fluid_dynamics::Integration1stHalfWithWallRiemann> fluid_pressure_relaxation(water_block_inner, water_wall_contact);
+    Dynamics1Level<fluid_dynamics::Integration2ndHalfWithWallRiemann> fluid_density_relaxation(water_block_inner, water_wall_contact);
+    InteractionWithUpdate<fluid_dynamics::DensitySummationFreeSurfaceComplexAdaptive> fluid_density_by_summation(water_block_inner, water_wall_contact);
+
+    ReduceDynamics<fluid_dynamics::AdvectionViscousTimeStep> fluid_advection_time_step(water_block, U_ref);
+    ReduceDynamics<fluid_dynamics::AcousticTimeStep> fluid_acoustic_time_step(water_block);
+    //----------------------------------------------------------------------
+    //	Define the adaptation related particles dynamics.
+    //----------------------------------------------------------------------
+    InteractionWithUpdate<SpatialTemporalFreeSurfaceIndicationComplex> free_surface_indicator(water_block_inner, water_wall_contact);
+    SimpleDynamics<TargetSmoothingLengthRatioByIndicator> target_resolution_by_free_surface(water_block);
+    ParticleSplitAndMerge<ParallelPolicy> particle_split_merge(water_block_inner, split_particle_buffer);
+    ReduceDynamics<QuantitySummation<Real>> total_mass(water_block, "Mass");
+    //----------------------------------------------------------------------
+    //	Define the configuration related particles dynamics.
+    //----------------------------------------------------------------------
+    ParticleSorting particle_sorting(water_block);
+    //----------------------------------------------------------------------
+    //	Define the methods for I/O operations and observations of the simulation.
+    //----------------------------------------------------------------------
+    BodyStatesRecordingToVtp body_states_recording(sph_system);
+    body_states_recording.addToWrite<Vecd>(wall_boundary, "NormalDirection");
+    body_states_recording.addToWrite<Real>(water_block, "SmoothingLengthRatio");
+    ObservedQuantityRecording<Real> write_recorded_water_pressure("Pressure", fluid_observer_contact);
+    //----------------------------------------------------------------------
+    //	Prepare the simulation with cell linked list, configuration
+    //	and case specified initial condition if necessary.
+    //----------------------------------------------------------------------
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    wall_boundary_normal_direction.exec();
+    constant_gravity.exec();
+    Real initial_total_mass = total_mass.exec();
+    //----------------------------------------------------------------------
+    //	Setup for time-stepping control
+    //----------------------------------------------------------------------
+    Real &physical_time = *sph_system.getSystemVariableDataByName<Real>("PhysicalTime");
+    size_t number_of_iterations = 0;
+    int screen_output_interval = 100;
+    int observation_sample_interval = screen_output_interval * 2;
+    int adaptation_interval = 20;
+    Real end_time = 5.0;
+    Real output_interval = 0.1;
+    //----------------------------------------------------------------------
+    //	Statistics for CPU time
+    //----------------------------------------------------------------------
+    TickCount t1 = TickCount::now();
+    TimeInterval interval;
+    TimeInterval interval_updating_configuration;
+    TimeInterval interval_particle_split_merge;
+    TickCount time_instance;
+    //----------------------------------------------------------------------
+    //	First output before the main loop.
+    //----------------------------------------------------------------------
+    body_states_recording.writeToFile();
+    write_recorded_water_pressure.writeToFile(number_of_iterations);
+    //----------------------------------------------------------------------
+    //	Main loop starts here.
+    //----------------------------------------------------------------------
+    while (physical_time < end_time)
+    {
+        Real integration_time = 0.0;
+        /** Integrate time (loop) until the next output time. */
+        while (integration_time < output_interval)
+        {
+            /** outer loop for dual-time criteria time-stepping. */
+            Real advection_dt = fluid_advection_time_step.exec();
+            fluid_density_by_summation.exec();
+
+            Real relaxation_time = 0.0;
+            Real acoustic_dt = 0.0;
+            while (relaxation_time < advection_dt)
+            {
+                /** inner loop for dual-time criteria time-stepping.  */
+                acoustic_dt = fluid_acoustic_time_step.exec();
+                fluid_pressure_relaxation.exec(acoustic_dt);
+                fluid_density_relaxation.exec(acoustic_dt);
+                relaxation_time += acoustic_dt;
+                integration_time += acoustic_dt;
+                physical_time += acoustic_dt;
+            }
+
+            /** screen output and write body observables */
+            if (number_of_iterations % screen_output_interval == 0)
+            {
+                std::cout << std::fixed << std::setprecision(9) << "N=" << number_of_iterations << "	Time = "
+                          << physical_time
+                          << "	advection_dt = " << advection_dt << "	acoustic_dt = " << acoustic_dt
+                          << "	particles = " << water_block.getBaseParticles().TotalRealParticles() << "\n";
+
+                if (number_of_iterations % observation_sample_interval == 0)
+                {
+                    write_recorded_water_pressure.writeToFile(number_of_iterations);
+                }
+            }
+            number_of_iterations++;
+
+            /** Update cell linked list and configuration. */
+            time_instance = TickCount::now();
+            if (number_of_iterations % 100 == 0 && number_of_iterations != 1)
+            {
+                particle_sorting.exec();
+            }
+            water_block.updateCellLinkedList();
+            water_wall_complex.updateConfiguration();
+            fluid_observer_contact.updateConfiguration();
+            interval_updating_configuration += TickCount::now() - time_instance;
+
+            /** Split and merge particles by the free surface and update the configuration again. */
+            if (number_of_iterations % adaptation_interval == 0)
+            {
+                time_instance = TickCount::now();
+                free_surface_indicator.exec();
+                target_resolution_by_free_surface.exec();
+                particle_split_merge.exec();
+                water_block.updateCellLinkedList();
+                water_wall_complex.updateConfiguration();
+                fluid_observer_contact.updateConfiguration();
+                interval_particle_split_merge += TickCount::now() - time_instance;
+            }
+        }
+
+        TickCount t2 = TickCount::now();
+        body_states_recording.writeToFile();
+        TickCount t3 = TickCount::now();
+        interval += t3 - t2;
+    }
+    TickCount t4 = TickCount::now();
+
+    TimeInterval tt;
+    tt = t4 - t1 - interval;
+    std::cout << "Total wall time for computation: " << tt.seconds()
+              << " seconds." << std::endl;
+    std::cout << std::fixed << std::setprecision(9) << "interval_updating_configuration = "
+              << interval_updating_configuration.seconds() << "\n";
+    std::cout << std::fixed << std::setprecision(9) << "interval_particle_split_merge = "
+              << interval_particle_split_merge.seconds() << "\n";
+
+    Real mass_error = ABS(total_mass.exec() - initial_total_mass) / initial_total_mass;
+    std::cout << "Relative error of the total mass: " << mass_error << std::endl;
+    if (mass_error > 1.0e-10)
+    {
+        std::cout << "\n Error: the total mass is not conserved by particle splitting and merging!" << std::endl;
+        return 1;
+    }
+
+    return 0;
+};
@@ -165,8 +165,9 @@ class RobinBoundaryDefinition : public LocalDynamics
     Real &phi_infinity_;
 };
 
+// the configuration is fixed, so that the diffusion operator is assembled once at the first step
 using DiffusionBodyRelaxation = DiffusionBodyRelaxationComplex<
-    BaseDiffusion, KernelGradientInner, KernelGradientContact, Dirichlet, Robin>;
+    BaseDiffusion, Assembled<KernelGradientInner>, Assembled<KernelGradientContact>, Dirichlet, Robin>;
 
 StdVec<Vecd> createObservationPoints()
 {
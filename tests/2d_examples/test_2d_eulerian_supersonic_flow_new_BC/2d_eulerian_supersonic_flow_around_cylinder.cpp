@@ -40,6 +40,7 @@ int main(int ac, char *av[])
     //	Note that the same relation should be defined only once.
     //----------------------------------------------------------------------
     InnerRelation fluid_block_inner(fluid_block);
+    StaticInnerNeighborhood fluid_block_static_inner(fluid_block_inner);
     //----------------------------------------------------------------------
     //	Run particle relaxation for body-fitted distribution if chosen.
     //----------------------------------------------------------------------
@@ -82,8 +83,10 @@ int main(int ac, char *av[])
     //	Note that there may be data dependence on the constructors of these methods.
     //----------------------------------------------------------------------
     InteractionWithUpdate<FreeSurfaceIndication<Inner<>>> surface_indicator(fluid_block_inner);
-    InteractionWithUpdate<fluid_dynamics::EulerianCompressibleIntegration1stHalfHLLCWithLimiterRiemann> pressure_relaxation(fluid_block_inner);
-    InteractionWithUpdate<fluid_dynamics::EulerianCompressibleIntegration2ndHalfHLLCWithLimiterRiemann> density_and_energy_relaxation(fluid_block_inner);
+    EdgeSweepWithUpdate<fluid_dynamics::EulerianCompressibleIntegration1stHalfHLLCWithLimiterRiemann>
+        pressure_relaxation(fluid_block_static_inner, fluid_block_inner);
+    EdgeSweepWithUpdate<fluid_dynamics::EulerianCompressibleIntegration2ndHalfHLLCWithLimiterRiemann>
+        density_and_energy_relaxation(fluid_block_static_inner, fluid_block_inner);
     SimpleDynamics<SupersonicFlowInitialCondition> initial_condition(fluid_block);
     ReduceDynamics<fluid_dynamics::EulerianCompressibleAcousticTimeStepSize> get_fluid_time_step_size(fluid_block, 0.1);
     InteractionWithUpdate<LinearGradientCorrectionMatrixInner> kernel_correction_matrix(fluid_block_inner);
@@ -108,6 +111,7 @@ int main(int ac, char *av[])
     kernel_correction_matrix.exec();
     kernel_gradient_update.exec();
     ghost_kernel_gradient_update.exec();
+    fluid_block_static_inner.build();
     //----------------------------------------------------------------------
     //	Define the methods for I/O operations and observations of the simulation.
     //----------------------------------------------------------------------
@@ -95,12 +95,15 @@ int main(int ac, char *av[])
     //  inner and contact relations.
     //----------------------------------------------------------------------
     InnerRelation water_body_inner(water_body);
+    StaticInnerNeighborhood water_body_static_inner(water_body_inner);
     //----------------------------------------------------------------------
     //	Define the main numerical methods used in the simulation.
     //	Note that there may be data dependence on the constructors of these methods.
     //----------------------------------------------------------------------
-    InteractionWithUpdate<fluid_dynamics::EulerianCompressibleIntegration1stHalfHLLCWithLimiterRiemann> pressure_relaxation(water_body_inner);
-    InteractionWithUpdate<fluid_dynamics::EulerianCompressibleIntegration2ndHalfHLLCWithLimiterRiemann> density_and_energy_relaxation(water_body_inner);
+    EdgeSweepWithUpdate<fluid_dynamics::EulerianCompressibleIntegration1stHalfHLLCWithLimiterRiemann>
+        pressure_relaxation(water_body_static_inner, water_body_inner);
+    EdgeSweepWithUpdate<fluid_dynamics::EulerianCompressibleIntegration2ndHalfHLLCWithLimiterRiemann>
+        density_and_energy_relaxation(water_body_static_inner, water_body_inner);
 
     SimpleDynamics<TaylorGreenInitialCondition> initial_condition(water_body);
     PeriodicAlongAxis periodic_along_x(water_body.getSPHBodyBounds(), xAxis);
@@ -128,6 +131,7 @@ int main(int ac, char *av[])
     initial_condition.exec();
     kernel_correction_matrix.exec();
     kernel_gradient_update.exec();
+    water_body_static_inner.build();
     //----------------------------------------------------------------------
     //	Setup for time-stepping control
     //----------------------------------------------------------------------
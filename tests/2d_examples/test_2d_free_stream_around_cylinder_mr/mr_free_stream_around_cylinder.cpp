@@ -121,6 +121,9 @@ int main(int ac, char *av[])
 
     Dynamics1Level<fluid_dynamics::Integration1stHalfWithWallRiemann> pressure_relaxation(water_block_inner, water_contact);
     Dynamics1Level<fluid_dynamics::Integration2ndHalfWithWallNoRiemann> density_relaxation(water_block_inner, water_contact);
+    /** Neighbor counts vary strongly across the refinement levels, the loops are split by neighbor counts. */
+    pressure_relaxation.enableWorkWeighting();
+    density_relaxation.enableWorkWeighting();
     InteractionWithUpdate<fluid_dynamics::DensitySummationFreeStreamComplexAdaptive> update_fluid_density(water_block_inner, water_contact);
 
     BodyAlignedBoxByParticle emitter(water_block, makeShared<AlignedBoxShape>(xAxis, Transform(Vec2d(emitter_translation)), emitter_halfsize));
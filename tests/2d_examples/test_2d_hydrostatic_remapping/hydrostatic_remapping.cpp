@@ -0,0 +1,187 @@
+/**
+ * @file hydrostatic_remapping.cpp
+ * @brief 2D hydrostatic tank restarted from a coarser resolution.
+ * @details The tank is first spun up at a coarse resolution and the restart files are written.
+ * The case is then restarted at twice the resolution by remapping the restart files,
+ * and the water should stay at rest.
+ * @author Xiangyu Hu
+ */
+#include "sphinxsys.h" //SPHinXsys Library.
+using namespace SPH;   // Namespace cite here.
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real DL = 2.0;                         /**< Tank length. */
+Real DH = 1.5;                         /**< Tank height. */
+Real LL = 2.0;                         /**< Water length. */
+Real LH = 1.0;                         /**< Water height. */
+Real coarse_particle_spacing = 0.05;   /**< Particle spacing of the spin-up run. */
+Real remapping_ratio = 2.0;            /**< Ratio between the coarse and fine particle spacing. */
+Real BW = coarse_particle_spacing * 4; /**< Thickness of tank wall. */
+size_t spin_up_restart_step = 1;       /**< Step index of the restart files written by the spin-up run. */
+//----------------------------------------------------------------------
+//	Material parameters.
+//----------------------------------------------------------------------
+Real rho0_f = 1.0;                       /**< Reference density of fluid. */
+Real gravity_g = 1.0;                    /**< Gravity. */
+Real U_ref = 2.0 * sqrt(gravity_g * LH); /**< Characteristic velocity. */
+Real c_f = 10.0 * U_ref;                 /**< Reference sound speed. */
+Real mu_f = 0.05 * rho0_f * U_ref * LH;  /**< Viscosity damping the sloshing of the spin-up. */
+//----------------------------------------------------------------------
+//	Geometric shapes used in this case.
+//----------------------------------------------------------------------
+Vec2d water_block_halfsize = Vec2d(0.5 * LL, 0.5 * LH); // local center at origin
+Vec2d water_block_translation = water_block_halfsize;   // translation to global coordinates
+Vec2d outer_wall_halfsize = Vec2d(0.5 * DL + BW, 0.5 * DH + BW);
+Vec2d outer_wall_translation = Vec2d(-BW, -BW) + outer_wall_halfsize;
+Vec2d inner_wall_halfsize = Vec2d(0.5 * DL, 0.5 * DH);
+Vec2d inner_wall_translation = inner_wall_halfsize;
+
+class WallBoundary : public ComplexShape
+{
+  public:
+    explicit WallBoundary(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        add<TransformShape<GeometricShapeBox>>(Transform(outer_wall_translation), outer_wall_halfsize);
+        subtract<TransformShape<GeometricShapeBox>>(Transform(inner_wall_translation), inner_wall_halfsize);
+    }
+};
+//----------------------------------------------------------------------
+//	Hydrostatic initial condition for the spin-up run.
+//----------------------------------------------------------------------
+class HydrostaticPressure : public LocalDynamics
+{
+  public:
+    explicit HydrostaticPressure(SPHBody &sph_body)
+        : LocalDynamics(sph_body), fluid_(DynamicCast<Fluid>(this, sph_body.getBaseMaterial())),
+          pos_(particles_->getVariableDataByName<Vecd>("Position")),
+          p_(particles_->getVariableDataByName<Real>("Pressure")),
+          rho_(particles_->getVariableDataByName<Real>("Density")),
+          mass_(particles_->getVariableDataByName<Real>("Mass")),
+          Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")){};
+
+    void update(size_t index_i, Real dt = 0.0)
+    {
+        p_[index_i] = rho0_f * gravity_g * (LH - pos_[index_i][1]);
+        rho_[index_i] = fluid_.DensityFromPressure(p_[index_i]);
+        mass_[index_i] = rho_[index_i] * Vol_[index_i];
+    };
+
+  protected:
+    Fluid &fluid_;
+    Vecd *pos_;
+    Real *p_, *rho_, *mass_, *Vol_;
+};
+//----------------------------------------------------------------------
+//	Run the tank at a given resolution. The fine run is restarted from the coarse one.
+//	Returns the maximum particle speed at the end of the run, and gives the water volume.
+//----------------------------------------------------------------------
+Real runHydrostaticTank(Real particle_spacing, size_t restart_step, Real duration, Real &water_volume)
+{
+    BoundingBox system_domain_bounds(Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setRestartStep(restart_step);
+    sph_system.setIOEnvironment();
+    //----------------------------------------------------------------------
+    //	Creating bodies with corresponding materials and particles.
+    //----------------------------------------------------------------------
+    FluidBody water_block(sph_system, makeShared<TransformShape<GeometricShapeBox>>(
+                                          Transform(water_block_translation), water_block_halfsize, "WaterBody"));
+    water_block.defineMaterial<WeaklyCompressibleFluid>(rho0_f, c_f, mu_f);
+    water_block.generateParticles<BaseParticles, Lattice>();
+
+    SolidBody wall_boundary(sph_system, makeShared<WallBoundary>("WallBoundary"));
+    wall_boundary.defineMaterial<Solid>();
+    wall_boundary.generateParticles<BaseParticles, Lattice>();
+    //----------------------------------------------------------------------
+    //	Define body relation map.
+    //----------------------------------------------------------------------
+    InnerRelation water_block_inner(water_block);
+    ContactRelation water_wall_contact(water_block, {&wall_boundary});
+    ComplexRelation water_wall_complex(water_block_inner, water_wall_contact);
+    //----------------------------------------------------------------------
+    // Define the numerical methods used in the simulation.
+    //----------------------------------------------------------------------
+    Gravity gravity(Vecd(0.0, -gravity_g));
+    SimpleDynamics<GravityForce<Gravity>> constant_gravity(water_block, gravity);
+    SimpleDynamics<NormalDirectionFromBodyShape> wall_boundary_normal_direction(wall_boundary);
+    Dynamics1Level<fluid_dynamics::Integration1stHalfWithWallRiemann> fluid_pressure_relaxation(water_block_inner, water_wall_contact);
+    Dynamics1Level<fluid_dynamics::Integration2ndHalfWithWallRiemann> fluid_density_relaxation(water_block_inner, water_wall_contact);
+    InteractionWithUpdate<fluid_dynamics::ViscousForceWithWall> viscous_force(water_block_inner, water_wall_contact);
+    ReduceDynamics<fluid_dynamics::AcousticTimeStep> fluid_acoustic_time_step(water_block);
+    ReduceDynamics<MaximumSpeed> maximum_speed(water_block);
+    SimpleDynamics<HydrostaticPressure> hydrostatic_pressure(water_block);
+    //----------------------------------------------------------------------
+    //	The restart files are written by the coarse run and remapped by the fine run.
+    //----------------------------------------------------------------------
+    RemappingRestartIO restart_io(sph_system, remapping_ratio, {"Force", "ForcePrior"});
+    //----------------------------------------------------------------------
+    //	Prepare the simulation with cell linked list, configuration
+    //	and case specified initial condition if necessary.
+    //----------------------------------------------------------------------
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    wall_boundary_normal_direction.exec();
+    constant_gravity.exec();
+    hydrostatic_pressure.exec();
+
+    Real &physical_time = *sph_system.getSystemVariableDataByName<Real>("PhysicalTime");
+    if (sph_system.RestartStep() != 0)
+    {
+        physical_time = restart_io.readRestartFiles(sph_system.RestartStep());
+        water_block.updateCellLinkedList();
+        water_wall_complex.updateConfiguration();
+    }
+    //----------------------------------------------------------------------
+    //	Main loop starts here.
+    //----------------------------------------------------------------------
+    Real end_time = physical_time + duration;
+    while (physical_time < end_time)
+    {
+        viscous_force.exec();
+        Real acoustic_dt = fluid_acoustic_time_step.exec();
+        fluid_pressure_relaxation.exec(acoustic_dt);
+        fluid_density_relaxation.exec(acoustic_dt);
+        physical_time += acoustic_dt;
+
+        water_block.updateCellLinkedList();
+        water_wall_complex.updateConfiguration();
+    }
+
+    if (sph_system.RestartStep() == 0)
+    {
+        restart_io.writeToFile(spin_up_restart_step);
+    }
+    Real final_maximum_speed = maximum_speed.exec();
+    water_volume = water_block.getBaseParticles().TotalRealParticles() * particle_spacing * particle_spacing;
+    std::cout << std::fixed << std::setprecision(9) << "Particle spacing = " << particle_spacing
+              << "	Time = " << physical_time << "	Particles = " << water_block.getBaseParticles().TotalRealParticles()
+              << "	Maximum speed = " << final_maximum_speed << "\n";
+    return final_maximum_speed;
+}
+//----------------------------------------------------------------------
+//	Main program starts here.
+//----------------------------------------------------------------------
+int main(int ac, char *av[])
+{
+    Real spin_up_time = 2.0;
+    Real measured_time = 1.0;
+    Real coarse_volume = 0.0;
+    Real fine_volume = 0.0;
+    Real coarse_speed = runHydrostaticTank(coarse_particle_spacing, 0, spin_up_time, coarse_volume);
+    Real fine_speed = runHydrostaticTank(coarse_particle_spacing / remapping_ratio, spin_up_restart_step,
+                                         measured_time, fine_volume);
+
+    if (fine_speed > 0.01 * U_ref || coarse_speed > 0.01 * U_ref)
+    {
+        std::cout << "\n Error: the remapped hydrostatic tank is not at rest!" << std::endl;
+        return 1;
+    }
+    if (std::abs(fine_volume - coarse_volume) > 0.02 * coarse_volume)
+    {
+        std::cout << "\n Error: the remapped water volume " << fine_volume
+                  << " differs from the spin-up one " << coarse_volume << "!" << std::endl;
+        return 1;
+    }
+    return 0;
+};
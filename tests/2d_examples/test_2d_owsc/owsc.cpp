@@ -164,10 +164,12 @@ int main(int ac, char *av[])
     //----------------------------------------------------------------------
     //	Coupling between SimBody and SPH
     //----------------------------------------------------------------------
+    solid_dynamics::SimBodySubCycling flap_sub_cycling(MBsystem, pin_spot, integ, force_on_bodies, particle_spacing_ref,
+                                                        Flap_H, maximum_coupling_interval, rho0_f * flap_volume / flap_mass);
     ReduceDynamics<solid_dynamics::TotalForceOnBodyPartForSimBody>
-        force_on_spot_flap(flap_multibody, MBsystem, pin_spot, integ);
+        force_on_spot_flap(flap_multibody, MBsystem, pin_spot, integ, flap_sub_cycling);
     SimpleDynamics<solid_dynamics::ConstraintBodyPartBySimBody>
-        constraint_spot_flap(flap_multibody, MBsystem, pin_spot, integ);
+        constraint_spot_flap(flap_multibody, MBsystem, pin_spot, integ, flap_sub_cycling);
     //----------------------------------------------------------------------
     //	Define the methods for I/O operations and observations of the simulation.
     //----------------------------------------------------------------------
@@ -252,11 +254,8 @@ int main(int ac, char *av[])
                 /** coupled rigid body dynamics. */
                 if (total_time >= relax_time)
                 {
-                    SimTK::State &state_for_update = integ.updAdvancedState();
-                    Real angle = pin_spot.getAngle(state_for_update);
-                    force_on_bodies.clearAllBodyForces(state_for_update);
-                    force_on_bodies.setOneBodyForce(state_for_update, pin_spot, force_on_spot_flap.exec(angle));
-                    integ.stepBy(dt);
+                    flap_sub_cycling.accumulateForce(force_on_spot_flap.exec(), dt);
+                    flap_sub_cycling.advanceSimBody();
                     constraint_spot_flap.exec();
                     wave_making.exec(dt);
                 }
@@ -70,6 +70,8 @@ Real mu_f = 1.0e-6;
 Real flap_mass = 33.04;
 Real flap_volume = 0.0579;
 Real rho0_s = flap_mass / flap_volume;
+// maximum interval of the sub-cycled coupling with Simbody, zero for coupling at every acoustic time step
+Real maximum_coupling_interval = 0.0;
 
 //------------------------------------------------------------------------------
 // geometric shape elements used in the case
@@ -0,0 +1,262 @@
+/**
+ * @file wave_relaxation_zone.cpp
+ * @brief 2D numerical wave flume with relaxation zones.
+ * @details A regular wave is generated by the relaxation zone at the left end of the flume
+ * and absorbed by the relaxation zone at the right end, both one wavelength long.
+ * The wave heights measured by the gauges along half a wavelength in the test section
+ * give the reflection coefficient of the absorbing zone with the envelope method.
+ * @author Xiangyu Hu
+ */
+#include "sphinxsys.h" //SPHinXsys Library.
+using namespace SPH;   // Namespace cite here.
+//----------------------------------------------------------------------
+//	Basic wave and geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Real water_depth = 0.5;             /**< Still water depth. */
+Real wave_height = 0.1;             /**< Target wave height. */
+Real wave_period = 1.6;             /**< Target wave period. */
+Real gravity_g = 9.81;              /**< Gravity. */
+Real particle_spacing_ref = 0.025;  /**< Initial reference particle spacing. */
+Real BW = particle_spacing_ref * 4; /**< Thickness of the flume wall. */
+Real DH = 2.0 * water_depth;        /**< Flume height. */
+LinearWave target_wave(water_depth, gravity_g, wave_height, wave_period, 0.0, 2.0 * wave_period);
+Real wave_length = target_wave.WaveLength();
+Real DL = 3.5 * wave_length; /**< Flume length: two relaxation zones and the test section. */
+size_t number_of_gauges = 6; /**< Number of wave gauges along half a wavelength. */
+//----------------------------------------------------------------------
+//	Material parameters.
+//----------------------------------------------------------------------
+Real rho0_f = 1000.0;                             /**< Reference density of fluid. */
+Real U_ref = 2.0 * sqrt(gravity_g * water_depth); /**< Characteristic velocity. */
+Real c_f = 10.0 * U_ref;                          /**< Reference sound speed. */
+Real mu_f = 1.0e-6 * rho0_f;                      /**< Dynamic viscosity of water. */
+//----------------------------------------------------------------------
+//	Geometric shapes used in this case.
+//----------------------------------------------------------------------
+Vec2d water_block_halfsize = Vec2d(0.5 * DL, 0.5 * water_depth);
+Vec2d water_block_translation = water_block_halfsize;
+Vec2d outer_wall_halfsize = Vec2d(0.5 * DL + BW, 0.5 * DH + BW);
+Vec2d outer_wall_translation = Vec2d(-BW, -BW) + outer_wall_halfsize;
+Vec2d inner_wall_halfsize = Vec2d(0.5 * DL, 0.5 * DH + BW);
+Vec2d inner_wall_translation = inner_wall_halfsize;
+Vec2d zone_halfsize = Vec2d(0.5 * wave_length, 0.5 * DH);
+Vec2d generating_zone_translation = zone_halfsize;
+Vec2d absorbing_zone_translation = Vec2d(DL - wave_length, 0.0) + zone_halfsize;
+Vec2d gauge_halfsize = Vec2d(particle_spacing_ref, 0.5 * DH);
+
+class WallBoundary : public ComplexShape
+{
+  public:
+    explicit WallBoundary(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        add<TransformShape<GeometricShapeBox>>(Transform(outer_wall_translation), outer_wall_halfsize);
+        subtract<TransformShape<GeometricShapeBox>>(Transform(inner_wall_translation), inner_wall_halfsize);
+    }
+};
+//----------------------------------------------------------------------
+//	Hydrostatic initial condition.
+//----------------------------------------------------------------------
+class HydrostaticPressure : public LocalDynamics
+{
+  public:
+    explicit HydrostaticPressure(SPHBody &sph_body)
+        : LocalDynamics(sph_body), fluid_(DynamicCast<Fluid>(this, sph_body.getBaseMaterial())),
+          pos_(particles_->getVariableDataByName<Vecd>("Position")),
+          p_(particles_->getVariableDataByName<Real>("Pressure")),
+          rho_(particles_->getVariableDataByName<Real>("Density")),
+          mass_(particles_->getVariableDataByName<Real>("Mass")),
+          Vol_(particles_->getVariableDataByName<Real>("VolumetricMeasure")){};
+
+    void update(size_t index_i, Real dt = 0.0)
+    {
+        p_[index_i] = rho0_f * gravity_g * (water_depth - pos_[index_i][1]);
+        rho_[index_i] = fluid_.DensityFromPressure(p_[index_i]);
+        mass_[index_i] = rho_[index_i] * Vol_[index_i];
+    };
+
+  protected:
+    Fluid &fluid_;
+    Vecd *pos_;
+    Real *p_, *rho_, *mass_, *Vol_;
+};
+//----------------------------------------------------------------------
+//	Main program starts here.
+//----------------------------------------------------------------------
+int main(int ac, char *av[])
+{
+    //----------------------------------------------------------------------
+    //	Build up the environment of a SPHSystem with global controls.
+    //----------------------------------------------------------------------
+    BoundingBox system_domain_bounds(Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing_ref);
+    sph_system.handleCommandlineOptions(ac, av)->setIOEnvironment();
+    //----------------------------------------------------------------------
+    //	Creating bodies with corresponding materials and particles.
+    //----------------------------------------------------------------------
+    TransformShape<GeometricShapeBox> water_block_shape(Transform(water_block_translation), water_block_halfsize, "WaterBody");
+    FluidBody water_block(sph_system, water_block_shape);
+    water_block.defineMaterial<WeaklyCompressibleFluid>(rho0_f, c_f, mu_f);
+    water_block.generateParticles<BaseParticles, Lattice>();
+
+    SolidBody wall_boundary(sph_system, makeShared<WallBoundary>("WallBoundary"));
+    wall_boundary.defineMaterial<Solid>();
+    wall_boundary.generateParticles<BaseParticles, Lattice>();
+    //----------------------------------------------------------------------
+    //	Define body relation map.
+    //----------------------------------------------------------------------
+    InnerRelation water_block_inner(water_block);
+    ContactRelation water_wall_contact(water_block, {&wall_boundary});
+    ComplexRelation water_block_complex(water_block_inner, water_wall_contact);
+    //----------------------------------------------------------------------
+    //	Define all numerical methods which are used in this case.
+    //----------------------------------------------------------------------
+    SimpleDynamics<NormalDirectionFromBodyShape> wall_boundary_normal_direction(wall_boundary);
+    Gravity gravity(Vecd(0.0, -gravity_g));
+    SimpleDynamics<GravityForce<Gravity>> constant_gravity(water_block, gravity);
+
+    Dynamics1Level<fluid_dynamics::Integration1stHalfWithWallRiemann> pressure_relaxation(water_block_inner, water_wall_contact);
+    Dynamics1Level<fluid_dynamics::Integration2ndHalfWithWallRiemann> density_relaxation(water_block_inner, water_wall_contact);
+    SimpleDynamics<HydrostaticPressure> hydrostatic_pressure(water_block);
+    InteractionWithUpdate<fluid_dynamics::DensitySummationComplexFreeSurface> update_density_by_summation(water_block_inner, water_wall_contact);
+    ReduceDynamics<fluid_dynamics::AdvectionViscousTimeStep> get_fluid_advection_time_step_size(water_block, U_ref);
+    ReduceDynamics<fluid_dynamics::AcousticTimeStep> get_fluid_time_step_size(water_block);
+
+    TransformShape<GeometricShapeBox> generating_zone_shape(Transform(generating_zone_translation), zone_halfsize, "GeneratingZone");
+    BodyRegionByCell generating_zone_region(water_block, generating_zone_shape);
+    SimpleDynamics<fluid_dynamics::WaveGeneratingZone> generating_zone(generating_zone_region, target_wave);
+    TransformShape<GeometricShapeBox> absorbing_zone_shape(Transform(absorbing_zone_translation), zone_halfsize, "AbsorbingZone");
+    BodyRegionByCell absorbing_zone_region(water_block, absorbing_zone_shape);
+    SimpleDynamics<fluid_dynamics::WaveAbsorbingZone> absorbing_zone(absorbing_zone_region, water_depth, gravity_g, wave_period);
+    //----------------------------------------------------------------------
+    //	Define the configuration related particles dynamics.
+    //----------------------------------------------------------------------
+    ParticleSorting particle_sorting(water_block);
+    //----------------------------------------------------------------------
+    //	Define the methods for I/O operations and observations of the simulation.
+    //	The gauges span half a wavelength in the middle of the test section.
+    //----------------------------------------------------------------------
+    BodyStatesRecordingToVtp write_real_body_states(sph_system);
+    StdVec<UniquePtr<TransformShape<GeometricShapeBox>>> gauge_shapes;
+    StdVec<UniquePtr<BodyRegionByCell>> gauge_regions;
+    StdVec<UniquePtr<ReducedQuantityAccumulation<UpperFrontInAxisDirection<BodyPartByCell>>>> wave_gauges;
+    for (size_t i = 0; i != number_of_gauges; ++i)
+    {
+        Real gauge_position = 1.5 * wave_length + 0.5 * wave_length * Real(i) / Real(number_of_gauges);
+        gauge_shapes.push_back(makeUnique<TransformShape<GeometricShapeBox>>(
+            Transform(Vec2d(gauge_position, 0.5 * DH)), gauge_halfsize, "WaveGauge" + std::to_string(i)));
+        gauge_regions.push_back(makeUnique<BodyRegionByCell>(water_block, *gauge_shapes.back()));
+        wave_gauges.push_back(makeUnique<ReducedQuantityAccumulation<UpperFrontInAxisDirection<BodyPartByCell>>>(
+            1, *gauge_regions.back(), "FreeSurfaceHeight"));
+    }
+    //----------------------------------------------------------------------
+    //	Prepare the simulation with cell linked list, configuration
+    //	and case specified initial condition if necessary.
+    //----------------------------------------------------------------------
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    wall_boundary_normal_direction.exec();
+    constant_gravity.exec();
+    hydrostatic_pressure.exec();
+    //----------------------------------------------------------------------
+    //	Basic control parameters for time stepping.
+    //	The measurement starts after the reflected waves have returned to the test section.
+    //----------------------------------------------------------------------
+    Real &physical_time = *sph_system.getSystemVariableDataByName<Real>("PhysicalTime");
+    int number_of_iterations = 0;
+    int screen_output_interval = 100;
+    Real measurement_start_time = 8.0 * wave_period;
+    Real end_time = 12.0 * wave_period;
+    Real output_interval = 0.25 * wave_period;
+    bool is_measuring = false;
+    //----------------------------------------------------------------------
+    //	First output before the main loop.
+    //----------------------------------------------------------------------
+    write_real_body_states.writeToFile();
+    //----------------------------------------------------------------------
+    //	Main loop of time stepping starts here.
+    //----------------------------------------------------------------------
+    TickCount t1 = TickCount::now();
+    TimeInterval interval;
+    while (physical_time < end_time)
+    {
+        Real integral_time = 0.0;
+        while (integral_time < output_interval)
+        {
+            Real Dt = get_fluid_advection_time_step_size.exec();
+            update_density_by_summation.exec();
+
+            Real relaxation_time = 0.0;
+            Real dt = 0.0;
+            while (relaxation_time < Dt)
+            {
+                dt = SMIN(get_fluid_time_step_size.exec(), Dt - relaxation_time);
+                pressure_relaxation.exec(dt);
+                density_relaxation.exec(dt);
+                generating_zone.exec(dt);
+                absorbing_zone.exec(dt);
+                relaxation_time += dt;
+                integral_time += dt;
+                physical_time += dt;
+            }
+
+            if (!is_measuring && physical_time > measurement_start_time)
+            {
+                for (auto &wave_gauge : wave_gauges)
+                    wave_gauge->getAccumulation().reset();
+                is_measuring = true;
+            }
+            for (auto &wave_gauge : wave_gauges)
+                wave_gauge->accumulate(Dt);
+
+            if (number_of_iterations % screen_output_interval == 0)
+            {
+                std::cout << std::fixed << std::setprecision(9) << "N=" << number_of_iterations
+                          << "	Time = " << physical_time << "	Dt = " << Dt << "	dt = " << dt << "\n";
+            }
+            number_of_iterations++;
+            if (number_of_iterations % 100 == 0 && number_of_iterations != 1)
+            {
+                particle_sorting.exec();
+            }
+            water_block.updateCellLinkedList();
+            water_block_complex.updateConfiguration();
+        }
+
+        TickCount t2 = TickCount::now();
+        write_real_body_states.writeToFile();
+        for (auto &wave_gauge : wave_gauges)
+            wave_gauge->writeToFile();
+        TickCount t3 = TickCount::now();
+        interval += t3 - t2;
+    }
+    TickCount t4 = TickCount::now();
+
+    TimeInterval tt;
+    tt = t4 - t1 - interval;
+    std::cout << "Total wall time for computation: " << tt.seconds() << " seconds." << std::endl;
+    //----------------------------------------------------------------------
+    //	The envelope of a partially standing wave varies between H(1 - R) and H(1 + R)
+    //	within half a wavelength, which gives the reflection coefficient R.
+    //----------------------------------------------------------------------
+    Real maximum_height = 0.0;
+    Real minimum_height = MaxReal;
+    Real average_height = 0.0;
+    for (auto &wave_gauge : wave_gauges)
+    {
+        QuantityAccumulation<Real> &accumulation = wave_gauge->getAccumulation();
+        Real local_height = accumulation.Maximum() - accumulation.Minimum();
+        maximum_height = SMAX(maximum_height, local_height);
+        minimum_height = SMIN(minimum_height, local_height);
+        average_height += local_height / Real(number_of_gauges);
+    }
+    Real reflection_coefficient = (maximum_height - minimum_height) / (maximum_height + minimum_height);
+    std::cout << "Average wave height = " << average_height << " (target " << wave_height << ")"
+              << "	Reflection coefficient = " << reflection_coefficient << std::endl;
+
+    if (reflection_coefficient > 0.15 || ABS(average_height - wave_height) > 0.3 * wave_height)
+    {
+        std::cout << "\n Error: the wave is not generated or absorbed properly!" << std::endl;
+        return 1;
+    }
+    return 0;
+};
@@ -0,0 +1,116 @@
+/**
+ * @file 	particle_relaxation_ck.cpp
+ * @brief 	This is the test of relaxing body fitted particles (3D) using computing kernels.
+ * @details The level set of the imported model is probed by its flattened copy,
+ *          so that the relaxation steps run as computing kernels.
+ * @author 	Xiangyu Hu
+ */
+
+#include "sphinxsys_ck.h"
+using namespace SPH;
+//----------------------------------------------------------------------
+//	Set the file path to the data file.
+//----------------------------------------------------------------------
+std::string full_path_to_file = "./input/teapot.stl";
+//----------------------------------------------------------------------
+//	Basic geometry parameters and numerical setup.
+//----------------------------------------------------------------------
+Vec3d domain_lower_bound(-9.0, -6.0, 0.0);
+Vec3d domain_upper_bound(9.0, 6.0, 9.0);
+Real dp_0 = (domain_upper_bound[0] - domain_lower_bound[0]) / 40.0;
+/** Domain bounds of the system. */
+BoundingBox system_domain_bounds(domain_lower_bound, domain_upper_bound);
+//----------------------------------------------------------------------
+//	define a body from the imported model.
+//----------------------------------------------------------------------
+class SolidBodyFromMesh : public ComplexShape
+{
+  public:
+    explicit SolidBodyFromMesh(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vecd translation(0.0, 0.0, 0.0);
+        add<TriangleMeshShapeSTL>(full_path_to_file, translation, 1.0);
+    }
+};
+//-----------------------------------------------------------------------------------------------------------
+//	Main program starts here.
+//-----------------------------------------------------------------------------------------------------------
+int main(int ac, char *av[])
+{
+    //----------------------------------------------------------------------
+    //	Build up -- a SPHSystem
+    //----------------------------------------------------------------------
+    SPHSystem sph_system(system_domain_bounds, dp_0);
+    sph_system.handleCommandlineOptions(ac, av)->setIOEnvironment();
+    //----------------------------------------------------------------------
+    //	Creating body, materials and particles.
+    //----------------------------------------------------------------------
+    RealBody imported_model(sph_system, makeShared<SolidBodyFromMesh>("SolidBodyFromMesh"));
+    imported_model.defineBodyLevelSetShape()->correctLevelSetSign();
+    imported_model.generateParticles<BaseParticles, Lattice>();
+    //----------------------------------------------------------------------
+    //	Define simple file input and outputs functions.
+    //----------------------------------------------------------------------
+    BodyStatesRecordingToVtp write_imported_model_to_vtp({imported_model});
+    //----------------------------------------------------------------------
+    //	Define body relation map.
+    //----------------------------------------------------------------------
+    using MyExecutionPolicy = execution::ParallelPolicy; // define execution policy for this case
+
+    UpdateCellLinkedList<MyExecutionPolicy, CellLinkedList> imported_model_cell_linked_list(imported_model);
+    Relation<Inner<>> imported_model_inner(imported_model);
+    UpdateRelation<MyExecutionPolicy, Inner<>> imported_model_update_inner_relation(imported_model_inner);
+    //----------------------------------------------------------------------
+    //	Methods used for particle relaxation.
+    //----------------------------------------------------------------------
+    using namespace relax_dynamics;
+    SimpleDynamics<RandomizeParticlePosition> random_imported_model_particles(imported_model);
+    InteractionDynamicsCK<MyExecutionPolicy, RelaxationResidueCK<Inner<LevelSetCorrection>>>
+        relaxation_residue(imported_model_inner);
+    ReduceDynamicsCK<MyExecutionPolicy, RelaxationScalingCK> relaxation_scaling(imported_model);
+    StateDynamics<MyExecutionPolicy, PositionRelaxationCK> position_relaxation(imported_model);
+    StateDynamics<MyExecutionPolicy, ShapeSurfaceBoundingCK> surface_bounding(imported_model);
+    //----------------------------------------------------------------------
+    //	Particle relaxation starts here.
+    //----------------------------------------------------------------------
+    random_imported_model_particles.exec(0.25);
+    surface_bounding.exec();
+    write_imported_model_to_vtp.writeToFile(0);
+    //----------------------------------------------------------------------
+    //	Particle relaxation time stepping start here.
+    //----------------------------------------------------------------------
+    imported_model_cell_linked_list.exec();
+    imported_model_update_inner_relation.exec();
+    relaxation_residue.exec();
+    Real initial_scaling = relaxation_scaling.exec();
+
+    int ite_p = 0;
+    Real scaling = initial_scaling;
+    while (ite_p < 1000)
+    {
+        imported_model_cell_linked_list.exec();
+        imported_model_update_inner_relation.exec();
+        relaxation_residue.exec();
+        scaling = relaxation_scaling.exec();
+        position_relaxation.exec(scaling);
+        surface_bounding.exec();
+        ite_p += 1;
+        if (ite_p % 100 == 0)
+        {
+            std::cout << std::fixed << std::setprecision(9) << "Relaxation steps for the imported model N = " << ite_p << "\n";
+            write_imported_model_to_vtp.writeToFile(ite_p);
+        }
+    }
+    std::cout << "The physics relaxation process of imported model finish !" << std::endl;
+    //----------------------------------------------------------------------
+    //	The scaling is inversely proportional to the maximum residue,
+    //	which should be reduced by the relaxation.
+    //----------------------------------------------------------------------
+    std::cout << "Relaxation scaling increased from " << initial_scaling << " to " << scaling << std::endl;
+    if (scaling < 2.0 * initial_scaling)
+    {
+        std::cout << "\n Error: the relaxation residue is not reduced!" << std::endl;
+        return 1;
+    }
+    return 0;
+}
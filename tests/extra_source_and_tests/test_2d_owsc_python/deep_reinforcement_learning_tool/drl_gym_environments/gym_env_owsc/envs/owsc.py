@@ -44,23 +44,13 @@ class OWSCEnv(gym.Env):
         self.damping_coefficient = 50          # Set damping coefficient for the environment
         self.total_reward_per_episode = 0.0    # Track total reward in each episode
 
-        # Start the simulation with the given action time and damping coefficient
-        self.owsc.run_case(self.action_time, self.damping_coefficient)
-        
-        # Initialize observation array with zero values
-        self.observation = np.zeros(self.obs_numbers)
-        # Fill the observation array with values from the OWSC simulation
-        for i in range(0, 2):  
-            self.observation[i] = self.owsc.get_wave_height(i)
-            self.observation[i + 2] = self.owsc.get_wave_velocity(i, 0)
-            self.observation[i + 4] = self.owsc.get_wave_velocity(i, 1)
-            self.observation[i + 6] = self.owsc.get_wave_velocity_on_flap(i, 0)
-            self.observation[i + 8] = self.owsc.get_wave_velocity_on_flap(i, 1)
-            self.observation[i + 10] = self.owsc.get_flap_position(i, 0)
-            self.observation[i + 12] = self.owsc.get_flap_position(i, 1)
-        self.observation[14] = self.owsc.get_flap_angle()
-        self.observation[15] = self.owsc.get_flap_angle_rate()
-        
+        # Position of the flap angle rate in the observation array
+        self.angle_rate_index = self.owsc.observable_offset("FlapAngleRate")
+
+        # Start the simulation with the given action time and damping coefficient,
+        # all observables are returned as one array
+        self.observation = self.owsc.step([self.damping_coefficient], self.action_time)
+
         self._get_obs = self.observation.astype(np.float32)
 
         return self._get_obs, {}
@@ -81,29 +71,17 @@ class OWSCEnv(gym.Env):
 
         reward_0 = 0.0
         for i in range(self.update_per_action):
-            self.flap_angle_rate_previous = self.owsc.get_flap_angle_rate()
+            self.flap_angle_rate_previous = self.observation[self.angle_rate_index]
             self.damping_coefficient += self.damping_change / self.update_per_action
             self.action_time += self.time_per_action / self.update_per_action
-            self.owsc.run_case(self.action_time, self.damping_coefficient)
-            self.flap_angle_rate_now = self.owsc.get_flap_angle_rate()
+            self.observation = self.owsc.step([self.damping_coefficient], self.time_per_action / self.update_per_action)
+            self.flap_angle_rate_now = self.observation[self.angle_rate_index]
             # Calculate reward based on energy (flap angle rate)
             reward_0 += self.damping_coefficient * math.pow(0.5 * (self.flap_angle_rate_now + self.flap_angle_rate_previous), 2) * self.time_per_action / self.update_per_action
         # Add any penalties to the reward
         reward = reward_0 + penality_0
         self.total_reward_per_episode += reward
 
-        # Update observations from the OWSC simulation
-        for i in range(0, 2):  
-            self.observation[i] = self.owsc.get_wave_height(i)
-            self.observation[i + 2] = self.owsc.get_wave_velocity(i, 0)
-            self.observation[i + 4] = self.owsc.get_wave_velocity(i, 1)
-            self.observation[i + 6] = self.owsc.get_wave_velocity_on_flap(i, 0)
-            self.observation[i + 8] = self.owsc.get_wave_velocity_on_flap(i, 1)
-            self.observation[i + 10] = self.owsc.get_flap_position(i, 0)
-            self.observation[i + 12] = self.owsc.get_flap_position(i, 1)
-        self.observation[14] = self.owsc.get_flap_angle()
-        self.observation[15] = self.owsc.get_flap_angle_rate()
-
         self._get_obs = self.observation.astype(np.float32)
 
         # Log action and reward information to files
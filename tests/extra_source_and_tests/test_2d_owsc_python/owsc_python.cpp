@@ -3,10 +3,11 @@
  * @brief    This is the test of wave interaction with Oscillating Wave Surge Converter (OWSC), for DRL.
  * @author   Mai Ye, Chi Zhang and Xiangyu Hu
  */
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
 #include "owsc_python.h"
 #include "custom_io_environment.h"
-#include "custom_io_observation.h"
 #include "custom_io_simbody.h"
 #include "sphinxsys.h" 
 
@@ -97,7 +98,7 @@ class SimbodyEnvironment : public SphFlapReloadEnvironment
     }
 };
 
-class SphOWSC : public SimbodyEnvironment
+class SphOWSC : public SimbodyEnvironment, public ControlledSimulation
 {
   protected:
     SPHSystem &sph_system_;
@@ -150,7 +151,7 @@ class SphOWSC : public SimbodyEnvironment
     WriteSimBodyPinDataExtended write_flap_pin_data;
     /** WaveProbes. */
     BodyRegionByCell wave_probe_buffer_no_0, wave_probe_buffer_no_1;
-    ExtendedReducedQuantityRecording<UpperFrontInAxisDirection<BodyPartByCell>> wave_probe_0, wave_probe_1;
+    ReducedQuantityRecording<UpperFrontInAxisDirection<BodyPartByCell>> wave_probe_0, wave_probe_1;
     //----------------------------------------------------------------------
     //	    Basic control parameters for time stepping.
     //----------------------------------------------------------------------
@@ -161,6 +162,7 @@ class SphOWSC : public SimbodyEnvironment
     Real total_time = 0.0;
     Real relax_time = 1.0;
     Real output_interval = 0.1;
+    Real end_time = 0.0;
     /** statistics for computing time. */
     TickCount t1 = TickCount::now();
     TimeInterval interval;
@@ -237,6 +239,20 @@ class SphOWSC : public SimbodyEnvironment
 	write_flap_pin_data.writeToFile(0);
 	wave_probe_0.writeToFile(0);
 	wave_probe_1.writeToFile(0);
+	//----------------------------------------------------------------------
+	//	Actuators and observables for the control from Python.
+	//----------------------------------------------------------------------
+	addActuator("DampingCoefficient", [&](Real damping_coefficient)
+		    { linear_damper.setDamping(integ.updAdvancedState(), damping_coefficient); }, 20.0);
+	addObservable("WaveHeight_03", wave_probe_0);
+	addObservable("WaveHeight_05", wave_probe_1);
+	addObservable("WaveVelocity", wave_velocity_probe);
+	addObservable("WaveVelocityOnFlap", wave_velocity_on_flap_probe);
+	addObservable("FlapPosition", flap_position_probe);
+	addObservable("FlapAngle", 1, [&](Real *observation)
+		      { observation[0] = write_flap_pin_data.getAngleToPython(); });
+	addObservable("FlapAngleRate", 1, [&](Real *observation)
+		      { observation[0] = write_flap_pin_data.getAngleRateToPython(); });
     }
 
     virtual ~SphOWSC(){};
@@ -248,59 +264,38 @@ class SphOWSC : public SimbodyEnvironment
         return 1;
     }
     //----------------------------------------------------------------------
-    //	    Get flap angle and angle rate.
+    //	    Run to the pause time with the given damping coefficient and test the result.
     //----------------------------------------------------------------------
-    Real getFlapAngle()
+    void runCase(Real pause_time_from_python, Real dampling_coefficient_from_python)
     {
-	return write_flap_pin_data.getAngleToPython(number_of_iterations);
-    };
+	setActions(&dampling_coefficient_from_python);
+	end_time = pause_time_from_python;
+	runToEndTime();
 
-    Real getFlapAngleRate()
-    {
-	return write_flap_pin_data.getAngleRateToPython(number_of_iterations);
-    };
-    //----------------------------------------------------------------------
-    //  Get wave height.
-    //----------------------------------------------------------------------
-    Real getWaveHeight(size_t number) 
-    {
-        if (number == 0) 
+	// This section is used for CMake testing (cmake test).
+	// During reinforcement learning training, this part can be commented out.
+	if (sph_system.GenerateRegressionData())
 	{
-            return wave_probe_0.getReducedQuantity();
-        }
-	else if (number == 1)
-        {
-	    return wave_probe_1.getReducedQuantity();
+	    write_total_viscous_force_from_fluid.generateDataBase(1.0e-3);
+	}
+	else
+	{
+	    write_total_viscous_force_from_fluid.testResult();
 	}
-        return -1.0; 
-    }
-    //----------------------------------------------------------------------
-    //  Get wave velocity in front of the flap.
-    //----------------------------------------------------------------------
-    Real getWaveVelocity(int number, int direction)
-    {
-        return wave_velocity_probe.getObservedQuantity()[number][direction];
-    };
-    //----------------------------------------------------------------------
-    //	     Get wave velocity on the flap.
-    //----------------------------------------------------------------------
-    Real getWaveVelocityOnFlap(int number, int direction)
-    {
-	return wave_velocity_on_flap_probe.getObservedQuantity()[number][direction];
     };
-    //----------------------------------------------------------------------
-    //	    Get flap position.
-    //----------------------------------------------------------------------
-    Real getFlapPositon(int number, int direction)
+
+  protected:
+    virtual void advance(Real duration) override
     {
-	return flap_position_probe.getObservedQuantity()[number][direction];
+	end_time += duration;
+	runToEndTime();
     };
     //----------------------------------------------------------------------
-    //	    Main loop of time stepping starts here. && For changing damping coefficient.
+    //	    Main loop of time stepping starts here.
     //----------------------------------------------------------------------
-    void runCase(Real pause_time_from_python, Real dampling_coefficient_from_python)
+    void runToEndTime()
     {
-        while (physical_time < pause_time_from_python)
+        while (physical_time < end_time)
         {
 	    Real integral_time = 0.0;
 	    while (integral_time < output_interval)
@@ -320,8 +315,8 @@ class SphOWSC : public SimbodyEnvironment
 		    /** coupled rigid body dynamics. */
 		    if (total_time >= relax_time)
 		    {
+			applyActuators();
 			SimTK::State &state_for_update = integ.updAdvancedState();
-			linear_damper.setDamping(state_for_update, dampling_coefficient_from_python);
 			Real angle = pin_spot.getAngle(state_for_update);
 			force_on_bodies.clearAllBodyForces(state_for_update);
 			force_on_bodies.setOneBodyForce(state_for_update, pin_spot, force_on_spot_flap.exec(angle));
@@ -381,17 +376,6 @@ class SphOWSC : public SimbodyEnvironment
 
 	TimeInterval tt;
 	tt = t4 - t1 - interval;
-
-	// This section is used for CMake testing (cmake test).
-	// During reinforcement learning training, this part can be commented out.
-	if (sph_system.GenerateRegressionData())
-	{
-	    write_total_viscous_force_from_fluid.generateDataBase(1.0e-3);
-	}
-	else
-	{
-	    write_total_viscous_force_from_fluid.testResult();
-	}
     };
 };
 
@@ -400,11 +384,21 @@ PYBIND11_MODULE(test_2d_owsc_python, m)
     py::class_<SphOWSC>(m, "owsc_from_sph_cpp")
         .def(py::init<const int&, const int&>())
         .def("cmake_test", &SphOWSC::cmakeTest)
-        .def("get_flap_angle", &SphOWSC::getFlapAngle)
-        .def("get_flap_angle_rate", &SphOWSC::getFlapAngleRate)
-        .def("get_wave_height", &SphOWSC::getWaveHeight)
-        .def("get_wave_velocity", &SphOWSC::getWaveVelocity)
-        .def("get_wave_velocity_on_flap", &SphOWSC::getWaveVelocityOnFlap)
-	.def("get_flap_position", &SphOWSC::getFlapPositon)
-        .def("run_case", &SphOWSC::runCase);
+        .def("actuator_names", &SphOWSC::ActuatorNames)
+        .def("observable_names", &SphOWSC::ObservableNames)
+        .def("observable_offset", &SphOWSC::ObservableOffset)
+        .def("observable_size", &SphOWSC::ObservableSize)
+        .def("observe", [](SphOWSC &self)
+             {
+                 StdVec<Real> observations = self.observe();
+                 return py::array_t<Real>(observations.size(), observations.data()); })
+        .def("step", [](SphOWSC &self, const StdVec<Real> &actions, Real duration)
+             {
+                 StdVec<Real> observations;
+                 {
+                     py::gil_scoped_release release;
+                     observations = self.step(actions, duration);
+                 }
+                 return py::array_t<Real>(observations.size(), observations.data()); })
+        .def("run_case", &SphOWSC::runCase, py::call_guard<py::gil_scoped_release>());
 }
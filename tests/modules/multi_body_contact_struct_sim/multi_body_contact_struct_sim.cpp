@@ -0,0 +1,66 @@
+#include "structural_simulation_class.h"
+#include <gtest/gtest.h>
+
+TEST(StructuralSimulation, MultiBodyContactBroadPhase)
+{
+    /** INPUT PARAMETERS */
+    Real scale_stl = 0.001; // block size of 0.01 m
+    Real end_time = 0.1;
+    Real rho_0 = 1000;
+    Real poisson = 0.3;
+    Real Youngs_modulus = 5e5;
+    Real physical_viscosity = 50;
+    Real gravity = 10;
+    /** STL IMPORT PARAMETERS */
+    // block 1 is dropped onto the fixed block 0, blocks 2 and 3 are far away from all others
+    std::string relative_input_path = "./input/"; // path definition for linux
+    std::vector<std::string> imported_stl_list = {"block_0.stl", "block_1.stl", "block_2.stl", "block_3.stl"};
+    std::vector<Vec3d> translation_list = {Vec3d::Zero(), Vec3d(0.0, 0.0, 11.0), Vec3d(40.0, 0.0, 0.0), Vec3d(0.0, 40.0, 0.0)};
+    std::vector<Real> resolution_list = {10.0 / 6.0, 10.0 / 6.0, 10.0 / 6.0, 10.0 / 6.0};
+    SharedPtr<SaintVenantKirchhoffSolid> material = makeShared<SaintVenantKirchhoffSolid>(rho_0, Youngs_modulus, poisson);
+    std::vector<SharedPtr<SaintVenantKirchhoffSolid>> material_model_list = {material, material, material, material};
+    /** INPUT DECLARATION */
+    StructuralSimulationInput input{
+        relative_input_path,
+        imported_stl_list,
+        scale_stl,
+        translation_list,
+        resolution_list,
+        material_model_list,
+        {physical_viscosity, physical_viscosity, physical_viscosity, physical_viscosity},
+        {}};
+    input.all_bodies_may_contact_ = true;
+    input.particle_relaxation_list_ = {false, false, false, false};
+    input.body_indices_fixed_constraint_ = {0};
+    input.non_zero_gravity_ = std::vector<GravityPair>{GravityPair(1, Vec3d(0.0, 0.0, -gravity))};
+
+    //=================================================================================================//
+    StructuralSimulation sim(input);
+    sim.runSimulation(end_time);
+    //=================================================================================================//
+    EXPECT_EQ(sim.getBroadPhaseOverlaps(0), IndexVector({1}));
+    EXPECT_EQ(sim.getBroadPhaseOverlaps(1), IndexVector({0}));
+    EXPECT_TRUE(sim.getBroadPhaseOverlaps(2).empty());
+    EXPECT_TRUE(sim.getBroadPhaseOverlaps(3).empty());
+
+    // the dropped block rests on the fixed block instead of falling through it
+    Vecd *pos_0 = sim.get_solid_body_list_()[0]->getElasticSolidParticles()->ParticlePositions();
+    Vecd *pos_1 = sim.get_solid_body_list_()[1]->getElasticSolidParticles()->ParticlePositions();
+    Real top_of_fixed_block = -MaxReal;
+    for (size_t index = 0; index < sim.get_solid_body_list_()[0]->getElasticSolidParticles()->TotalRealParticles(); index++)
+    {
+        top_of_fixed_block = SMAX(top_of_fixed_block, pos_0[index][2]);
+    }
+    for (size_t index = 0; index < sim.get_solid_body_list_()[1]->getElasticSolidParticles()->TotalRealParticles(); index++)
+    {
+        EXPECT_GT(pos_1[index][2], top_of_fixed_block);
+    }
+    EXPECT_NEAR(sim.getMaxDisplacement(2), 0.0, 1.0e-6);
+    EXPECT_NEAR(sim.getMaxDisplacement(3), 0.0, 1.0e-6);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,69 @@
+#include "structural_simulation_class.h"
+#include <gtest/gtest.h>
+
+StructuralSimulationInput createInput(const std::string &particle_cache_path)
+{
+    /** INPUT PARAMETERS */
+    Real scale_stl = 0.001; // block size of 0.01 m
+    Real rho_0 = 1000;
+    Real poisson = 0.3;
+    Real Youngs_modulus = 5e5;
+    Real physical_viscosity = 50;
+    /** STL IMPORT PARAMETERS */
+    // two independent blocks of different resolutions, relaxed concurrently
+    std::string relative_input_path = "./input/"; // path definition for linux
+    std::vector<std::string> imported_stl_list = {"block_0.stl", "block_1.stl"};
+    std::vector<Vec3d> translation_list = {Vec3d::Zero(), Vec3d(20.0, 0.0, 0.0)};
+    std::vector<Real> resolution_list = {10.0 / 6.0, 10.0 / 8.0};
+    SharedPtr<SaintVenantKirchhoffSolid> material = makeShared<SaintVenantKirchhoffSolid>(rho_0, Youngs_modulus, poisson);
+    std::vector<SharedPtr<SaintVenantKirchhoffSolid>> material_model_list = {material, material};
+    /** INPUT DECLARATION */
+    StructuralSimulationInput input{
+        relative_input_path,
+        imported_stl_list,
+        scale_stl,
+        translation_list,
+        resolution_list,
+        material_model_list,
+        {physical_viscosity, physical_viscosity},
+        {}};
+    input.particle_relaxation_list_ = {true, true};
+    input.particle_cache_path_ = particle_cache_path;
+    input.use_relaxed_particles_ = true;
+    return input;
+}
+
+TEST(StructuralSimulation, RelaxedParticleCache)
+{
+    std::string particle_cache_path = "./particle_cache";
+    fs::remove_all(particle_cache_path);
+
+    StructuralSimulation relaxed_sim(createInput(particle_cache_path));
+    size_t number_of_cache_files = 0;
+    for ([[maybe_unused]] const auto &entry : fs::directory_iterator(particle_cache_path))
+    {
+        number_of_cache_files++;
+    }
+    EXPECT_EQ(number_of_cache_files, 2);
+
+    // the second simulation reloads the relaxed particles instead of relaxing again
+    StructuralSimulation cached_sim(createInput(particle_cache_path));
+    for (size_t body_index = 0; body_index < 2; body_index++)
+    {
+        BaseParticles *relaxed_particles = relaxed_sim.get_solid_body_list_()[body_index]->getElasticSolidParticles();
+        BaseParticles *cached_particles = cached_sim.get_solid_body_list_()[body_index]->getElasticSolidParticles();
+        ASSERT_EQ(relaxed_particles->TotalRealParticles(), cached_particles->TotalRealParticles());
+        Vecd *relaxed_pos = relaxed_particles->ParticlePositions();
+        Vecd *cached_pos = cached_particles->ParticlePositions();
+        for (size_t index = 0; index < relaxed_particles->TotalRealParticles(); index++)
+        {
+            EXPECT_EQ(relaxed_pos[index], cached_pos[index]);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -248,6 +248,8 @@ int main(int ac, char *av[])
               << interval_acoustic_steps.seconds() << "\n";
     std::cout << std::fixed << std::setprecision(9) << "interval_updating_configuration = "
               << interval_updating_configuration.seconds() << "\n";
+    std::cout << "kernel launches per step = "
+              << execution::execution_instance.NumberOfKernelLaunches() / SMAX(number_of_iterations, size_t(1)) << "\n";
 
     if (sph_system.GenerateRegressionData())
     {
@@ -260,5 +262,6 @@ int main(int ac, char *av[])
         fluid_observer_pressure.testResult();
     }
 
+    releaseDeviceResources();
     return 0;
 };
@@ -31,8 +31,45 @@ TEST(exclusive_scan, test_sycl)
     EXPECT_EQ(sum, sycl_sum);
 }
 
+TEST(exclusive_scan, test_sycl_multiple_work_groups)
+{
+    // larger than the square of the work-group size, so that the tile sums are scanned recursively
+    UnsignedInt large_list_size = 1000003;
+    StdVec<UnsignedInt> large_list(large_list_size);
+    for (UnsignedInt i = 0; i != large_list_size; ++i)
+        large_list[i] = i % 7;
+    StdVec<UnsignedInt> large_solution(large_list_size);
+    std::exclusive_scan(large_list.begin(), large_list.end(), large_solution.begin(), UnsignedInt(0));
+
+    UnsignedInt *device_list_data = allocateDeviceOnly<UnsignedInt>(large_list_size);
+    UnsignedInt *device_result = allocateDeviceOnly<UnsignedInt>(large_list_size);
+    copyToDevice(large_list.data(), device_list_data, large_list_size);
+    TickCount t1 = TickCount::now();
+    UnsignedInt sycl_sum = exclusive_scan(ParallelDevicePolicy{}, device_list_data, device_result,
+                                          large_list_size, PlusUnsignedInt<ParallelDevicePolicy>::type());
+    TimeInterval scan_time = TickCount::now() - t1;
+    // the repeated scan reuses the scratch of the tiles allocated by the first one
+    TickCount t2 = TickCount::now();
+    UnsignedInt repeated_sycl_sum = exclusive_scan(ParallelDevicePolicy{}, device_list_data, device_result,
+                                                   large_list_size, PlusUnsignedInt<ParallelDevicePolicy>::type());
+    TimeInterval repeated_scan_time = TickCount::now() - t2;
+    StdVec<UnsignedInt> large_sycl_result(large_list_size);
+    copyFromDevice(large_sycl_result.data(), device_result, large_list_size);
+    std::cout << "Device exclusive scan of " << large_list_size << " entries: " << scan_time.seconds()
+              << " seconds, repeated: " << repeated_scan_time.seconds() << " seconds." << std::endl;
+
+    freeDeviceData(device_list_data);
+    freeDeviceData(device_result);
+
+    EXPECT_EQ(large_solution, large_sycl_result);
+    EXPECT_EQ(large_solution.back(), sycl_sum);
+    EXPECT_EQ(sycl_sum, repeated_sycl_sum);
+}
+
 int main(int argc, char *argv[])
 {
     testing::InitGoogleTest(&argc, argv);
-    return RUN_ALL_TESTS();
+    int result = RUN_ALL_TESTS();
+    releaseDeviceResources();
+    return result;
 }
@@ -56,6 +56,141 @@ TEST(test_Complex_GeometricShapeBox, test_normal_direction)
     EXPECT_LE((wall_boundary.findNormalDirection(test_point) - Vec2d(0.0, 1.0)).cwiseAbs().maxCoeff(), tolerance());
 }
 
+class CompositeShape : public ComplexShape
+{
+  public:
+    explicit CompositeShape(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        add<TransformShape<GeometricShapeBox>>(Transform(outer_wall_translation), outer_wall_halfsize);
+        subtract<TransformShape<GeometricShapeBox>>(Transform(inner_wall_translation), inner_wall_halfsize);
+        add<TransformShape<GeometricShapeBox>>(Transform(Rotation2d(0.3), Vec2d(1.5, 1.0)), Vec2d(0.6, 0.2));
+        add<GeometricShapeBall>(Vec2d(3.5, 3.5), 1.0);
+        subtract<GeometricShapeBall>(Vec2d(3.6, 3.4), 0.5);
+    }
+    StdVec<SubShapeAndOp> &getSubShapesAndOps() { return sub_shapes_and_ops_; };
+};
+
+/** Reference queries visiting all sub-shapes in order. */
+bool referenceContain(StdVec<SubShapeAndOp> &sub_shapes_and_ops, const Vec2d &probe_point)
+{
+    bool exist = false;
+    for (auto &sub_shape_and_op : sub_shapes_and_ops)
+    {
+        bool inside = sub_shape_and_op.first->checkContain(probe_point);
+        exist = sub_shape_and_op.second == ShapeBooleanOps::add ? exist || inside : exist && !inside;
+    }
+    return exist;
+}
+
+Real referenceDistance(StdVec<SubShapeAndOp> &sub_shapes_and_ops, const Vec2d &probe_point)
+{
+    Real distance = MaxReal;
+    for (auto &sub_shape_and_op : sub_shapes_and_ops)
+        distance = SMIN(distance, (sub_shape_and_op.first->findClosestPoint(probe_point) - probe_point).norm());
+    return distance;
+}
+
+TEST(test_Complex_CompositeShape, test_signed_distance_and_normal)
+{
+    CompositeShape composite_shape("CompositeShape");
+    StdVec<SubShapeAndOp> &sub_shapes_and_ops = composite_shape.getSubShapesAndOps();
+    BoundingBox bounds = composite_shape.getBounds();
+    Vec2d lower_bound = bounds.first_ - Vec2d(0.5, 0.5);
+    Vec2d upper_bound = bounds.second_ + Vec2d(0.5, 0.5);
+    Array2i resolution(113, 97);
+    for (int i = 0; i != resolution[0]; ++i)
+        for (int j = 0; j != resolution[1]; ++j)
+        {
+            Vec2d probe_point = lower_bound + (upper_bound - lower_bound).cwiseProduct(
+                                                  Vec2d(Real(i) / Real(resolution[0] - 1), Real(j) / Real(resolution[1] - 1)));
+            bool is_contained = referenceContain(sub_shapes_and_ops, probe_point);
+            Real distance = referenceDistance(sub_shapes_and_ops, probe_point);
+            Real signed_distance = is_contained ? -distance : distance;
+
+            EXPECT_EQ(composite_shape.checkContain(probe_point), is_contained);
+            EXPECT_NEAR((composite_shape.findClosestPoint(probe_point) - probe_point).norm(), distance, tolerance());
+            EXPECT_NEAR(composite_shape.findSignedDistance(probe_point), signed_distance, tolerance());
+
+            std::pair<Real, Vec2d> signed_distance_and_normal = composite_shape.findSignedDistanceAndNormal(probe_point);
+            EXPECT_NEAR(signed_distance_and_normal.first, signed_distance, tolerance());
+            if (distance > 1.0e-3)
+            {
+                EXPECT_LE((signed_distance_and_normal.second - composite_shape.findNormalDirection(probe_point)).norm(), 1.0e-6);
+            }
+        }
+}
+
+TEST(test_TransformShape, test_rotated_bounds)
+{
+    TransformShape<GeometricShapeBox> rotated_box(Transform(Rotation2d(0.3), Vec2d(1.5, 1.0)), Vec2d(0.6, 0.2));
+    BoundingBox bounds = rotated_box.getBounds();
+    for (int i = 0; i != 4; ++i)
+    {
+        Vec2d corner = Transform(Rotation2d(0.3), Vec2d(1.5, 1.0))
+                           .shiftFrameStationToBase(Vec2d(i % 2 == 0 ? -0.6 : 0.6, i / 2 == 0 ? -0.2 : 0.2));
+        EXPECT_TRUE((corner.array() >= bounds.first_.array() - tolerance()).all());
+        EXPECT_TRUE((corner.array() <= bounds.second_.array() + tolerance()).all());
+    }
+}
+
+TEST(test_TransformShape, test_bounds_after_set_transform)
+{
+    ComplexShape complex_shape("ComplexShape");
+    complex_shape.add<TransformShape<GeometricShapeBox>>(Transform(Vec2d(1.0, 1.0)), Vec2d(0.5, 0.5), "MovingBox");
+    auto *moving_box = dynamic_cast<TransformShape<GeometricShapeBox> *>(complex_shape.getSubShapeByName("MovingBox"));
+    ASSERT_NE(moving_box, nullptr);
+    EXPECT_TRUE(complex_shape.checkContain(Vec2d(1.0, 1.0)));
+    EXPECT_NEAR(complex_shape.getBounds().second_[0], 1.5, tolerance());
+
+    moving_box->setTransform(Transform(Vec2d(3.0, 1.0)));
+    BoundingBox bounds = moving_box->getBounds();
+    EXPECT_NEAR(bounds.first_[0], 2.5, tolerance());
+    EXPECT_NEAR(bounds.second_[0], 3.5, tolerance());
+    EXPECT_FALSE(complex_shape.checkContain(Vec2d(1.0, 1.0)));
+    EXPECT_TRUE(complex_shape.checkContain(Vec2d(3.0, 1.0)));
+    EXPECT_NEAR(complex_shape.findSignedDistance(Vec2d(3.0, 1.0)), -0.5, tolerance());
+    // the bounds of the parent shape follow the moved sub-shape
+    BoundingBox complex_bounds = complex_shape.getBounds();
+    EXPECT_NEAR(complex_bounds.first_[0], 2.5, tolerance());
+    EXPECT_NEAR(complex_bounds.second_[0], 3.5, tolerance());
+}
+
+TEST(test_TransformShape, test_transformed_binary_shapes)
+{
+    Transform transform(Rotation2d(0.3), Vec2d(2.0, 1.0));
+    TransformShape<ComplexShape> transformed_complex_shape(transform, "TransformedComplexShape");
+    transformed_complex_shape.add<GeometricShapeBox>(Vec2d(0.6, 0.2));
+    transformed_complex_shape.subtract<GeometricShapeBall>(Vec2d(0.6, 0.0), 0.1);
+    TransformShape<GeometricShapeBox> transformed_box(transform, Vec2d(0.6, 0.2));
+    TransformShape<GeometricShapeBall> transformed_ball(transform, Vec2d(0.6, 0.0), 0.1);
+
+    Array2i resolution(41, 37);
+    StdVec<Vec2d> probe_points;
+    for (int i = 0; i != resolution[0]; ++i)
+        for (int j = 0; j != resolution[1]; ++j)
+        {
+            probe_points.push_back(Vec2d(1.0, 0.0) + Vec2d(2.0 * Real(i) / Real(resolution[0] - 1),
+                                                             2.0 * Real(j) / Real(resolution[1] - 1)));
+        }
+    StdVec<Real> signed_distances = transformed_complex_shape.findSignedDistances(probe_points);
+    for (size_t k = 0; k != probe_points.size(); ++k)
+    {
+        const Vec2d &probe_point = probe_points[k];
+        // the signed distances of the box and the ball are found by the default functions of the base shape
+        Real reference_distance = SMAX(transformed_box.findSignedDistance(probe_point),
+                                       -transformed_ball.findSignedDistance(probe_point));
+        EXPECT_NEAR(transformed_complex_shape.findSignedDistance(probe_point), reference_distance, tolerance());
+        EXPECT_NEAR(signed_distances[k], reference_distance, tolerance());
+
+        std::pair<Real, Vec2d> signed_distance_and_normal = transformed_complex_shape.findSignedDistanceAndNormal(probe_point);
+        EXPECT_NEAR(signed_distance_and_normal.first, reference_distance, tolerance());
+        if (ABS(reference_distance) > 1.0e-3)
+        {
+            EXPECT_LE((signed_distance_and_normal.second - transformed_complex_shape.findNormalDirection(probe_point)).norm(), 1.0e-6);
+        }
+    }
+}
+
 int main(int argc, char *argv[])
 {
     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,124 @@
+#include "multi_polygon_shape.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+std::string airfoil_flap_front = "./input/airfoil_flap_front.dat";
+std::string airfoil_wing = "./input/airfoil_wing.dat";
+std::string airfoil_flap_rear = "./input/airfoil_flap_rear.dat";
+auto tolerance = []()
+{ return 100 * Eps; }; // Invalid initialization order with static libraries on GCC 9.4 requires function
+
+class Airfoil : public MultiPolygonShape
+{
+  public:
+    explicit Airfoil(const std::string &shape_name) : MultiPolygonShape(shape_name)
+    {
+        multi_polygon_.addAPolygonFromFile(airfoil_flap_front, ShapeBooleanOps::add);
+        multi_polygon_.addAPolygonFromFile(airfoil_wing, ShapeBooleanOps::add);
+        multi_polygon_.addAPolygonFromFile(airfoil_flap_rear, ShapeBooleanOps::add);
+    }
+    const boost_multi_poly &getBoostMultiPoly() { return multi_polygon_.getBoostMultiPoly(); };
+};
+
+/** Reference distance visiting all segments and containment by boost. */
+Real referenceDistance(const boost_multi_poly &multi_poly, const Vecd &probe_point)
+{
+    model::d2::point_xy<Real> input_p(probe_point[0], probe_point[1]);
+    Real closest_distance = MaxReal;
+    boost::geometry::for_each_segment(
+        multi_poly, [&](const model::referring_segment<const model::d2::point_xy<Real>> &segment)
+        { closest_distance = SMIN(closest_distance, Real(boost::geometry::distance(input_p, segment))); });
+    return closest_distance;
+}
+
+bool referenceContain(const boost_multi_poly &multi_poly, const Vecd &probe_point)
+{
+    return covered_by(model::d2::point_xy<Real>(probe_point[0], probe_point[1]), multi_poly);
+}
+
+TEST(test_MultiPolygonShape, test_airfoil_queries)
+{
+    Airfoil airfoil("Airfoil");
+    const boost_multi_poly &multi_poly = airfoil.getBoostMultiPoly();
+    BoundingBox bounds = airfoil.getBounds();
+    Vecd extension = 0.1 * (bounds.second_ - bounds.first_);
+    Vecd lower_bound = bounds.first_ - extension;
+    Vecd upper_bound = bounds.second_ + extension;
+
+    size_t number_of_probes = 0;
+    size_t number_of_contained = 0;
+    Array2i resolution(301, 97);
+    for (int i = 0; i != resolution[0]; ++i)
+        for (int j = 0; j != resolution[1]; ++j)
+        {
+            Vecd probe_point = lower_bound + (upper_bound - lower_bound).cwiseProduct(
+                                                 Vecd(Real(i) / Real(resolution[0] - 1), Real(j) / Real(resolution[1] - 1)));
+            Real reference_distance = referenceDistance(multi_poly, probe_point);
+            EXPECT_NEAR((airfoil.findClosestPoint(probe_point) - probe_point).norm(), reference_distance, tolerance());
+            bool is_contained = referenceContain(multi_poly, probe_point);
+            EXPECT_EQ(airfoil.checkContain(probe_point), is_contained);
+            number_of_probes++;
+            number_of_contained += is_contained ? 1 : 0;
+        }
+    EXPECT_GT(number_of_contained, size_t(0));
+    EXPECT_LT(number_of_contained, number_of_probes);
+}
+
+TEST(test_MultiPolygonShape, test_batched_signed_distances)
+{
+    Airfoil airfoil("Airfoil");
+    const boost_multi_poly &multi_poly = airfoil.getBoostMultiPoly();
+    BoundingBox bounds = airfoil.getBounds();
+    Real data_spacing = 0.002;
+    /** Packages of 4 x 4 data points along the chord line, crossing the surface. */
+    for (Real x = bounds.first_[0] - 0.01; x < bounds.second_[0] + 0.01; x += 4.0 * data_spacing)
+    {
+        Real y_center = 0.5 * (bounds.first_[1] + bounds.second_[1]);
+        for (Real y = bounds.first_[1] - 0.01; y < bounds.second_[1] + 0.01; y += 4.0 * data_spacing)
+        {
+            StdVec<Vecd> probe_points;
+            for (int i = 0; i != 4; ++i)
+                for (int j = 0; j != 4; ++j)
+                    probe_points.push_back(Vecd(x + i * data_spacing, y + j * data_spacing + 0.1 * (y - y_center)));
+
+            StdVec<Real> signed_distances = airfoil.findSignedDistances(probe_points);
+            ASSERT_EQ(signed_distances.size(), probe_points.size());
+            for (size_t n = 0; n != probe_points.size(); ++n)
+            {
+                Real reference_distance = referenceDistance(multi_poly, probe_points[n]);
+                Real reference_signed_distance =
+                    referenceContain(multi_poly, probe_points[n]) ? -reference_distance : reference_distance;
+                EXPECT_NEAR(signed_distances[n], reference_signed_distance, tolerance());
+                EXPECT_NEAR(signed_distances[n], airfoil.findSignedDistance(probe_points[n]), tolerance());
+            }
+        }
+    }
+}
+
+TEST(test_MultiPolygonShape, test_boundary_and_holes)
+{
+    MultiPolygon multi_polygon(Vecd(0.5, 0.5), 1.0, 100);
+    MultiPolygon hole(Vecd(0.5, 0.5), 0.5, 100);
+    multi_polygon.addAMultiPolygon(hole, ShapeBooleanOps::sub);
+    std::vector<Vecd> square = {Vecd(3.0, 0.0), Vecd(3.0, 1.0), Vecd(4.0, 1.0), Vecd(4.0, 0.0), Vecd(3.0, 0.0)};
+    multi_polygon.addAPolygon(square, ShapeBooleanOps::add);
+
+    EXPECT_FALSE(multi_polygon.checkContain(Vecd(0.5, 0.5)));
+    EXPECT_TRUE(multi_polygon.checkContain(Vecd(0.5, 1.25)));
+    EXPECT_FALSE(multi_polygon.checkContain(Vecd(2.0, 0.5)));
+    EXPECT_TRUE(multi_polygon.checkContain(Vecd(3.5, 0.5)));
+    /** A vertex and an edge point of the square and a point on the ray through its top edge. */
+    EXPECT_TRUE(multi_polygon.checkContain(Vecd(3.0, 1.0), true));
+    EXPECT_FALSE(multi_polygon.checkContain(Vecd(3.0, 1.0), false));
+    EXPECT_TRUE(multi_polygon.checkContain(Vecd(4.0, 0.5), true));
+    EXPECT_FALSE(multi_polygon.checkContain(Vecd(4.0, 0.5), false));
+    EXPECT_FALSE(multi_polygon.checkContain(Vecd(2.0, 1.0)));
+    EXPECT_LE((multi_polygon.findClosestPoint(Vecd(3.5, 2.0)) - Vecd(3.5, 1.0)).norm(), tolerance());
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
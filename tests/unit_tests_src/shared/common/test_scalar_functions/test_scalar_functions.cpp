@@ -1,4 +1,5 @@
 #include "scalar_functions.h"
+#include "scalar_root_finding.h"
 #include "sphinxsys.h"
 #include <gtest/gtest.h>
 using namespace SPH;
@@ -16,6 +17,35 @@ TEST(test_scalar_functions, test_WENO)
     EXPECT_EQ(2.5, Right_state);
 }
 
+TEST(test_scalar_functions, test_SafeguardedNewtonSolver)
+{
+    SafeguardedNewtonSolver solver(1.0e-12, 50);
+    /** Newton from the initial guess overshoots the bracket for the arc tangent. */
+    Real root = solver.solve([](Real x)
+                             { return std::make_pair(atan(x - 1.0), 1.0 / (1.0 + (x - 1.0) * (x - 1.0))); },
+                             -10.0, 20.0, 15.0, 1.0);
+    EXPECT_NEAR(root, 1.0, 1.0e-10);
+    /** Residual increasing or decreasing within the bracket. */
+    root = solver.solve([](Real x)
+                        { return std::make_pair(2.0 - x * x * x, -3.0 * x * x); },
+                        0.0, 2.0, 0.0, 2.0);
+    EXPECT_NEAR(root, pow(2.0, 1.0 / 3.0), 1.0e-10);
+    /** Infinite derivative at the lower bound of a Herschel-Bulkley type flow equation. */
+    root = solver.solve([](Real x)
+                        {
+                            Real flow = sqrt(SMAX(x - 1.0, Real(0)));
+                            return std::make_pair(x - 3.0 + flow, 1.0 + 0.5 / (flow + TinyReal)); },
+                        1.0, 3.0, 2.0, 3.0);
+    EXPECT_NEAR(root - 3.0 + sqrt(root - 1.0), 0.0, 1.0e-10);
+    EXPECT_EQ(solver.NumberOfNonConvergedSolves(), size_t(0));
+
+    solver.setMaxIterations(2);
+    solver.solve([](Real x)
+                 { return std::make_pair(atan(x - 1.0), 1.0 / (1.0 + (x - 1.0) * (x - 1.0))); },
+                 -10.0, 20.0, 15.0, 1.0);
+    EXPECT_EQ(solver.NumberOfNonConvergedSolves(), size_t(1));
+}
+
 int main(int argc, char *argv[])
 {
     testing::InitGoogleTest(&argc, argv);
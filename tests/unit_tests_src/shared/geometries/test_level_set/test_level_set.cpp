@@ -0,0 +1,71 @@
+#include "level_set_ck.hpp"
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real particle_spacing = 0.05;
+BoundingBox system_domain_bounds(Vec2d(-2.0, -2.0), Vec2d(2.0, 2.0));
+
+StdVec<Vecd> probePositions()
+{
+    StdVec<Vecd> positions;
+    for (int i = 0; i != 37; ++i)
+        for (int j = 0; j != 37; ++j)
+        {
+            positions.push_back(Vec2d(1.5 - 0.0831 * i, 1.5 - 0.0817 * j));
+        }
+    return positions;
+}
+
+TEST(test_level_set, lazy_kernel_integrals)
+{
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    RealBody ball(sph_system, makeShared<GeometricShapeBall>(Vec2d::Zero(), 1.0, "Ball"));
+    Shape &shape = ball.getInitialShape();
+    SPHAdaptation &sph_adaptation = *ball.sph_adaptation_;
+    LevelSet lazy_level_set(shape.getBounds(), particle_spacing, shape, sph_adaptation);
+    LevelSet eager_level_set(shape.getBounds(), particle_spacing, shape, sph_adaptation);
+
+    for (size_t k = 0; k != 2; ++k)
+    {
+        eager_level_set.prepareAllKernelIntegrals();
+        for (const Vecd &position : probePositions())
+        {
+            EXPECT_EQ(lazy_level_set.probeKernelIntegral(position), eager_level_set.probeKernelIntegral(position));
+            EXPECT_EQ(lazy_level_set.probeKernelGradientIntegral(position),
+                      eager_level_set.probeKernelGradientIntegral(position));
+        }
+        // the kernel integrals are recomputed after the level set is changed
+        lazy_level_set.cleanInterface(1.0);
+        eager_level_set.cleanInterface(1.0);
+    }
+}
+
+TEST(test_level_set, disabled_kernel_integrals)
+{
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    RealBody ball(sph_system, makeShared<GeometricShapeBall>(Vec2d::Zero(), 1.0, "Ball"));
+    LevelSetShape &level_set_shape = *ball.defineBodyLevelSetShape()->disableKernelIntegrals();
+    LevelSetCK::ProbeKernel probe(execution::ParallelPolicy(), level_set_shape.getLevelSetCK());
+
+    size_t number_of_narrow_band_probes = 0;
+    for (const Vecd &position : probePositions())
+    {
+        // the level set is only exact within the narrow band around the surface
+        if (ABS(position.norm() - 1.0) < 2.0 * particle_spacing)
+        {
+            EXPECT_NEAR(level_set_shape.findSignedDistance(position), position.norm() - 1.0, 0.5 * particle_spacing);
+            number_of_narrow_band_probes++;
+        }
+        EXPECT_NEAR(probe.probeSignedDistance(position), level_set_shape.findSignedDistance(position), 1.0e-12);
+    }
+    EXPECT_GT(number_of_narrow_band_probes, 0);
+    EXPECT_EXIT(level_set_shape.computeKernelIntegral(Vec2d(1.0, 0.0)), testing::ExitedWithCode(1), "");
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
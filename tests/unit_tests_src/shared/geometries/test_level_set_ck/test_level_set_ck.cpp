@@ -0,0 +1,72 @@
+#include "level_set_ck.hpp"
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real particle_spacing = 0.05;
+BoundingBox system_domain_bounds(Vec2d(-2.0, -2.0), Vec2d(2.0, 2.0));
+
+StdVec<Vecd> probePositions()
+{
+    StdVec<Vecd> positions;
+    for (int i = 0; i != 37; ++i)
+        for (int j = 0; j != 37; ++j)
+        {
+            positions.push_back(Vec2d(-1.1 + 0.0611 * i, -1.1 + 0.0603 * j));
+        }
+    return positions;
+}
+
+TEST(test_level_set_ck, single_level)
+{
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    RealBody ball(sph_system, makeShared<GeometricShapeBall>(Vec2d::Zero(), 1.0, "Ball"));
+    LevelSetShape &level_set_shape = *ball.defineBodyLevelSetShape();
+    LevelSetCK::ProbeKernel probe(execution::ParallelPolicy(), level_set_shape.getLevelSetCK());
+
+    for (const Vecd &position : probePositions())
+    {
+        // the level set is only exact within the narrow band around the surface
+        if (ABS(position.norm() - 1.0) < 2.0 * particle_spacing)
+            EXPECT_NEAR(probe.probeSignedDistance(position), position.norm() - 1.0, 0.5 * particle_spacing);
+        EXPECT_NEAR(probe.probeSignedDistance(position), level_set_shape.findSignedDistance(position), 1.0e-12);
+        EXPECT_LT((probe.probeLevelSetGradient(position) - level_set_shape.findLevelSetGradient(position)).norm(), 1.0e-12);
+        EXPECT_NEAR(probe.probeKernelIntegral(position), level_set_shape.computeKernelIntegral(position), 1.0e-12);
+        EXPECT_LT((probe.probeKernelGradientIntegral(position) -
+                   level_set_shape.computeKernelGradientIntegral(position))
+                      .norm(),
+                  1.0e-12);
+        EXPECT_TRUE(probe.probeIsWithinMeshBound(position));
+    }
+    EXPECT_FALSE(probe.probeIsWithinMeshBound(Vec2d(10.0, 0.0)));
+}
+
+TEST(test_level_set_ck, multilevel)
+{
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    RealBody ball(sph_system, makeShared<GeometricShapeBall>(Vec2d::Zero(), 1.0, "Ball"));
+    ball.defineAdaptation<ParticleRefinementNearSurface>(1.3, 1.0, 2);
+    LevelSetShape &level_set_shape = *ball.defineBodyLevelSetShape();
+    LevelSetCK::ProbeKernel probe(execution::ParallelPolicy(), level_set_shape.getLevelSetCK());
+
+    for (const Vecd &position : probePositions())
+    {
+        EXPECT_LT((probe.probeLevelSetGradient(position) - level_set_shape.findLevelSetGradient(position)).norm(), 1.0e-12);
+        for (Real h_ratio : {1.5, 2.0, 3.0})
+        {
+            EXPECT_NEAR(probe.probeKernelIntegral(position, h_ratio),
+                        level_set_shape.computeKernelIntegral(position, h_ratio), 1.0e-12);
+            EXPECT_LT((probe.probeKernelGradientIntegral(position, h_ratio) -
+                       level_set_shape.computeKernelGradientIntegral(position, h_ratio))
+                          .norm(),
+                      1.0e-12);
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,125 @@
+#include "io_columnar_recording.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real sampleTime(size_t n) { return 0.0123 * Real(n); };
+Real sampleReal(size_t n) { return std::sin(0.1 * Real(n)) * 1.0e3; };
+Vecd sampleVecd(size_t n) { return Vecd::Constant(1.0 / (Real(n) + 1.0)); };
+
+/** The legacy output opening the file for each line. */
+void writeLegacyText(const std::string &filefullpath, size_t number_of_records)
+{
+    PltEngine plt_engine;
+    std::ofstream header_file(filefullpath.c_str(), std::ios::app);
+    header_file << "\"run_time\""
+                << "   ";
+    plt_engine.writeAQuantityHeader(header_file, sampleReal(0), "Energy");
+    plt_engine.writeAQuantityHeader(header_file, sampleVecd(0), "Position");
+    header_file << "\n";
+    header_file.close();
+    for (size_t n = 0; n != number_of_records; ++n)
+    {
+        std::ofstream out_file(filefullpath.c_str(), std::ios::app);
+        out_file << sampleTime(n) << "   ";
+        plt_engine.writeAQuantity(out_file, sampleReal(n));
+        plt_engine.writeAQuantity(out_file, sampleVecd(n));
+        out_file << "\n";
+        out_file.close();
+    }
+}
+
+void writeColumnarRecording(const std::string &filefullpath_without_extension, bool is_binary,
+                            size_t number_of_records)
+{
+    ColumnarRecording recording;
+    recording.open(filefullpath_without_extension, is_binary);
+    recording.setRecordsPerFlush(7);
+    recording.addTimeColumn();
+    recording.addColumn(sampleReal(0), "Energy");
+    recording.addColumn(sampleVecd(0), "Position");
+    recording.closeHeader();
+    for (size_t n = 0; n != number_of_records; ++n)
+    {
+        recording.beginRecord(sampleTime(n));
+        recording.appendToRecord(sampleReal(n));
+        recording.appendToRecord(sampleVecd(n));
+        recording.closeRecord();
+    }
+}
+
+std::string readFile(const std::string &filefullpath)
+{
+    std::ifstream in_file(filefullpath.c_str(), std::ios::binary);
+    std::stringstream content;
+    content << in_file.rdbuf();
+    return content.str();
+}
+
+TEST(test_ColumnarRecording, text_equivalence)
+{
+    size_t number_of_records = 50;
+    fs::remove("legacy_recording.dat");
+    fs::remove("text_recording.dat");
+    writeLegacyText("legacy_recording.dat", number_of_records);
+    writeColumnarRecording("text_recording", false, number_of_records);
+    EXPECT_EQ(readFile("text_recording.dat"), readFile("legacy_recording.dat"));
+
+    ColumnarRecordingReader reader("text_recording.dat");
+    EXPECT_FALSE(reader.isBinary());
+    EXPECT_EQ(reader.RecordSize(), size_t(2 + Dimensions));
+    EXPECT_EQ(reader.NumberOfRecords(), number_of_records);
+    EXPECT_EQ(reader.ColumnNames()[1], "Energy");
+    StdVec<Real> energy = reader.getColumn("Energy");
+    for (size_t n = 0; n != number_of_records; ++n)
+        EXPECT_NEAR(energy[n], sampleReal(n), 1.0e-8);
+}
+
+TEST(test_ColumnarRecording, binary_records)
+{
+    size_t number_of_records = 50;
+    fs::remove("binary_recording.bin");
+    writeColumnarRecording("binary_recording", true, number_of_records);
+
+    ColumnarRecordingReader reader("binary_recording.bin");
+    EXPECT_TRUE(reader.isBinary());
+    EXPECT_EQ(reader.ColumnNames(), StdVec<std::string>({"run_time", "Energy", "Position"}));
+    EXPECT_EQ(reader.ColumnDimensions(), StdVec<size_t>({1, 1, size_t(Dimensions)}));
+    EXPECT_EQ(reader.NumberOfRecords(), number_of_records);
+    for (size_t n = 0; n != number_of_records; ++n)
+    {
+        EXPECT_EQ(reader.getValue(n, 0), sampleTime(n));
+        EXPECT_EQ(reader.getValue(n, 1), sampleReal(n));
+        EXPECT_EQ(reader.getValue(n, 2), sampleVecd(n)[0]);
+    }
+    StdVec<Real> last_component = reader.getColumn("Position", Dimensions - 1);
+    EXPECT_EQ(last_component.back(), sampleVecd(number_of_records - 1)[Dimensions - 1]);
+}
+
+TEST(test_ColumnarRecording, buffered_flush)
+{
+    fs::remove("buffered_recording.bin");
+    ColumnarRecording recording;
+    recording.open("buffered_recording", true);
+    recording.setRecordsPerFlush(4);
+    recording.addTimeColumn();
+    recording.addColumn(sampleReal(0), "Energy");
+    recording.closeHeader();
+    size_t header_size = fs::file_size("buffered_recording.bin");
+    for (size_t n = 0; n != 6; ++n)
+    {
+        recording.beginRecord(sampleTime(n));
+        recording.appendToRecord(sampleReal(n));
+        recording.closeRecord();
+    }
+    /** Only the first block of records is on the disk. */
+    EXPECT_EQ(fs::file_size("buffered_recording.bin"), header_size + 4 * 2 * sizeof(Real));
+    recording.flush();
+    EXPECT_EQ(fs::file_size("buffered_recording.bin"), header_size + 6 * 2 * sizeof(Real));
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,109 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+class MovingBlock : public ControlledSimulation
+{
+  public:
+    MovingBlock()
+        : block_shape_(Transform(Vec2d(0.5, 0.5)), Vec2d(0.5, 0.5), "Block"),
+          sph_system_(BoundingBox(Vec2d(-1.0, -1.0), Vec2d(10.0, 2.0)), 0.1),
+          block_(sph_system_, block_shape_), observer_(sph_system_, "Observer")
+    {
+        sph_system_.setIOEnvironment();
+        block_.defineMaterial<BaseMaterial>();
+        block_.generateParticles<BaseParticles, Lattice>();
+        vel_ = block_.getBaseParticles().registerStateVariable<Vecd>("Velocity");
+        observer_.generateParticles<ObserverParticles>(StdVec<Vecd>{Vec2d(0.5, 0.4), Vec2d(0.5, 0.6)});
+        observer_contact_ = makeUnique<ContactRelation>(observer_, RealBodyVector{&block_});
+        total_position_ = makeUnique<ReducedQuantityRecording<QuantitySummation<Vecd>>>(block_, "Position");
+        observed_velocity_ = makeUnique<ObservedQuantityRecording<Vecd>>("Velocity", *observer_contact_);
+        observed_position_ = makeUnique<ObservedQuantityRecording<Vecd>>("Position", *observer_contact_);
+        sph_system_.initializeSystemCellLinkedLists();
+        sph_system_.initializeSystemConfigurations();
+
+        addActuator("VelocityX", [&](Real action)
+                    {
+                        for (size_t i = 0; i != block_.getBaseParticles().TotalRealParticles(); ++i)
+                            vel_[i] = Vec2d(action, 0.0);
+                    });
+        addObservable("TotalPosition", *total_position_);
+        addObservable("ObservedVelocity", *observed_velocity_);
+        addObservable("Time", 1, [&](Real *observation)
+                      { observation[0] = time_; });
+        addObservable("ObservedPosition", *observed_position_);
+    };
+
+    Real time_ = 0.0;
+    Real dt_ = 0.01;
+
+  protected:
+    TransformShape<GeometricShapeBox> block_shape_;
+    SPHSystem sph_system_;
+    RealBody block_;
+    ObserverBody observer_;
+    UniquePtr<ContactRelation> observer_contact_;
+    UniquePtr<ReducedQuantityRecording<QuantitySummation<Vecd>>> total_position_;
+    UniquePtr<ObservedQuantityRecording<Vecd>> observed_velocity_;
+    UniquePtr<ObservedQuantityRecording<Vecd>> observed_position_;
+    Vecd *vel_ = nullptr;
+
+    virtual void advance(Real duration) override
+    {
+        Real end_time = time_ + duration;
+        BaseParticles &particles = block_.getBaseParticles();
+        Vecd *pos = particles.ParticlePositions();
+        while (time_ < end_time - 0.5 * dt_)
+        {
+            applyActuators();
+            for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+                pos[i] += vel_[i] * dt_;
+            time_ += dt_;
+        }
+        block_.updateCellLinkedList();
+        observer_contact_->updateConfiguration();
+    };
+};
+
+TEST(test_controlled_simulation, contiguous_observations)
+{
+    MovingBlock moving_block;
+    EXPECT_EQ(moving_block.ActionSize(), size_t(1));
+    EXPECT_EQ(moving_block.ObservationSize(), size_t(11));
+    EXPECT_EQ(moving_block.ObservableNames(),
+              StdVec<std::string>({"TotalPosition", "ObservedVelocity", "Time", "ObservedPosition"}));
+    EXPECT_EQ(moving_block.ObservableOffset("ObservedVelocity"), size_t(2));
+    EXPECT_EQ(moving_block.ObservableSize("ObservedVelocity"), size_t(4));
+    EXPECT_EQ(moving_block.ObservableOffset("Time"), size_t(6));
+
+    StdVec<Real> initial_observations = moving_block.observe();
+    Real number_of_particles = 100.0;
+    EXPECT_NEAR(initial_observations[0], 0.5 * number_of_particles, 1.0e-8);
+    EXPECT_NEAR(initial_observations[1], 0.5 * number_of_particles, 1.0e-8);
+    // component-major: the x positions of both observers followed by their y positions
+    EXPECT_NEAR(initial_observations[7], 0.5, 1.0e-6);
+    EXPECT_NEAR(initial_observations[8], 0.5, 1.0e-6);
+    EXPECT_NEAR(initial_observations[9], 0.4, 1.0e-6);
+    EXPECT_NEAR(initial_observations[10], 0.6, 1.0e-6);
+
+    StdVec<Real> observations = moving_block.step({1.0}, 0.2);
+    EXPECT_NEAR(observations[0], 0.7 * number_of_particles, 1.0e-8);
+    EXPECT_NEAR(observations[1], 0.5 * number_of_particles, 1.0e-8);
+    EXPECT_NEAR(observations[2], 1.0, 1.0e-6);
+    EXPECT_NEAR(observations[3], 1.0, 1.0e-6);
+    EXPECT_NEAR(observations[4], 0.0, 1.0e-6);
+    EXPECT_NEAR(observations[5], 0.0, 1.0e-6);
+    EXPECT_NEAR(observations[6], 0.2, 1.0e-8);
+
+    observations = moving_block.step({-0.5}, 0.2);
+    EXPECT_NEAR(observations[0], 0.6 * number_of_particles, 1.0e-8);
+    EXPECT_NEAR(observations[2], -0.5, 1.0e-6);
+    EXPECT_NEAR(observations[6], 0.4, 1.0e-8);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,97 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+TEST(test_quantity_accumulation, sampled_function)
+{
+    Real dt = 1.0e-4;
+    size_t window_size = 2500; // a quarter of the period
+    QuantityAccumulation<Real> accumulation(window_size);
+    QuantityAccumulation<Vecd> vector_accumulation(window_size);
+    for (size_t i = 0; i != 12500; ++i)
+    {
+        Real time = (Real(i) + 0.5) * dt; // midpoint samples
+        accumulation.accumulate(sin(2.0 * Pi * time), dt);
+        vector_accumulation.accumulate(Vec2d(sin(2.0 * Pi * time), time), dt);
+    }
+
+    EXPECT_EQ(accumulation.NumberOfSamples(), size_t(12500));
+    EXPECT_NEAR(accumulation.Duration(), 1.25, 1.0e-10);
+    EXPECT_NEAR(accumulation.Integral(), 0.5 / Pi, 1.0e-8);
+    EXPECT_NEAR(accumulation.Minimum(), -1.0, 1.0e-6);
+    EXPECT_NEAR(accumulation.Maximum(), 1.0, 1.0e-6);
+    EXPECT_NEAR(accumulation.Average(), 0.4 / Pi, 1.0e-8);
+    EXPECT_NEAR(accumulation.WindowAverage(), 2.0 / Pi, 1.0e-6);
+
+    EXPECT_NEAR(vector_accumulation.Minimum()[0], -1.0, 1.0e-6);
+    EXPECT_NEAR(vector_accumulation.Minimum()[1], 0.5 * dt, 1.0e-10);
+    EXPECT_NEAR(vector_accumulation.Maximum()[1], 1.25 - 0.5 * dt, 1.0e-10);
+    EXPECT_NEAR(vector_accumulation.Integral()[1], 0.5 * 1.25 * 1.25, 1.0e-8);
+    EXPECT_NEAR(vector_accumulation.WindowAverage()[1], 1.125, 1.0e-8);
+
+    accumulation.reset();
+    accumulation.accumulate(2.0, 0.5);
+    EXPECT_EQ(accumulation.Minimum(), 2.0);
+    EXPECT_EQ(accumulation.WindowAverage(), 2.0);
+}
+
+TEST(test_quantity_accumulation, moving_block)
+{
+    SPHSystem sph_system(BoundingBox(Vec2d(-1.0, -1.0), Vec2d(10.0, 2.0)), 0.1);
+    sph_system.setIOEnvironment();
+    TransformShape<GeometricShapeBox> block_shape(Transform(Vec2d(0.5, 0.5)), Vec2d(0.5, 0.5), "Block");
+    RealBody block(sph_system, block_shape);
+    block.defineMaterial<BaseMaterial>();
+    block.generateParticles<BaseParticles, Lattice>();
+    ObserverBody observer(sph_system, "Observer");
+    observer.generateParticles<ObserverParticles>(StdVec<Vecd>{Vec2d(0.5, 0.5)});
+    ContactRelation observer_contact(observer, {&block});
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+
+    BaseParticles &particles = block.getBaseParticles();
+    Vecd *pos = particles.ParticlePositions();
+    Real *x0 = particles.registerStateVariable<Real>("InitialX", [&](size_t i) -> Real
+                                                     { return pos[i][0]; });
+    size_t number_of_particles = particles.TotalRealParticles();
+    // the dense output to be compared with
+    ReducedQuantityRecording<QuantitySummation<Vecd>> total_position(block, "Position");
+    ReducedQuantityAccumulation<QuantitySummation<Vecd>> total_position_accumulation(100, block, "Position");
+    ObservedQuantityAccumulation<Real> observed_x_accumulation(100, "InitialX", observer_contact);
+
+    Real dt = 1.0e-3;
+    Real dense_integral = 0.0;
+    Real dense_minimum = MaxReal;
+    for (size_t step = 0; step != 1000; ++step)
+    {
+        Real time = Real(step) * dt;
+        // the block is oscillating in x direction
+        for (size_t i = 0; i != number_of_particles; ++i)
+            pos[i][0] = x0[i] + 0.2 * sin(2.0 * Pi * 5.0 * time);
+        block.updateCellLinkedList();
+        observer_contact.updateConfiguration();
+
+        Vecd dense_value = total_position.getReducedQuantity();
+        dense_integral += dense_value[0] * dt;
+        dense_minimum = SMIN(dense_minimum, dense_value[0]);
+        total_position_accumulation.accumulate(dt);
+        observed_x_accumulation.accumulate(dt);
+    }
+    total_position_accumulation.writeToFile();
+    observed_x_accumulation.writeToFile();
+
+    QuantityAccumulation<Vecd> &accumulation = total_position_accumulation.getAccumulation();
+    EXPECT_NEAR(accumulation.Integral()[0], dense_integral, 1.0e-8);
+    EXPECT_NEAR(accumulation.Minimum()[0], dense_minimum, 1.0e-8);
+    EXPECT_NEAR(accumulation.Average()[0], 0.5 * Real(number_of_particles), 1.0e-2 * Real(number_of_particles));
+    EXPECT_NEAR(accumulation.Maximum()[1], 0.5 * Real(number_of_particles), 1.0e-8);
+    // the initial position is observed at the same material point of the block
+    EXPECT_NEAR(observed_x_accumulation.getAccumulation(0).Average(), 0.5, 0.05);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,159 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+TEST(test_body_part_sorting, contiguous_and_remapped_body_parts)
+{
+    Real length = 10;
+    Real dp = 0.25;
+
+    MultiPolygon shape;
+    shape.addABox(Transform(0.5 * length * Vec2d::Ones()), 0.5 * length * Vec2d::Ones(), ShapeBooleanOps::add);
+    auto polygon_shape = makeShared<MultiPolygonShape>(shape, "PolygonShape");
+    SPHSystem system(polygon_shape->getBounds(), dp);
+
+    RealBody body(system, polygon_shape);
+    body.defineMaterial<BaseMaterial>();
+    body.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &particles = body.getBaseParticles();
+    particles.addVariableToSort<Vecd>("Position");
+    Vecd *pos = particles.ParticlePositions();
+    UnsignedInt *original_id = particles.ParticleOriginalIds();
+
+    auto box_a = makeShared<TransformShape<GeometricShapeBox>>(
+        Transform(Vec2d(3.0, 3.0)), Vec2d(2.0, 2.0), "BoxA");
+    auto box_b = makeShared<TransformShape<GeometricShapeBox>>(
+        Transform(Vec2d(5.0, 5.0)), Vec2d(2.0, 2.0), "BoxB");
+    BodyRegionByParticle region_a(body, box_a);
+    BodyRegionByParticle region_b(body, box_b); // overlaps with region_a
+    EXPECT_TRUE(region_a.isContiguous());
+    EXPECT_FALSE(region_b.isContiguous());
+
+    auto original_ids = [&](BodyPartByParticle &body_part)
+    {
+        IndexVector ids;
+        for (size_t index_i : body_part.body_part_particles_)
+            ids.push_back(original_id[index_i]);
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    };
+    IndexVector original_ids_a = original_ids(region_a);
+    IndexVector original_ids_b = original_ids(region_b);
+
+    ParticleSorting<ParallelPolicy> particle_sorting(body);
+    particle_sorting.exec();
+
+    IndexRange range_a = region_a.ContiguousRange();
+    EXPECT_EQ(range_a.size(), original_ids_a.size());
+    for (size_t k = 0; k != range_a.size(); ++k)
+    {
+        EXPECT_EQ(region_a.body_part_particles_[k], range_a.begin() + k);
+    }
+    EXPECT_EQ(original_ids(region_a), original_ids_a);
+    EXPECT_EQ(original_ids(region_b), original_ids_b);
+    for (size_t index_i : region_a.body_part_particles_)
+        EXPECT_TRUE(box_a->checkContain(pos[index_i]));
+    for (size_t index_i : region_b.body_part_particles_)
+        EXPECT_TRUE(box_b->checkContain(pos[index_i]));
+}
+
+TEST(test_body_part_sorting, body_parts_beyond_128_cells)
+{
+    Real length = 100;
+    Real height = 2;
+    Real dp = 0.25;
+
+    MultiPolygon shape;
+    shape.addABox(Transform(0.5 * Vec2d(length, height)), 0.5 * Vec2d(length, height), ShapeBooleanOps::add);
+    auto polygon_shape = makeShared<MultiPolygonShape>(shape, "PolygonShape");
+    SPHSystem system(polygon_shape->getBounds(), dp);
+
+    RealBody body(system, polygon_shape);
+    body.defineMaterial<BaseMaterial>();
+    body.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &particles = body.getBaseParticles();
+    particles.addVariableToSort<Vecd>("Position");
+    Vecd *pos = particles.ParticlePositions();
+    // the cell indices at the body parts are larger than 128 in x direction
+    ASSERT_GT(DynamicCast<CellLinkedList>(this, body.getCellLinkedList()).AllCells()[0], 150);
+
+    auto box_a = makeShared<TransformShape<GeometricShapeBox>>(
+        Transform(Vec2d(88.0, 1.0)), Vec2d(3.0, 1.0), "BoxA");
+    auto box_b = makeShared<TransformShape<GeometricShapeBox>>(
+        Transform(Vec2d(95.0, 1.0)), Vec2d(3.0, 1.0), "BoxB");
+    BodyRegionByParticle region_a(body, box_a);
+    BodyRegionByParticle region_b(body, box_b);
+    EXPECT_TRUE(region_a.isContiguous());
+    EXPECT_TRUE(region_b.isContiguous());
+    size_t number_of_particles_a = region_a.SizeOfLoopRange();
+    size_t number_of_particles_b = region_b.SizeOfLoopRange();
+
+    ParticleSorting<ParallelPolicy> particle_sorting(body);
+    particle_sorting.exec();
+
+    IndexRange range_a = region_a.ContiguousRange();
+    IndexRange range_b = region_b.ContiguousRange();
+    EXPECT_EQ(range_a.size(), number_of_particles_a);
+    EXPECT_EQ(range_b.size(), number_of_particles_b);
+    for (size_t index_i = range_a.begin(); index_i != range_a.end(); ++index_i)
+        EXPECT_TRUE(box_a->checkContain(pos[index_i]));
+    for (size_t index_i = range_b.begin(); index_i != range_b.end(); ++index_i)
+        EXPECT_TRUE(box_b->checkContain(pos[index_i]));
+}
+
+TEST(test_body_part_sorting, body_part_id_with_buffer_particles)
+{
+    Real length = 10;
+    Real dp = 0.25;
+
+    MultiPolygon shape;
+    shape.addABox(Transform(0.5 * length * Vec2d::Ones()), 0.5 * length * Vec2d::Ones(), ShapeBooleanOps::add);
+    auto polygon_shape = makeShared<MultiPolygonShape>(shape, "PolygonShape");
+    SPHSystem system(polygon_shape->getBounds(), dp);
+
+    RealBody body(system, polygon_shape);
+    body.defineMaterial<BaseMaterial>();
+    body.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &particles = body.getBaseParticles();
+    particles.addVariableToSort<Vecd>("Position");
+    Vecd *pos = particles.ParticlePositions();
+
+    auto box_a = makeShared<TransformShape<GeometricShapeBox>>(
+        Transform(Vec2d(3.0, 3.0)), Vec2d(2.0, 2.0), "BoxA");
+    {
+        // a removed body part neither stays registered nor leaves its ID on the particles
+        BodyRegionByParticle temporary_region(body, box_a);
+        EXPECT_EQ(body.getBodyPartsByParticle().size(), size_t(1));
+    }
+    EXPECT_TRUE(body.getBodyPartsByParticle().empty());
+    int *body_part_id = particles.getVariableDataByName<int>("BodyPartID");
+    for (size_t index_i = 0; index_i != particles.TotalRealParticles(); ++index_i)
+        EXPECT_EQ(body_part_id[index_i], 0);
+
+    BodyRegionByParticle region_a(body, box_a);
+    ASSERT_TRUE(region_a.isContiguous());
+    size_t number_of_particles_a = region_a.SizeOfLoopRange();
+    ParticleSorting<ParallelPolicy> particle_sorting(body);
+    particle_sorting.exec();
+
+    // the body part is sorted to the end, so that the last real particle,
+    // moved to the place of a deleted particle, carries the ID of the body part
+    size_t last_real_particle = particles.TotalRealParticles() - 1;
+    ASSERT_EQ(region_a.ContiguousRange().end(), particles.TotalRealParticles());
+    int id_a = body_part_id[last_real_particle];
+    particles.switchToBufferParticle(0);
+    EXPECT_EQ(body_part_id[0], id_a);
+
+    particle_sorting.exec();
+    IndexRange range_a = region_a.ContiguousRange();
+    EXPECT_EQ(range_a.size(), number_of_particles_a);
+    for (size_t index_i = range_a.begin(); index_i != range_a.end(); ++index_i)
+        EXPECT_TRUE(box_a->checkContain(pos[index_i]));
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,124 @@
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real particle_spacing = 0.005;
+Real rho0_f = 1.0;
+
+TEST(test_compressed_neighbor_index_ck, round_trip_random_indices)
+{
+    std::mt19937 random_engine(12345);
+    std::uniform_int_distribution<UnsignedInt> particle_distribution(0, UnsignedInt(1) << 30);
+    std::uniform_int_distribution<int> delta_distribution(-40000, 40000);
+    for (size_t n = 0; n != 1000; ++n)
+    {
+        UnsignedInt index_i = particle_distribution(random_engine);
+        StdVec<UnsignedInt> neighbors;
+        for (size_t k = 0; k != 100; ++k)
+        {
+            // mostly close neighbors, some just beyond the 16-bit range and some anywhere
+            UnsignedInt index_j = k % 10 == 0 ? particle_distribution(random_engine)
+                                               : UnsignedInt(SMAX(0, int(index_i) + delta_distribution(random_engine)));
+            neighbors.push_back(index_j);
+        }
+        neighbors.push_back(index_i + 32767);
+        neighbors.push_back(index_i - 32767);
+        neighbors.push_back(index_i + 32768);
+        neighbors.push_back(index_i - 32768);
+
+        UnsignedInt encoded_size = 0;
+        for (UnsignedInt index_j : neighbors)
+            encoded_size += CompressedNeighborIndex::encodedSize(index_i, index_j);
+        StdVec<int16_t> words(encoded_size);
+        UnsignedInt written = 0;
+        for (UnsignedInt index_j : neighbors)
+            written += CompressedNeighborIndex::encode(index_i, index_j, words.data() + written);
+        ASSERT_EQ(written, encoded_size);
+
+        StdVec<UnsignedInt> decoded_neighbors;
+        for (UnsignedInt read = 0; read != encoded_size;)
+        {
+            UnsignedInt index_j;
+            read += CompressedNeighborIndex::decode(index_i, words.data() + read, index_j);
+            decoded_neighbors.push_back(index_j);
+        }
+        EXPECT_EQ(decoded_neighbors, neighbors);
+    }
+}
+
+TEST(test_compressed_neighbor_index_ck, same_as_uncompressed)
+{
+    BoundingBox system_domain_bounds(Vec2d(-0.1, -0.1), Vec2d(1.1, 1.1));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setIOEnvironment();
+    TransformShape<GeometricShapeBox> block_shape(Transform(Vec2d(0.5, 0.5)), Vec2d(0.5, 0.5), "Block");
+    FluidBody block(sph_system, block_shape);
+    block.defineMaterial<WeaklyCompressibleFluid>(rho0_f, 10.0);
+    block.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &particles = block.getBaseParticles();
+    size_t total_real_particles = particles.TotalRealParticles();
+    //----------------------------------------------------------------------
+    //	Shuffled particles so that some neighbor indices need the escape path.
+    //----------------------------------------------------------------------
+    Vecd *pos = particles.ParticlePositions();
+    particles.addVariableToSort<Vecd>("Position");
+    std::shuffle(pos, pos + total_real_particles, std::mt19937(54321));
+
+    using MyExecutionPolicy = execution::ParallelPolicy;
+    UpdateCellLinkedList<MyExecutionPolicy, CellLinkedList> block_cell_linked_list(block);
+    Relation<Inner<>> block_inner(block);
+    Relation<Inner<>> compressed_block_inner(block);
+    compressed_block_inner.compressNeighborIndex();
+    UpdateRelation<MyExecutionPolicy, Inner<>> block_update_inner_relation(block_inner);
+    UpdateRelation<MyExecutionPolicy, Inner<>> compressed_block_update_inner_relation(compressed_block_inner);
+    ParticleSortCK<MyExecutionPolicy, QuickSort> particle_sort(block);
+    InteractionDynamicsCK<MyExecutionPolicy, fluid_dynamics::DensitySummationCKInner> density_summation(block_inner);
+    InteractionDynamicsCK<MyExecutionPolicy, fluid_dynamics::DensitySummationCKInner>
+        compressed_density_summation(compressed_block_inner);
+    Real *rho = particles.getVariableDataByName<Real>("Density");
+
+    auto compare_neighbors = [&]() -> Real
+    {
+        block_cell_linked_list.exec();
+        block_update_inner_relation.exec();
+        compressed_block_update_inner_relation.exec();
+        UnsignedInt *neighbor_index = block_inner.getNeighborIndex()->DataField();
+        UnsignedInt *particle_offset = block_inner.getParticleOffset()->DataField();
+        int16_t *words = compressed_block_inner.getCompressedNeighborIndex()->DataField();
+        UnsignedInt *word_offset = compressed_block_inner.getParticleOffset()->DataField();
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            StdVec<UnsignedInt> decoded_neighbors;
+            for (UnsignedInt n = word_offset[i]; n != word_offset[i + 1];)
+            {
+                UnsignedInt index_j;
+                n += CompressedNeighborIndex::decode(i, words + n, index_j);
+                decoded_neighbors.push_back(index_j);
+            }
+            EXPECT_EQ(decoded_neighbors, StdVec<UnsignedInt>(neighbor_index + particle_offset[i],
+                                                             neighbor_index + particle_offset[i + 1]));
+        }
+
+        density_summation.exec();
+        StdVec<Real> summed_density(rho, rho + total_real_particles);
+        compressed_density_summation.exec();
+        for (size_t i = 0; i != total_real_particles; ++i)
+            EXPECT_NEAR(rho[i], summed_density[i], 1.0e-12);
+
+        return Real(word_offset[total_real_particles]) / Real(particle_offset[total_real_particles]);
+    };
+    EXPECT_GT(compare_neighbors(), 1.05);
+    //----------------------------------------------------------------------
+    //	After sorting, the neighbors are close to the particles in memory.
+    //----------------------------------------------------------------------
+    block_cell_linked_list.exec();
+    particle_sort.exec();
+    EXPECT_LT(compare_neighbors(), 1.01);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
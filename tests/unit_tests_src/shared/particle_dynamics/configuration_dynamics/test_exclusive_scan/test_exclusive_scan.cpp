@@ -23,6 +23,23 @@ TEST(exclusive_scan, test_tbb)
     EXPECT_EQ(sum, sum_tbb);
 }
 
+TEST(exclusive_scan, test_tbb_large_list)
+{
+    UnsignedInt large_list_size = 1000003;
+    StdVec<UnsignedInt> large_list(large_list_size);
+    for (UnsignedInt i = 0; i != large_list_size; ++i)
+        large_list[i] = i % 7;
+    StdVec<UnsignedInt> large_solution(large_list_size);
+    std::exclusive_scan(large_list.begin(), large_list.end(), large_solution.begin(), UnsignedInt(0));
+
+    StdVec<UnsignedInt> large_tbb_result(large_list_size);
+    UnsignedInt sum_tbb = exclusive_scan(ParallelPolicy{}, large_list.data(), large_tbb_result.data(),
+                                         large_list_size, PlusUnsignedInt<ParallelPolicy>::type());
+
+    EXPECT_EQ(large_solution, large_tbb_result);
+    EXPECT_EQ(large_solution.back(), sum_tbb);
+}
+
 int main(int argc, char *argv[])
 {
     testing::InitGoogleTest(&argc, argv);
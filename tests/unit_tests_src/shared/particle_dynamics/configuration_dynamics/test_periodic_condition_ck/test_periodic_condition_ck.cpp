@@ -0,0 +1,84 @@
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real DL = 1.0;
+Real DH = 0.5;
+Real particle_spacing = 0.05;
+BoundingBox periodic_bounds(Vec2d::Zero(), Vec2d(DL, DH));
+
+StdVec<UnsignedInt> sortedNeighbors(UnsignedInt *neighbor_index, UnsignedInt *particle_offset, size_t index_i)
+{
+    StdVec<UnsignedInt> neighbors(neighbor_index + particle_offset[index_i], neighbor_index + particle_offset[index_i + 1]);
+    std::sort(neighbors.begin(), neighbors.end());
+    return neighbors;
+}
+
+TEST(test_periodic_condition_ck, same_neighbors_as_legacy)
+{
+    BoundingBox system_domain_bounds(Vec2d(-0.2, -0.2), Vec2d(DL + 0.2, DH + 0.2));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setIOEnvironment();
+    TransformShape<GeometricShapeBox> block_shape(Transform(0.5 * Vec2d(DL, DH)), 0.5 * Vec2d(DL, DH), "Block");
+    RealBody block(sph_system, block_shape);
+    block.defineMaterial<BaseMaterial>();
+    block.generateParticles<BaseParticles, Lattice>();
+    BaseParticles &particles = block.getBaseParticles();
+    size_t total_real_particles = particles.TotalRealParticles();
+    //----------------------------------------------------------------------
+    //	Legacy periodic condition inserting particles into the extra cells.
+    //----------------------------------------------------------------------
+    InnerRelation block_inner(block);
+    PeriodicAlongAxis periodic_along_x(periodic_bounds, xAxis);
+    PeriodicConditionUsingCellLinkedList periodic_condition(block, periodic_along_x);
+    sph_system.initializeSystemCellLinkedLists();
+    periodic_condition.update_cell_linked_list_.exec();
+    block_inner.updateConfiguration();
+    //----------------------------------------------------------------------
+    //	CK periodic condition without copying particles.
+    //----------------------------------------------------------------------
+    using MyExecutionPolicy = execution::ParallelPolicy;
+    StateDynamics<MyExecutionPolicy, PeriodicConditionCK> periodic_condition_ck(block, periodic_along_x);
+    UpdateCellLinkedList<MyExecutionPolicy, CellLinkedList> block_cell_linked_list(block);
+    Relation<Inner<>> block_inner_ck(block);
+    UpdateRelation<MyExecutionPolicy, Inner<>> block_update_inner_relation(block_inner_ck);
+    block_cell_linked_list.exec();
+    block_update_inner_relation.exec();
+
+    UnsignedInt *neighbor_index = block_inner_ck.getNeighborIndex()->DataField();
+    UnsignedInt *particle_offset = block_inner_ck.getParticleOffset()->DataField();
+    StdVec<UnsignedInt> initial_neighbor_size(total_real_particles);
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        Neighborhood &neighborhood = block_inner.inner_configuration_[i];
+        StdVec<UnsignedInt> legacy_neighbors(neighborhood.j_.begin(), neighborhood.j_.begin() + neighborhood.current_size_);
+        std::sort(legacy_neighbors.begin(), legacy_neighbors.end());
+        EXPECT_EQ(sortedNeighbors(neighbor_index, particle_offset, i), legacy_neighbors);
+        initial_neighbor_size[i] = particle_offset[i + 1] - particle_offset[i];
+    }
+    //----------------------------------------------------------------------
+    //	After a translation across the periodic bounds and wrapping,
+    //	the uniform lattice has the same neighbor sizes.
+    //----------------------------------------------------------------------
+    Vecd *pos = particles.ParticlePositions();
+    for (size_t i = 0; i != total_real_particles; ++i)
+        pos[i][0] += 0.3 * DL;
+    periodic_condition_ck.exec();
+    block_cell_linked_list.exec();
+    block_update_inner_relation.exec();
+
+    particle_offset = block_inner_ck.getParticleOffset()->DataField();
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        EXPECT_GE(pos[i][0], 0.0);
+        EXPECT_LT(pos[i][0], DL);
+        EXPECT_EQ(particle_offset[i + 1] - particle_offset[i], initial_neighbor_size[i]);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,121 @@
+#include "particle_functors.h"
+#include "sphinxsys.h"
+#include "update_cell_linked_list.h"
+
+#include <gtest/gtest.h>
+using namespace SPH;
+
+TEST(particle_for, test_work_weighted)
+{
+    /** Neighbor counts with a heavy tail, empty particles in between and at the end. */
+    UnsignedInt number_of_particles = 100003;
+    StdVec<UnsignedInt> neighbor_count(number_of_particles + 1, 0);
+    for (UnsignedInt i = 0; i != number_of_particles - 3; ++i)
+        neighbor_count[i] = i % 5 == 0 ? 0 : (i < 1000 ? 200 : i % 30);
+    StdVec<UnsignedInt> neighbor_offset(number_of_particles + 1);
+    exclusive_scan(ParallelPolicy{}, neighbor_count.data(), neighbor_offset.data(),
+                   number_of_particles + 1, PlusUnsignedInt<ParallelPolicy>::type());
+
+    StdVec<std::atomic<int>> visits(number_of_particles);
+    for (auto &visit : visits)
+        visit = 0;
+    particle_for(ParallelPolicy{}, IndexRange(0, number_of_particles), neighbor_offset.data(),
+                 [&](size_t i)
+                 { visits[i]++; });
+    for (UnsignedInt i = 0; i != number_of_particles; ++i)
+        EXPECT_EQ(visits[i], 1);
+
+    /** A sub-range and the sequenced fallback. */
+    StdVec<int> sequenced_visits(number_of_particles, 0);
+    particle_for(SequencedPolicy{}, IndexRange(7, 5003), neighbor_offset.data(),
+                 [&](size_t i)
+                 { sequenced_visits[i]++; });
+    particle_for(ParallelPolicy{}, IndexRange(7, 5003), neighbor_offset.data(),
+                 [&](size_t i)
+                 { sequenced_visits[i]++; });
+    for (UnsignedInt i = 0; i != number_of_particles; ++i)
+        EXPECT_EQ(sequenced_visits[i], i >= 7 && i < 5003 ? 2 : 0);
+}
+
+/** Records the inner neighbor count of each particle. */
+class InnerNeighborCount : public LocalDynamics, public DataDelegateInner
+{
+  public:
+    explicit InnerNeighborCount(BaseInnerRelation &inner_relation)
+        : LocalDynamics(inner_relation.getSPHBody()), DataDelegateInner(inner_relation),
+          neighbor_count_(particles_->TotalRealParticles(), 0){};
+
+    void interaction(size_t index_i, Real dt = 0.0)
+    {
+        neighbor_count_[index_i] = inner_configuration_[index_i].current_size_;
+    };
+    StdVec<UnsignedInt> neighbor_count_;
+};
+
+class WeightedInnerNeighborCount : public InteractionDynamics<InnerNeighborCount>
+{
+  public:
+    using InteractionDynamics<InnerNeighborCount>::InteractionDynamics;
+    UnsignedInt *NeighborOffset() { return workload_->NeighborOffset(); };
+};
+
+TEST(InteractionDynamics, test_work_weighted_by_own_configuration)
+{
+    Real dp = 0.1;
+    auto water_shape = makeShared<GeometricShapeBox>(Vec2d(1.0, 0.5), "Water");
+    auto wall_shape = makeShared<TransformShape<GeometricShapeBox>>(
+        Transform(Vec2d(0.0, -0.6)), Vec2d(1.2, 0.1), "Wall");
+    SPHSystem system(BoundingBox(Vec2d(-1.5, -1.0), Vec2d(1.5, 1.0)), dp);
+
+    RealBody water(system, water_shape);
+    water.defineMaterial<BaseMaterial>();
+    water.generateParticles<BaseParticles, Lattice>();
+    RealBody wall(system, wall_shape);
+    wall.defineMaterial<BaseMaterial>();
+    wall.generateParticles<BaseParticles, Lattice>();
+
+    InnerRelation water_inner(water);
+    ContactRelation water_wall_contact(water, {&wall}); // not used by the dynamics below
+    water.updateCellLinkedList();
+    wall.updateCellLinkedList();
+    water_inner.updateConfiguration();
+    water_wall_contact.updateConfiguration();
+
+    WeightedInnerNeighborCount neighbor_count(water_inner);
+    neighbor_count.enableWorkWeighting();
+    neighbor_count.exec();
+
+    /** The weights only count the configuration used by the dynamics. */
+    size_t total_real_particles = water.getBaseParticles().TotalRealParticles();
+    UnsignedInt *neighbor_offset = neighbor_count.NeighborOffset();
+    UnsignedInt total_inner_neighbors = 0;
+    UnsignedInt total_contact_neighbors = 0;
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        EXPECT_EQ(neighbor_offset[i], total_inner_neighbors);
+        EXPECT_EQ(neighbor_count.neighbor_count_[i], water_inner.inner_configuration_[i].current_size_);
+        total_inner_neighbors += water_inner.inner_configuration_[i].current_size_;
+        total_contact_neighbors += water_wall_contact.contact_configuration_[0][i].current_size_;
+    }
+    EXPECT_EQ(neighbor_offset[total_real_particles], total_inner_neighbors);
+    EXPECT_GT(total_contact_neighbors, 0);
+
+    /** The offset is kept until the configuration of the dynamics is updated. */
+    water.getBaseParticles().ParticlePositions()[0] = Vec2d(-1.4, 0.9); // isolated
+    water.updateCellLinkedList();
+    water_wall_contact.updateConfiguration();
+    EXPECT_EQ(neighbor_count.NeighborOffset()[total_real_particles], total_inner_neighbors);
+
+    water_inner.updateConfiguration();
+    UnsignedInt updated_inner_neighbors = 0;
+    for (size_t i = 0; i != total_real_particles; ++i)
+        updated_inner_neighbors += water_inner.inner_configuration_[i].current_size_;
+    EXPECT_LT(updated_inner_neighbors, total_inner_neighbors);
+    EXPECT_EQ(neighbor_count.NeighborOffset()[total_real_particles], updated_inner_neighbors);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
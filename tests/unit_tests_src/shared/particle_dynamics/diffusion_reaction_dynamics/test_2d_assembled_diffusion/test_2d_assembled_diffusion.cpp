@@ -0,0 +1,155 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real L = 1.0;
+Real H = 1.0;
+Real resolution_ref = H / 40.0;
+Real BW = resolution_ref * 3.0;
+
+class DirichletWallBoundary : public ComplexShape
+{
+  public:
+    explicit DirichletWallBoundary(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vec2d halfsize(0.25 * L, 0.5 * BW);
+        add<TransformShape<GeometricShapeBox>>(Transform(Vec2d(0.5 * L, H + 0.5 * BW)), halfsize);
+    }
+};
+
+class NeumannWallBoundary : public ComplexShape
+{
+  public:
+    explicit NeumannWallBoundary(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vec2d halfsize(0.5 * BW, 0.25 * H);
+        add<TransformShape<GeometricShapeBox>>(Transform(Vec2d(-0.5 * BW, 0.5 * H)), halfsize);
+    }
+};
+
+class RobinWallBoundary : public ComplexShape
+{
+  public:
+    explicit RobinWallBoundary(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vec2d halfsize(0.25 * L, 0.5 * BW);
+        add<TransformShape<GeometricShapeBox>>(Transform(Vec2d(0.5 * L, -0.5 * BW)), halfsize);
+    }
+};
+
+using ListDiffusionRelaxation = DiffusionBodyRelaxationComplex<
+    IsotropicDiffusion, KernelGradientInner, KernelGradientContact, Dirichlet, Neumann, Robin>;
+using AssembledDiffusionRelaxation = DiffusionBodyRelaxationComplex<
+    IsotropicDiffusion, Assembled<KernelGradientInner>, Assembled<KernelGradientContact>, Dirichlet, Neumann, Robin>;
+
+TEST(test_assembled_diffusion, same_as_neighbor_list)
+{
+    BoundingBox system_domain_bounds(Vec2d(-BW, -BW), Vec2d(L + BW, H + BW));
+    SPHSystem sph_system(system_domain_bounds, resolution_ref);
+    sph_system.setIOEnvironment();
+    SolidBody diffusion_body(sph_system, makeShared<TransformShape<GeometricShapeBox>>(
+                                             Transform(Vec2d(0.5 * L, 0.5 * H)), Vec2d(0.5 * L, 0.5 * H), "DiffusionBody"));
+    diffusion_body.defineMaterial<Solid>();
+    diffusion_body.generateParticles<BaseParticles, Lattice>();
+    SolidBody wall_Dirichlet(sph_system, makeShared<DirichletWallBoundary>("DirichletWallBoundary"));
+    wall_Dirichlet.defineMaterial<Solid>();
+    wall_Dirichlet.generateParticles<BaseParticles, Lattice>();
+    SolidBody wall_Neumann(sph_system, makeShared<NeumannWallBoundary>("NeumannWallBoundary"));
+    wall_Neumann.defineMaterial<Solid>();
+    wall_Neumann.generateParticles<BaseParticles, Lattice>();
+    SolidBody wall_Robin(sph_system, makeShared<RobinWallBoundary>("RobinWallBoundary"));
+    wall_Robin.defineMaterial<Solid>();
+    wall_Robin.generateParticles<BaseParticles, Lattice>();
+
+    InnerRelation diffusion_inner(diffusion_body);
+    ContactRelation contact_Dirichlet(diffusion_body, {&wall_Dirichlet});
+    ContactRelation contact_Neumann(diffusion_body, {&wall_Neumann});
+    ContactRelation contact_Robin(diffusion_body, {&wall_Robin});
+    //----------------------------------------------------------------------
+    //	Two species with different diffusivities share the sparsity pattern.
+    //----------------------------------------------------------------------
+    IsotropicDiffusion phi_diffusion("Phi", "Phi", 1.0);
+    IsotropicDiffusion psi_diffusion("Psi", "Psi", 0.3);
+    StdVec<IsotropicDiffusion *> diffusions = {&phi_diffusion, &psi_diffusion};
+
+    SimpleDynamics<NormalDirectionFromBodyShape> diffusion_body_normal_direction(diffusion_body);
+    SimpleDynamics<NormalDirectionFromBodyShape> Neumann_normal_direction(wall_Neumann);
+    SimpleDynamics<NormalDirectionFromBodyShape> Robin_normal_direction(wall_Robin);
+    ListDiffusionRelaxation list_relaxation(
+        ConstructorArgs(diffusion_inner, diffusions), ConstructorArgs(contact_Dirichlet, diffusions),
+        ConstructorArgs(contact_Neumann, diffusions), ConstructorArgs(contact_Robin, diffusions));
+    AssembledDiffusionRelaxation assembled_relaxation(
+        ConstructorArgs(diffusion_inner, diffusions), ConstructorArgs(contact_Dirichlet, diffusions),
+        ConstructorArgs(contact_Neumann, diffusions), ConstructorArgs(contact_Robin, diffusions));
+    GetDiffusionTimeStepSize get_time_step_size(diffusion_body, phi_diffusion);
+
+    sph_system.initializeSystemCellLinkedLists();
+    sph_system.initializeSystemConfigurations();
+    diffusion_body_normal_direction.exec();
+    Neumann_normal_direction.exec();
+    Robin_normal_direction.exec();
+    //----------------------------------------------------------------------
+    //	Boundary conditions, which may change in time, are read at each step.
+    //----------------------------------------------------------------------
+    BaseParticles &particles = diffusion_body.getBaseParticles();
+    size_t total_real_particles = particles.TotalRealParticles();
+    Vecd *pos = particles.ParticlePositions();
+    StdVec<Real *> species = {particles.getVariableDataByName<Real>("Phi"),
+                              particles.getVariableDataByName<Real>("Psi")};
+    auto set_boundary_conditions = [&](Real scale)
+    {
+        for (size_t m = 0; m != 2; ++m)
+        {
+            std::string name = diffusions[m]->DiffusionSpeciesName();
+            BaseParticles &Dirichlet_particles = wall_Dirichlet.getBaseParticles();
+            Real *phi_Dirichlet = Dirichlet_particles.getVariableDataByName<Real>(name);
+            for (size_t j = 0; j != Dirichlet_particles.TotalRealParticles(); ++j)
+                phi_Dirichlet[j] = scale * (300.0 + 100.0 * m);
+
+            BaseParticles &Neumann_particles = wall_Neumann.getBaseParticles();
+            Real *flux_Neumann = Neumann_particles.getVariableDataByName<Real>(name + "Flux");
+            for (size_t j = 0; j != Neumann_particles.TotalRealParticles(); ++j)
+                flux_Neumann[j] = scale * (50.0 - 20.0 * m);
+
+            BaseParticles &Robin_particles = wall_Robin.getBaseParticles();
+            Real *convection_Robin = Robin_particles.getVariableDataByName<Real>(name + "Convection");
+            for (size_t j = 0; j != Robin_particles.TotalRealParticles(); ++j)
+                convection_Robin[j] = scale * (100.0 + 10.0 * m);
+            *Robin_particles.getSingularVariableByName<Real>(name + "Infinity")->ValueAddress() = 400.0 - 50.0 * m;
+        }
+    };
+    auto run_relaxation = [&](BaseDynamics<void> &relaxation, StdVec<StdVec<Real>> &results)
+    {
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            species[0][i] = 100.0 + 10.0 * pos[i][0];
+            species[1][i] = 200.0 - 20.0 * pos[i][1];
+        }
+        Real dt = get_time_step_size.exec();
+        for (size_t step = 0; step != 20; ++step)
+        {
+            set_boundary_conditions(1.0 + 0.05 * Real(step));
+            relaxation.exec(dt);
+        }
+        results.clear();
+        for (size_t m = 0; m != 2; ++m)
+            results.push_back(StdVec<Real>(species[m], species[m] + total_real_particles));
+    };
+
+    StdVec<StdVec<Real>> list_results, assembled_results;
+    run_relaxation(list_relaxation, list_results);
+    run_relaxation(assembled_relaxation, assembled_results);
+    for (size_t m = 0; m != 2; ++m)
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            EXPECT_NEAR(assembled_results[m][i], list_results[m][i], 1.0e-9);
+        }
+    EXPECT_GT(list_results[0][0], 100.0 + 10.0 * pos[0][0]);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
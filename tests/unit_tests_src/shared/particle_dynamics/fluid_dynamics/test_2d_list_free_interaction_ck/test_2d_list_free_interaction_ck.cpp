@@ -0,0 +1,128 @@
+#include "sphinxsys_ck.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real DL = 2.0;
+Real DH = 1.0;
+Real LL = 1.0;
+Real LH = 0.5;
+Real particle_spacing = 0.025;
+Real BW = particle_spacing * 4;
+Real rho0_f = 1.0;
+Real c_f = 10.0;
+
+class WallBoundary : public ComplexShape
+{
+  public:
+    explicit WallBoundary(const std::string &shape_name) : ComplexShape(shape_name)
+    {
+        Vec2d outer_wall_halfsize = Vec2d(0.5 * DL + BW, 0.5 * DH + BW);
+        Vec2d inner_wall_halfsize = Vec2d(0.5 * DL, 0.5 * DH);
+        add<TransformShape<GeometricShapeBox>>(Transform(Vec2d(-BW, -BW) + outer_wall_halfsize), outer_wall_halfsize);
+        subtract<TransformShape<GeometricShapeBox>>(Transform(inner_wall_halfsize), inner_wall_halfsize);
+    }
+};
+
+TEST(test_list_free_interaction_ck, same_as_neighbor_list)
+{
+    BoundingBox system_domain_bounds(Vec2d(-BW, -BW), Vec2d(DL + BW, DH + BW));
+    SPHSystem sph_system(system_domain_bounds, particle_spacing);
+    sph_system.setIOEnvironment();
+    TransformShape<GeometricShapeBox> water_shape(Transform(0.5 * Vec2d(LL, LH)), 0.5 * Vec2d(LL, LH), "WaterBody");
+    FluidBody water_block(sph_system, water_shape);
+    water_block.defineMaterial<WeaklyCompressibleFluid>(rho0_f, c_f);
+    water_block.generateParticles<BaseParticles, Lattice>();
+    SolidBody wall_boundary(sph_system, makeShared<WallBoundary>("WallBoundary"));
+    wall_boundary.defineMaterial<Solid>();
+    wall_boundary.generateParticles<BaseParticles, Lattice>();
+
+    using MyExecutionPolicy = execution::ParallelPolicy;
+    UpdateCellLinkedList<MyExecutionPolicy, CellLinkedList> water_cell_linked_list(water_block);
+    UpdateCellLinkedList<MyExecutionPolicy, CellLinkedList> wall_cell_linked_list(wall_boundary);
+    Relation<Inner<>> water_block_inner(water_block);
+    Relation<Contact<>> water_wall_contact(water_block, {&wall_boundary});
+    UpdateRelation<MyExecutionPolicy, Inner<>, Contact<>>
+        water_block_update_complex_relation(water_block_inner, water_wall_contact);
+
+    StateDynamics<MyExecutionPolicy, NormalFromBodyShapeCK> wall_boundary_normal_direction(wall_boundary);
+    StateDynamics<MyExecutionPolicy, fluid_dynamics::AdvectionStepSetup> water_advection_step_setup(water_block);
+    InteractionDynamicsCK<MyExecutionPolicy, fluid_dynamics::AcousticStep1stHalfWithWallRiemannCK>
+        list_based_acoustic_step(water_block_inner, water_wall_contact);
+    InteractionDynamicsCK<MyExecutionPolicy, fluid_dynamics::AcousticStep1stHalfWithWallRiemannCK>
+        list_free_acoustic_step(water_block_inner, water_wall_contact);
+    list_free_acoustic_step.enableListFreeSearch();
+    InteractionDynamicsCK<MyExecutionPolicy, fluid_dynamics::DensityRegularizationComplexFreeSurface>
+        list_based_density_regularization(water_block_inner, water_wall_contact);
+    InteractionDynamicsCK<MyExecutionPolicy, fluid_dynamics::DensityRegularizationComplexFreeSurface>
+        list_free_density_regularization(water_block_inner, water_wall_contact);
+    list_free_density_regularization.enableListFreeSearch();
+    list_free_density_regularization.enableWorkWeighting(); // ignored without neighbor lists
+
+    wall_boundary_normal_direction.exec();
+    water_cell_linked_list.exec();
+    wall_cell_linked_list.exec();
+    water_block_update_complex_relation.exec();
+    water_advection_step_setup.exec();
+
+    BaseParticles &particles = water_block.getBaseParticles();
+    size_t total_real_particles = particles.TotalRealParticles();
+    Vecd *pos = particles.ParticlePositions();
+    Real *rho = particles.getVariableDataByName<Real>("Density");
+    Real *drho_dt = particles.getVariableDataByName<Real>("DensityChangeRate");
+    Vecd *force = particles.getVariableDataByName<Vecd>("Force");
+    auto initialize_state = [&]()
+    {
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            rho[i] = rho0_f * (1.0 + 0.01 * (LH - pos[i][1]) + 0.001 * pos[i][0]);
+            force[i] = Vecd::Zero();
+        }
+    };
+    auto record_results = [&](StdVec<Vecd> &force_result, StdVec<Real> &drho_dt_result, StdVec<Real> &rho_result,
+                              BaseDynamics<void> &acoustic_step, BaseDynamics<void> &density_regularization)
+    {
+        initialize_state();
+        acoustic_step.exec(0.0);
+        force_result.assign(force, force + total_real_particles);
+        drho_dt_result.assign(drho_dt, drho_dt + total_real_particles);
+        initialize_state();
+        density_regularization.exec();
+        rho_result.assign(rho, rho + total_real_particles);
+    };
+    auto compare_results = [&]()
+    {
+        StdVec<Vecd> list_based_force, list_free_force;
+        StdVec<Real> list_based_drho_dt, list_free_drho_dt, list_based_rho, list_free_rho;
+        // the list-free search only needs the cell linked lists, it runs before the neighbor lists are rebuilt
+        record_results(list_free_force, list_free_drho_dt, list_free_rho,
+                       list_free_acoustic_step, list_free_density_regularization);
+        water_block_update_complex_relation.exec();
+        record_results(list_based_force, list_based_drho_dt, list_based_rho,
+                       list_based_acoustic_step, list_based_density_regularization);
+        for (size_t i = 0; i != total_real_particles; ++i)
+        {
+            EXPECT_LT((list_free_force[i] - list_based_force[i]).norm(), 1.0e-12);
+            EXPECT_NEAR(list_free_drho_dt[i], list_based_drho_dt[i], 1.0e-12);
+            EXPECT_NEAR(list_free_rho[i], list_based_rho[i], 1.0e-12);
+        }
+        EXPECT_GT(list_based_force[0].norm(), 0.0);
+    };
+    compare_results();
+    //----------------------------------------------------------------------
+    //	After moving the particles, only the cell linked list is updated
+    //	before the list-free interactions.
+    //----------------------------------------------------------------------
+    for (size_t i = 0; i != total_real_particles; ++i)
+    {
+        pos[i] += 0.2 * particle_spacing * Vec2d(sin(10.0 * pos[i][1]), cos(10.0 * pos[i][0]));
+    }
+    water_cell_linked_list.exec();
+    compare_results();
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
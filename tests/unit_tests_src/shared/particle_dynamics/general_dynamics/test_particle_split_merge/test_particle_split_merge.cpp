@@ -0,0 +1,98 @@
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+TEST(test_particle_split_merge, conservation_and_particle_number)
+{
+    Real length = 1.0;
+    Real dp = 0.1;
+
+    MultiPolygon shape;
+    shape.addABox(Transform(0.5 * length * Vec2d::Ones()), 0.5 * length * Vec2d::Ones(), ShapeBooleanOps::add);
+    auto polygon_shape = makeShared<MultiPolygonShape>(shape, "PolygonShape");
+    SPHSystem system(polygon_shape->getBounds(), dp);
+
+    RealBody body(system, polygon_shape);
+    body.defineAdaptation<ParticleWithLocalRefinement>(1.3, 1.0, 1);
+    body.defineMaterial<BaseMaterial>();
+    ParticleBuffer<ReserveSizeFactor> buffer(3.0);
+    body.generateParticlesWithReserve<BaseParticles, Lattice>(buffer);
+    BaseParticles &particles = body.getBaseParticles();
+    AdaptiveInnerRelation inner(body);
+    ParticleSplitAndMerge<ParallelPolicy> particle_split_merge(inner, buffer);
+
+    Vecd *pos = particles.ParticlePositions();
+    Vecd *vel = particles.getVariableDataByName<Vecd>("Velocity");
+    Real *mass = particles.getVariableDataByName<Real>("Mass");
+    Real *Vol = particles.getVariableDataByName<Real>("VolumetricMeasure");
+    Real *h_ratio = particles.getVariableDataByName<Real>("SmoothingLengthRatio");
+    Real *target_h_ratio = particles.getVariableDataByName<Real>("TargetSmoothingLengthRatio");
+    for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+    {
+        vel[i] = Vecd(pos[i][1], -pos[i][0] * pos[i][0]);
+        target_h_ratio[i] = pos[i][0] < 0.5 * length ? 2.0 : 1.0; // refine the left half
+    }
+
+    auto totals = [&]()
+    {
+        Real total_mass = 0.0, total_volume = 0.0;
+        Vecd total_momentum = Vecd::Zero(), mass_center = Vecd::Zero();
+        for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+        {
+            total_mass += mass[i];
+            total_volume += Vol[i];
+            total_momentum += mass[i] * vel[i];
+            mass_center += mass[i] * pos[i];
+        }
+        return std::make_tuple(total_mass, total_volume, total_momentum, mass_center);
+    };
+    auto check_conservation = [&](const std::tuple<Real, Real, Vecd, Vecd> &reference)
+    {
+        auto [total_mass, total_volume, total_momentum, mass_center] = totals();
+        EXPECT_NEAR(total_mass, std::get<0>(reference), 1.0e-10);
+        EXPECT_NEAR(total_volume, std::get<1>(reference), 1.0e-10);
+        EXPECT_LT((total_momentum - std::get<2>(reference)).norm(), 1.0e-10);
+        EXPECT_LT((mass_center - std::get<3>(reference)).norm(), 1.0e-10);
+    };
+
+    auto initial_totals = totals();
+    size_t initial_number = particles.TotalRealParticles();
+    size_t refined_number = 0;
+    for (size_t i = 0; i != initial_number; ++i)
+    {
+        if (target_h_ratio[i] > 1.0)
+            refined_number++;
+    }
+
+    particle_split_merge.exec();
+    check_conservation(initial_totals);
+    EXPECT_EQ(particles.TotalRealParticles(), initial_number + 3 * refined_number);
+    for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+    {
+        EXPECT_NEAR(h_ratio[i], target_h_ratio[i], 1.0e-10);
+    }
+
+    // coarsening back merges pairs of the split particles only
+    for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+    {
+        target_h_ratio[i] = 1.0;
+    }
+    body.updateCellLinkedList();
+    inner.updateConfiguration();
+    particle_split_merge.exec();
+    check_conservation(initial_totals);
+    EXPECT_LT(particles.TotalRealParticles(), initial_number + 3 * refined_number);
+    EXPECT_GE(particles.TotalRealParticles(), initial_number + refined_number);
+    for (size_t i = 0; i != particles.TotalRealParticles(); ++i)
+    {
+        EXPECT_GE(h_ratio[i], 1.0 - Eps);
+        EXPECT_LE(h_ratio[i], 2.0 + Eps);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
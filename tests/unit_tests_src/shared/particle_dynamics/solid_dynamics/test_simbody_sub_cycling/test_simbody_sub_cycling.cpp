@@ -0,0 +1,113 @@
+/**
+ * @file 	test_simbody_sub_cycling.cpp
+ * @brief 	Test of the sub-cycled coupling with Simbody on a pinned flap.
+ * @details The flap is driven by a model hydrodynamic force, which depends on
+ *			the kinematics at the flap tip, as the force from the fluid particles does.
+ *			The tip history with a nonzero coupling interval is compared with
+ *			the one obtained by coupling at every time step.
+ */
+#include "sphinxsys.h"
+#include <gtest/gtest.h>
+
+using namespace SPH;
+
+Real flap_mass = 33.04;
+Real flap_height = 0.48;
+Real flap_width = 0.12;
+Real reference_spacing = flap_width / 4.0;
+Real added_mass = 5.0;
+Real restoring_stiffness = 1000.0;
+Real damping_coefficient = 20.0;
+Real wave_force_amplitude = 20.0;
+Real wave_period = 2.0;
+Real end_time = 4.0;
+Real time_step = 1.0e-4;
+Real sampling_interval = 0.01;
+//----------------------------------------------------------------------
+//	Tip displacement history of the flap with a given maximum coupling interval.
+//----------------------------------------------------------------------
+StdVec<Real> simulateFlap(Real maximum_coupling_interval, size_t &number_of_coupling_steps)
+{
+    SimTK::MultibodySystem MBsystem;
+    SimTK::SimbodyMatterSubsystem matter(MBsystem);
+    SimTK::GeneralForceSubsystem forces(MBsystem);
+    /** a slender flap rotating about its bottom end. */
+    Real moment_of_inertia = flap_mass * flap_height * flap_height / 3.0;
+    SimTK::Body::Rigid flap_info(SimTK::MassProperties(
+        flap_mass, SimTKVec3(0.0, 0.5 * flap_height, 0.0),
+        SimTK::Inertia(moment_of_inertia, flap_mass * flap_width * flap_width / 12.0, moment_of_inertia)));
+    SimTK::MobilizedBody::Pin pin(matter.Ground(), SimTK::Transform(SimTKVec3(0.0)),
+                                  flap_info, SimTK::Transform(SimTKVec3(0.0)));
+    pin.setDefaultAngle(0);
+    SimTK::Force::UniformGravity sim_gravity(forces, matter, SimTKVec3(0.0, -9.81, 0.0), 0.0);
+    SimTK::Force::DiscreteForces force_on_bodies(forces, matter);
+    SimTK::State state = MBsystem.realizeTopology();
+    SimTK::RungeKuttaMersonIntegrator integ(MBsystem);
+    integ.setAccuracy(1e-3);
+    integ.setAllowInterpolation(false);
+    integ.initialize(state);
+
+    Real added_mass_ratio = added_mass * flap_height * flap_height / moment_of_inertia;
+    solid_dynamics::SimBodySubCycling sub_cycling(MBsystem, pin, integ, force_on_bodies, reference_spacing,
+                                                  flap_height, maximum_coupling_interval, added_mass_ratio);
+
+    SimTKVec3 tip(0.0, flap_height, 0.0);
+    StdVec<Real> tip_history;
+    Real time = 0.0;
+    Real sampling_time = 0.0;
+    while (time < end_time)
+    {
+        const SimTK::State &current_state = integ.getState();
+        MBsystem.realize(current_state, SimTK::Stage::Acceleration);
+        SimTKVec3 origin = sub_cycling.predictBodyOriginLocation(current_state);
+        SimTKVec3 pos, vel, acc;
+        sub_cycling.predictStationKinematics(current_state, tip, pos, vel, acc);
+
+        if (time >= sampling_time)
+        {
+            tip_history.push_back(pos[0]);
+            sampling_time += sampling_interval;
+        }
+
+        SimTKVec3 force(wave_force_amplitude * sin(2.0 * Pi * time / wave_period) -
+                            restoring_stiffness * pos[0] - damping_coefficient * vel[0] - added_mass * acc[0],
+                        0.0, 0.0);
+        sub_cycling.accumulateForce(SimTK::SpatialVec(SimTK::cross(pos - origin, force), force), time_step);
+        sub_cycling.advanceSimBody();
+        time += time_step;
+    }
+    number_of_coupling_steps = sub_cycling.NumberOfCouplingSteps();
+    return tip_history;
+}
+//----------------------------------------------------------------------
+//	Test.
+//----------------------------------------------------------------------
+TEST(SimBodySubCycling, FlapHistory)
+{
+    size_t direct_coupling_steps = 0;
+    StdVec<Real> direct_history = simulateFlap(0.0, direct_coupling_steps);
+    size_t sub_cycled_coupling_steps = 0;
+    StdVec<Real> sub_cycled_history = simulateFlap(20.0 * time_step, sub_cycled_coupling_steps);
+
+    ASSERT_EQ(direct_history.size(), sub_cycled_history.size());
+    Real amplitude = 0.0;
+    Real maximum_difference = 0.0;
+    for (size_t i = 0; i != direct_history.size(); ++i)
+    {
+        amplitude = SMAX(amplitude, ABS(direct_history[i]));
+        maximum_difference = SMAX(maximum_difference, ABS(direct_history[i] - sub_cycled_history[i]));
+    }
+    std::cout << "Coupling steps: " << direct_coupling_steps << " direct, "
+              << sub_cycled_coupling_steps << " sub-cycled. Maximum tip difference: "
+              << maximum_difference << " of amplitude " << amplitude << std::endl;
+
+    EXPECT_GT(amplitude, reference_spacing);
+    EXPECT_LT(maximum_difference, 0.05 * amplitude);
+    EXPECT_LT(sub_cycled_coupling_steps, direct_coupling_steps / 10);
+}
+//----------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}